@@ -402,7 +402,9 @@ void c_disort(disort_state  *ds,
     prntu0[2],
     corint,deltam,scat_yes,compare,lyrcut,needdeltam,
     iq,iu,j,kconv,l,lc,lev,lu,mazim,naz,ncol,ncos,ncut,nn;
-  static int
+  /* Thread-local, as ARTS calls c_disort from several threads at once. The
+   * count is only passed on to the BRDF routines, which ARTS does not use. */
+  static _Thread_local int
     callnum=1;
   int
     ipvt[ds->nstr*ds->nlyr],
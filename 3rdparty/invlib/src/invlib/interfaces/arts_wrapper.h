@@ -8,6 +8,7 @@
 #include <iostream>
 
 #include "matpack.h"
+#include "matpack_alloc.h"
 #include "matpackI.h"
 #include "matpackII.h"
 #include "lin_alg.h"
@@ -420,6 +420,15 @@ arts_api.get_variable_value.restype  = VariableValueStruct
 arts_api.set_variable_value.argtypes = [c.c_void_p, c.c_long, c.c_long, VariableValueStruct]
 arts_api.set_variable_value.restype  =  c.c_char_p
 
+# Let a workspace variable use an external buffer as its storage, without
+# copying. The buffer must be kept alive until released.
+arts_api.set_variable_value_external.argtypes = [c.c_void_p, c.c_long, c.c_long, VariableValueStruct]
+arts_api.set_variable_value_external.restype  =  c.c_char_p
+
+# Detach all variables from an external buffer before it is freed.
+arts_api.release_external_buffer.argtypes = [c.c_void_p, c.c_void_p]
+arts_api.release_external_buffer.restype  = None
+
 # Adds a value of a given group to a given workspace.
 arts_api.add_variable.restype  = c.c_long
 arts_api.add_variable.argtypes = [c.c_void_p, c.c_long, c.c_char_p]
@@ -70,6 +70,7 @@ void Agenda::append(const String& methodname, const TokVal& keywordvalue) {
 
   mml.push_back(MRecord(id, output, input, keywordvalue, Agenda()));
   mchecked = false;
+  mprepared.resize(0);
 }
 
 //! Checks consistency of an agenda.
@@ -137,6 +138,44 @@ void Agenda::check(Workspace& ws, const Verbosity& verbosity) {
   set_outputs_to_push_and_dup(verbosity);
 
   mchecked = true;
+  prepare();
+}
+
+//! Prepare the agenda for execution.
+/*!
+  Looks up the getaway function of each method and collects the
+  variables that must be initialized before the method is called. Called
+  by check and set_main_agenda. Agendas modified afterwards are prepared
+  again in each execution.
+
+  Only these lookups are saved. The arguments of the methods are still
+  taken from the workspace stack in each call, and each execution still
+  duplicates the verbosity.
+*/
+void Agenda::prepare() { prepare_methods(mprepared); }
+
+void Agenda::prepare_methods(Array<PreparedMethod>& prepared) const {
+  using global_data::md_data;
+
+  extern void (*getaways[])(Workspace&, const MRecord&);
+
+  prepared.resize(mml.nelem());
+  for (Index i = 0; i < mml.nelem(); ++i) {
+    const MRecord& mrr = mml[i];
+    const MdRecord& mdd = md_data[mrr.Id()];
+    PreparedMethod& cm = prepared[i];
+
+    cm.getaway = getaways[mrr.Id()];
+
+    // All inputs, except for the value of Set methods, and the outputs
+    // that are also used as input
+    const ArrayOfIndex& v = mrr.In();
+    cm.required.resize(0);
+    for (Index s = 0; s < v.nelem(); ++s)
+      if (s != v.nelem() - 1 || !mdd.SetMethod()) cm.required.push_back(v[s]);
+    for (Index s = 0; s < mdd.InOut().nelem(); ++s)
+      cm.required.push_back(mrr.Out()[mdd.InOut()[s]]);
+  }
 }
 
 //! Execute an agenda.
@@ -170,13 +209,8 @@ void Agenda::execute(Workspace& ws) const {
   // An empty Agenda name indicates that something going wrong here
   assert(mname != "");
 
-  // The method description lookup table:
-  using global_data::md_data;
-
-  // The array holding the pointers to the getaway functions:
-  extern void (*getaways[])(Workspace&, const MRecord&);
-
-  const Index wsv_id_verbosity = get_wsv_id("verbosity");
+  // The id never changes, look it up only once
+  static const Index wsv_id_verbosity = get_wsv_id("verbosity");
   ws.duplicate(wsv_id_verbosity);
 
   Verbosity& averbosity = *((Verbosity*)ws[wsv_id_verbosity]);
@@ -193,47 +227,47 @@ void Agenda::execute(Workspace& ws) const {
           << "{\n";
   }
 
-  for (Index i = 0; i < mml.nelem(); ++i) {
-    const Verbosity& verbosity = *((Verbosity*)ws[wsv_id_verbosity]);
-    CREATE_OUT1;
-    CREATE_OUT3;
+  // Agendas modified after they were checked are prepared here
+  Array<PreparedMethod> local;
+  if (mprepared.nelem() != mml.nelem()) prepare_methods(local);
+  const Array<PreparedMethod>& methods =
+      mprepared.nelem() == mml.nelem() ? mprepared : local;
+
+  // The method description lookup table:
+  using global_data::md_data;
+
+  // The verbosity variable stays in place while the methods run, and the
+  // output streams only refer to it
+  const Verbosity& verbosity = averbosity;
+  CREATE_OUT1;
+  CREATE_OUT3;
 
+  for (Index i = 0; i < mml.nelem(); ++i) {
     // Runtime method data for this method:
     const MRecord& mrr = mml[i];
     // Method data for this method:
     const MdRecord& mdd = md_data[mrr.Id()];
+    // Prepared call of this method:
+    const PreparedMethod& cm = methods[i];
 
     try {
       {
         if (mrr.isInternal()) {
-          out3 << "- " + mdd.Name() + "\n";
+          out3 << "- " << mdd.Name() << "\n";
         } else {
-          out1 << "- " + mdd.Name() + "\n";
+          out1 << "- " << mdd.Name() << "\n";
         }
       }
 
-      {  // Check if all input variables are initialized:
-        const ArrayOfIndex& v(mrr.In());
-        for (Index s = 0; s < v.nelem(); ++s)
-          if ((s != v.nelem() - 1 || !mdd.SetMethod()) &&
-              !ws.is_initialized(v[s]))
-            throw runtime_error(
-                "Method " + mdd.Name() +
-                " needs input variable: " + Workspace::wsv_data[v[s]].Name());
-      }
-
-      {  // Check if all output variables which are also used as input
-        // are initialized
-        const ArrayOfIndex& v = mdd.InOut();
-        for (Index s = 0; s < v.nelem(); ++s)
-          if (!ws.is_initialized(mrr.Out()[v[s]]))
-            throw runtime_error("Method " + mdd.Name() +
-                                " needs input variable: " +
-                                Workspace::wsv_data[mrr.Out()[v[s]]].Name());
-      }
+      // Check if all input variables are initialized:
+      for (const Index v : cm.required)
+        if (!ws.is_initialized(v))
+          throw runtime_error("Method " + mdd.Name() +
+                              " needs input variable: " +
+                              Workspace::wsv_data[v].Name());
 
       // Call the getaway function:
-      getaways[mrr.Id()](ws, mrr);
+      cm.getaway(ws, mrr);
 
     } catch (const std::bad_alloc& x) {
       aout1 << "}\n";
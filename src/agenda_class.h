@@ -49,7 +49,8 @@ class Agenda {
         moutput_push(),
         moutput_dup(),
         main_agenda(false),
-        mchecked(false) { /* Nothing to do here */
+        mchecked(false),
+        mprepared() { /* Nothing to do here */
   }
 
   /*! 
@@ -61,11 +62,13 @@ class Agenda {
         moutput_push(x.moutput_push),
         moutput_dup(x.moutput_dup),
         main_agenda(x.main_agenda),
-        mchecked(x.mchecked) { /* Nothing to do here */
+        mchecked(x.mchecked),
+        mprepared(x.mprepared) { /* Nothing to do here */
   }
 
   void append(const String& methodname, const TokVal& keywordvalue);
   void check(Workspace& ws, const Verbosity& verbosity);
+  void prepare();
   void push_back(const MRecord& n);
   void execute(Workspace& ws) const;
   inline void resize(Index n);
@@ -76,6 +79,7 @@ class Agenda {
   void set_methods(const Array<MRecord>& ml) {
     mml = ml;
     mchecked = false;
+    mprepared.resize(0);
   }
   void set_outputs_to_push_and_dup(const Verbosity& verbosity);
   bool is_input(Workspace& ws, Index var) const;
@@ -88,6 +92,7 @@ class Agenda {
   void set_main_agenda() {
     main_agenda = true;
     mchecked = true;
+    prepare();
   }
   bool is_main_agenda() const { return main_agenda; }
   bool checked() const { return mchecked; }
@@ -105,6 +110,20 @@ class Agenda {
 
   /** Flag indicating that the agenda was checked for consistency */
   bool mchecked;
+
+  //! A method of the agenda, prepared for execution.
+  struct PreparedMethod {
+    /** Getaway function of the method. */
+    void (*getaway)(Workspace&, const MRecord&);
+    /** Variables that must be initialized before the call. */
+    ArrayOfIndex required;
+  };
+
+  void prepare_methods(Array<PreparedMethod>& prepared) const;
+
+  /** The methods of mml, prepared by prepare. Emptied by all functions
+      modifying mml. */
+  Array<PreparedMethod> mprepared;
 };
 
 // Documentation with implementation.
@@ -254,7 +273,10 @@ class MRecord {
 /*!
   Resizes the agenda's method list to n elements
  */
-inline void Agenda::resize(Index n) { mml.resize(n); }
+inline void Agenda::resize(Index n) {
+  mml.resize(n);
+  mprepared.resize(0);
+}
 
 //! Return the number of agenda elements.
 /*!  
@@ -274,6 +296,7 @@ inline Index Agenda::nelem() const { return mml.nelem(); }
 inline void Agenda::push_back(const MRecord& n) {
   mml.push_back(n);
   mchecked = false;
+  mprepared.resize(0);
 }
 
 //! Assignment operator.
@@ -286,6 +309,7 @@ inline Agenda& Agenda::operator=(const Agenda& x) {
   moutput_push = x.moutput_push;
   moutput_dup = x.moutput_dup;
   mchecked = x.mchecked;
+  mprepared = x.mprepared;
   return *this;
 }
 
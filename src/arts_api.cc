@@ -634,6 +634,47 @@ const char *set_variable_value(InteractiveWorkspace *workspace,
   return nullptr;
 }
 
+const char *set_variable_value_external(InteractiveWorkspace *workspace,
+                                        long id,
+                                        long group_id,
+                                        VariableValueStruct value) {
+  const String &group = wsv_group_names[group_id];
+  Index rank = 0;
+  if (group == "Vector") {
+    rank = 1;
+  } else if (group == "Matrix") {
+    rank = 2;
+  } else if (group.substr(0, 6) == "Tensor" && group.size() == 7 &&
+             group[6] >= '3' && group[6] <= '7') {
+    rank = group[6] - '0';
+  } else {
+    string_buffer = std::string(
+        "Only Vector, Matrix and Tensor3 to Tensor7 variables can refer to "
+        "external data.");
+    return string_buffer.c_str();
+  }
+
+  if (value.ptr == nullptr) {
+    string_buffer = std::string("Pointer to external data is null.");
+    return string_buffer.c_str();
+  }
+
+  try {
+    Numeric *ptr = const_cast<Numeric *>(
+        reinterpret_cast<const Numeric *>(value.ptr));
+    workspace->adopt_external_variable(id, rank, value.dimensions, ptr);
+  } catch (const std::exception &e) {
+    string_buffer = std::string(e.what());
+    return string_buffer.c_str();
+  }
+  return nullptr;
+}
+
+void release_external_buffer(InteractiveWorkspace *workspace,
+                             const void *ptr) {
+  workspace->release_external(reinterpret_cast<const Numeric *>(ptr));
+}
+
 long add_variable(InteractiveWorkspace *workspace,
                   long group_id,
                   const char *name) {
@@ -611,6 +611,48 @@ const char *set_variable_value(InteractiveWorkspace *workspace,
                                long id,
                                long group_id,
                                VariableValueStruct value);
+
+/** Set WSV to refer to external data without copying.
+ *
+ * For Vector, Matrix and Tensor3 to Tensor7 variables the data pointer of the
+ * VariableValueStruct must point to a contiguous array of double with c-style
+ * memory layout and size given by the corresponding values in the dimension
+ * field of VariableValueStruct. The variable then uses this array as its
+ * storage, so that changes made by ARTS are visible to the caller and
+ * get_variable_value returns the same pointer.
+ *
+ * The array remains owned by the caller. It must be kept alive until it is
+ * released by release_external_buffer. A variable that is resized to other
+ * dimensions, e.g. when set again, detaches from the array and allocates its
+ * own storage. Values of the same size, also results of workspace methods,
+ * are copied to the array.
+ *
+ * @param workspace Pointer to a InteractiveWorkspace object.
+ * @param id Index of the workspace variable.
+ * @param group_id Index of the group the variable belongs to.
+ * @param value VariableValueStruct pointing to the external data.
+ * @return Poiter to null-terminated string containing the error message if setting of
+ * variable fails.
+ */
+DLL_PUBLIC
+const char *set_variable_value_external(InteractiveWorkspace *workspace,
+                                        long id,
+                                        long group_id,
+                                        VariableValueStruct value);
+
+/** Release external data.
+ *
+ * Detaches all variables referring to an array passed to
+ * set_variable_value_external. The variables keep their values, in a copy
+ * owned by the workspace, and the array can be freed after this call.
+ *
+ * @param workspace Pointer to a InteractiveWorkspace object.
+ * @param ptr Pointer to the external data.
+ */
+DLL_PUBLIC
+void release_external_buffer(InteractiveWorkspace *workspace,
+                             const void *ptr);
+
 /** Add variable of given type to workspace.
  *
  * This adds and initializes a variable in the current workspace and also
@@ -32,6 +32,7 @@
 #include <cmath>
 #include "abs_species_tags.h"
 #include "absorption.h"
+#include "arts_omp.h"
 #include "file.h"
 #include "interpolation_poly.h"
 
@@ -226,6 +227,165 @@ void cia_interpolation(VectorView result,
   //    cout << "result_active after: " << result_active << endl;
 }
 
+/** Interpolate CIA data for many temperatures.
+ 
+ Batched version of cia_interpolation. The frequency grid positions and
+ weights are calculated once and reused for all temperatures. The result
+ for each temperature is identical to calling the vector version once per
+ temperature.
+ 
+ \param[out] result       CIA values, dimension [f_grid, temperatures].
+ \param[in] f_grid        Frequency grid.
+ \param[in] temperatures  Temperatures, e.g. one per pressure level.
+ \param[in] cia_data      The CIA dataset to interpolate.
+ \param[in] robust        Set to 1 to suppress runtime errors (and return NAN
+                          values instead for affected temperatures).
+ \param[in] verbosity     Standard verbosity object.
+ */
+void cia_interpolation(MatrixView result,
+                       ConstVectorView f_grid,
+                       ConstVectorView temperatures,
+                       const GriddedField2& cia_data,
+                       const Numeric& T_extrapolfac,
+                       const Index& robust,
+                       const Verbosity& verbosity) {
+  CREATE_OUT3;
+
+  const Index nf = f_grid.nelem();
+  const Index nt = temperatures.nelem();
+
+  // Assert that result matrix has right size:
+  assert(result.nrows() == nf);
+  assert(result.ncols() == nt);
+
+  // Get data grids:
+  ConstVectorView data_f_grid = cia_data.get_numeric_grid(0);
+  ConstVectorView data_T_grid = cia_data.get_numeric_grid(1);
+
+  // Initialize result to zero (important for those frequencies outside the data grid).
+  result = 0;
+
+  if (!nt) return;
+
+  // Find the part of f_grid that is inside data_f_grid, as in the vector
+  // version above.
+  Index i_fstart, i_fstop;
+
+  for (i_fstart = 0; i_fstart < nf; ++i_fstart)
+    if (f_grid[i_fstart] >= data_f_grid[0]) break;
+
+  if (i_fstart == nf) return;
+
+  for (i_fstop = nf - 1; i_fstop >= 0; --i_fstop)
+    if (f_grid[i_fstop] <= data_f_grid[data_f_grid.nelem() - 1]) break;
+
+  if (i_fstop == -1) return;
+
+  const Index f_extent = i_fstop - i_fstart + 1;
+
+  if (out3.sufficient_priority()) {
+    ostringstream os;
+    os << "    " << f_extent << " frequency extraction points starting at "
+       << "frequency index " << i_fstart << ", for " << nt
+       << " temperatures.\n";
+    out3 << os.str();
+  }
+
+  if (f_extent < 1) return;
+
+  ConstVectorView f_grid_active = f_grid[Range(i_fstart, f_extent)];
+
+  const Index f_order = 3;
+
+  if (data_f_grid.nelem() < f_order + 1) {
+    ostringstream os;
+    os << "Not enough frequency grid points in CIA data.\n"
+       << "You have only " << data_f_grid.nelem() << " grid points.\n"
+       << "But need at least " << f_order + 1 << ".";
+    throw runtime_error(os.str());
+  }
+
+  Index T_order;
+  switch (data_T_grid.nelem()) {
+    case 1:
+      T_order = 0;
+      break;
+    case 2:
+      T_order = 1;
+      break;
+    case 3:
+      T_order = 2;
+      break;
+    default:
+      T_order = 3;
+      break;
+  }
+
+  chk_interpolation_grids("Frequency interpolation for CIA continuum",
+                          data_f_grid,
+                          f_grid_active,
+                          f_order);
+
+  // Frequency grid positions and weights, common for all temperatures:
+  ArrayOfGridPosPoly f_gp(f_extent);
+  gridpos_poly(f_gp, data_f_grid, f_grid_active, f_order);
+
+  // Temperature grid positions. Temperatures outside the data range are
+  // flagged and set to NAN if robust, otherwise we throw as the vector
+  // version does.
+  ArrayOfGridPosPoly T_gp(nt);
+  ArrayOfIndex T_ok(nt, 1);
+  for (Index it = 0; it < nt; ++it) {
+    if (T_order > 0) {
+      try {
+        chk_interpolation_grids("Temperature interpolation for CIA continuum",
+                                data_T_grid,
+                                temperatures[it],
+                                T_order,
+                                T_extrapolfac);
+      } catch (const std::runtime_error& e) {
+        if (robust) {
+          T_ok[it] = 0;
+          continue;
+        } else {
+          throw runtime_error(e.what());
+        }
+      }
+      gridpos_poly(
+          T_gp[it], data_T_grid, temperatures[it], T_order, T_extrapolfac);
+    } else {
+      T_gp[it].idx.resize(1);
+      T_gp[it].idx[0] = 0;
+      T_gp[it].w.resize(1);
+      T_gp[it].w[0] = 1;
+    }
+  }
+
+  const Matrix& data = cia_data.data;
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && nt > 1)
+  for (Index it = 0; it < nt; ++it) {
+    VectorView result_active = result(Range(i_fstart, f_extent), it);
+
+    if (!T_ok[it]) {
+      result_active = NAN;
+      continue;
+    }
+
+    const GridPosPoly& tgp = T_gp[it];
+    for (Index iv = 0; iv < f_extent; ++iv) {
+      const GridPosPoly& fgp = f_gp[iv];
+      Numeric x = 0;
+      for (Index a = 0; a < fgp.idx.nelem(); ++a)
+        for (Index b = 0; b < tgp.idx.nelem(); ++b)
+          x += fgp.w[a] * tgp.w[b] * data(fgp.idx[a], tgp.idx[b]);
+
+      // Set negative values to zero, as in the vector version.
+      result_active[iv] = x < 0 ? 0 : x;
+    }
+  }
+}
+
 /** Get the index in cia_data for the two given species.
  
  \param[in] cia_data CIA data array
@@ -273,6 +433,31 @@ void CIARecord::Extract(VectorView result,
       result, f_grid, temperature, this_cia, T_extrapolfac, robust, verbosity);
 }
 
+// Documentation in header file.
+void CIARecord::Extract(MatrixView result,
+                        ConstVectorView f_grid,
+                        ConstVectorView temperatures,
+                        const Index& dataset,
+                        const Numeric& T_extrapolfac,
+                        const Index& robust,
+                        const Verbosity& verbosity) const {
+  if (dataset >= mdata.nelem()) {
+    ostringstream os;
+    os << "There are only " << mdata.nelem() << " datasets in this CIA file.\n"
+       << "But you are trying to use dataset " << dataset
+       << ". (Zero-based indexing.)";
+    throw runtime_error(os.str());
+  }
+
+  cia_interpolation(result,
+                    f_grid,
+                    temperatures,
+                    mdata[dataset],
+                    T_extrapolfac,
+                    robust,
+                    verbosity);
+}
+
 // Documentation in header file.
 String CIARecord::MoleculeName(const Index i) const {
   // Assert that i is 0 or 1:
@@ -52,6 +52,14 @@ void cia_interpolation(VectorView result,
                        const Index& robust,
                        const Verbosity& verbosity);
 
+void cia_interpolation(MatrixView result,
+                       ConstVectorView frequency,
+                       ConstVectorView temperatures,
+                       const GriddedField2& cia_data,
+                       const Numeric& T_extrapolfac,
+                       const Index& robust,
+                       const Verbosity& verbosity);
+
 Index cia_get_index(const ArrayOfCIARecord& cia_data,
                     const Index sp1,
                     const Index sp2);
@@ -169,6 +177,27 @@ class CIARecord {
                const Index& robust,
                const Verbosity& verbosity) const;
 
+  /** Matrix version of extract.
+
+     As the vector version, but for many temperatures at once. The frequency
+     interpolation is only set up once, which makes this the preferred
+     version when extracting for all levels of an atmosphere.
+     
+     \param[out] result CIA values, dimension [f_grid, temperatures].
+     \param[in] f_grid Frequency grid.
+     \param[in] temperatures Temperatures.
+     \param[in] dataset Index of dataset to use.
+     \param[in] robust      Set to 1 to suppress runtime errors (and return NAN values instead).
+     \param[in] verbosity   Standard verbosity object.
+     */
+  void Extract(MatrixView result,
+               ConstVectorView f_grid,
+               ConstVectorView temperatures,
+               const Index& dataset,
+               const Numeric& T_extrapolfac,
+               const Index& robust,
+               const Verbosity& verbosity) const;
+
   /** Scalar version of extract.
      
      Use the vector version, if you can, it is more efficient. This is just a 
@@ -24,14 +24,236 @@
   \brief  Implementation of CovarianceMatrix class.
 */
 
+#include <algorithm>
+#include <map>
 #include <queue>
 #include <tuple>
 #include <utility>
 #include <vector>
 
+#include "Eigen/OrderingMethods"
+#include "Eigen/SparseCholesky"
 #include "covariance_matrix.h"
 #include "lapack.h"
 
+//------------------------------------------------------------------------------
+// Sparse LDLT Factorization
+//------------------------------------------------------------------------------
+/*! Sparse LDLT factorization of a set of correlated blocks.
+ *
+ * The blocks are assembled into a continuous sparse matrix, ordered by
+ * retrieval quantity index, which is factorized using the approximate
+ * minimum degree ordering to limit the fill-in. As for the dense inversion,
+ * only the upper triangle of diagonal blocks is used.
+ *
+ * The inverse is never formed, except when explicitly requested by
+ * add_inverse. All other operations solve the linear system for the rows
+ * (or columns) of the covariance matrix covered by the blocks.
+ */
+class SparseLDLT {
+ public:
+  SparseLDLT(const std::vector<const Block *> &blocks);
+
+  /*! Whether the block with the given indices is covered. */
+  bool covers(IndexPair indices) const;
+
+  /*! Add A^{-1} v to w. */
+  void add_solve(VectorView w, ConstVectorView v) const;
+
+  /*! Add A^{-1} B to C. */
+  void add_solve(MatrixView C, ConstMatrixView B) const;
+
+  /*! Add B A^{-1} to C. */
+  void add_solve_right(MatrixView C, ConstMatrixView B) const;
+
+  /*! Add the explicit inverse to the covered part of A. */
+  void add_inverse(MatrixView A) const;
+
+  /*! Set the covered elements of d to the diagonal of the inverse. */
+  void inverse_diagonal(VectorView d) const;
+
+  /*! Size of the factorized matrix. */
+  Index size() const { return n_; }
+
+  /*! Number of non-zero elements of the factor L. */
+  Index nnz() const;
+
+  /*! Approximate memory used by the factorization in bytes. */
+  Index memory() const;
+
+ private:
+  using Factorization = Eigen::SimplicialLDLT<Eigen::SparseMatrix<Numeric>,
+                                              Eigen::Upper,
+                                              Eigen::AMDOrdering<int>>;
+
+  /*! Copy the covered rows of B into a continuous matrix. */
+  Eigen::MatrixXd gather_rows(ConstMatrixView B) const;
+
+  /*! Add the rows of X to the covered rows of C. */
+  void scatter_rows(MatrixView C, const Eigen::MatrixXd &X) const;
+
+  Index n_ = 0;
+  std::vector<Index> block_indices_{};
+  std::vector<Range> ranges_{};
+  std::vector<Index> starts_{};
+  Factorization ldlt_{};
+};
+
+SparseLDLT::SparseLDLT(const std::vector<const Block *> &blocks) {
+  std::map<Index, Index> block_start_cont{};
+
+  for (const Block *b : blocks) {
+    Index ci, cj;
+    std::tie(ci, cj) = b->get_indices();
+    if (ci == cj) {
+      block_start_cont.insert(std::make_pair(ci, n_));
+      block_indices_.push_back(ci);
+      ranges_.push_back(b->get_row_range());
+      starts_.push_back(n_);
+      n_ += b->nrows();
+    }
+  }
+
+  std::vector<Eigen::Triplet<Numeric>> triplets{};
+  for (const Block *b : blocks) {
+    Index ci, cj;
+    std::tie(ci, cj) = b->get_indices();
+    const Index row_offset = block_start_cont[ci];
+    const Index column_offset = block_start_cont[cj];
+
+    Vector values;
+    ArrayOfIndex row_indices, column_indices;
+    b->get_sparse().list_elements(values, row_indices, column_indices);
+    triplets.reserve(triplets.size() + values.nelem());
+    for (Index k = 0; k < values.nelem(); ++k) {
+      const Index r = row_offset + row_indices[k];
+      const Index c = column_offset + column_indices[k];
+      if (r <= c) {
+        triplets.emplace_back(
+            static_cast<int>(r), static_cast<int>(c), values[k]);
+      }
+    }
+  }
+
+  Eigen::SparseMatrix<Numeric> A(n_, n_);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  ldlt_.compute(A);
+
+  if (ldlt_.info() != Eigen::Success) {
+    throw std::runtime_error(
+        "Error factorizing sparse block of covariance matrix. "
+        "Make sure that it is symmetric, positive definite "
+        "or provide the inverse manually.");
+  }
+}
+
+bool SparseLDLT::covers(IndexPair indices) const {
+  auto has = [this](Index i) {
+    return std::find(block_indices_.begin(), block_indices_.end(), i) !=
+           block_indices_.end();
+  };
+  return has(indices.first) && has(indices.second);
+}
+
+Eigen::MatrixXd SparseLDLT::gather_rows(ConstMatrixView B) const {
+  Eigen::MatrixXd X(n_, B.ncols());
+  for (size_t k = 0; k < ranges_.size(); ++k) {
+    const Index start = ranges_[k].get_start();
+    for (Index i = 0; i < ranges_[k].get_extent(); ++i) {
+      for (Index j = 0; j < B.ncols(); ++j) {
+        X(starts_[k] + i, j) = B(start + i, j);
+      }
+    }
+  }
+  return X;
+}
+
+void SparseLDLT::scatter_rows(MatrixView C, const Eigen::MatrixXd &X) const {
+  for (size_t k = 0; k < ranges_.size(); ++k) {
+    const Index start = ranges_[k].get_start();
+    for (Index i = 0; i < ranges_[k].get_extent(); ++i) {
+      for (Index j = 0; j < C.ncols(); ++j) {
+        C(start + i, j) += X(starts_[k] + i, j);
+      }
+    }
+  }
+}
+
+void SparseLDLT::add_solve(VectorView w, ConstVectorView v) const {
+  Eigen::VectorXd x(n_);
+  for (size_t k = 0; k < ranges_.size(); ++k) {
+    const Index start = ranges_[k].get_start();
+    for (Index i = 0; i < ranges_[k].get_extent(); ++i) {
+      x[starts_[k] + i] = v[start + i];
+    }
+  }
+  x = ldlt_.solve(x);
+  for (size_t k = 0; k < ranges_.size(); ++k) {
+    const Index start = ranges_[k].get_start();
+    for (Index i = 0; i < ranges_[k].get_extent(); ++i) {
+      w[start + i] += x[starts_[k] + i];
+    }
+  }
+}
+
+void SparseLDLT::add_solve(MatrixView C, ConstMatrixView B) const {
+  scatter_rows(C, ldlt_.solve(gather_rows(B)));
+}
+
+void SparseLDLT::add_solve_right(MatrixView C, ConstMatrixView B) const {
+  // The matrix is symmetric, so B A^{-1} = (A^{-1} B^T)^T.
+  scatter_rows(transpose(C), ldlt_.solve(gather_rows(transpose(B))));
+}
+
+void SparseLDLT::add_inverse(MatrixView A) const {
+  Eigen::MatrixXd X = ldlt_.solve(Eigen::MatrixXd::Identity(n_, n_));
+  for (size_t k = 0; k < ranges_.size(); ++k) {
+    for (size_t l = 0; l < ranges_.size(); ++l) {
+      MatrixView A_view = A(ranges_[k], ranges_[l]);
+      for (Index i = 0; i < ranges_[k].get_extent(); ++i) {
+        for (Index j = 0; j < ranges_[l].get_extent(); ++j) {
+          A_view(i, j) += X(starts_[k] + i, starts_[l] + j);
+        }
+      }
+    }
+  }
+}
+
+void SparseLDLT::inverse_diagonal(VectorView d) const {
+  // Solve for a limited number of unit vectors at a time to bound the
+  // memory needed for large blocks.
+  const Index chunk = 64;
+  Eigen::VectorXd diag(n_);
+  for (Index c0 = 0; c0 < n_; c0 += chunk) {
+    const Index nc = std::min(chunk, n_ - c0);
+    Eigen::MatrixXd E = Eigen::MatrixXd::Zero(n_, nc);
+    for (Index j = 0; j < nc; ++j) {
+      E(c0 + j, j) = 1.0;
+    }
+    Eigen::MatrixXd X = ldlt_.solve(E);
+    for (Index j = 0; j < nc; ++j) {
+      diag[c0 + j] = X(c0 + j, j);
+    }
+  }
+  for (size_t k = 0; k < ranges_.size(); ++k) {
+    const Index start = ranges_[k].get_start();
+    for (Index i = 0; i < ranges_[k].get_extent(); ++i) {
+      d[start + i] = diag[starts_[k] + i];
+    }
+  }
+}
+
+Index SparseLDLT::nnz() const {
+  return ldlt_.matrixL().nestedExpression().nonZeros();
+}
+
+Index SparseLDLT::memory() const {
+  // Values and inner indices of L, outer indices, D and the permutation.
+  return nnz() * static_cast<Index>(sizeof(Numeric) + sizeof(int)) +
+         (n_ + 1) * static_cast<Index>(sizeof(int)) +
+         n_ * static_cast<Index>(sizeof(Numeric) + 2 * sizeof(int));
+}
+
 //------------------------------------------------------------------------------
 // Correlations
 //------------------------------------------------------------------------------
@@ -193,6 +415,9 @@ Matrix CovarianceMatrix::get_inverse() const {
       }
     }
   }
+  for (const auto &f : factorizations_) {
+    f->add_inverse(A);
+  }
   return A;
 }
 
@@ -341,9 +566,30 @@ bool CovarianceMatrix::has_inverse(IndexPair indices) const {
       return true;
     }
   }
+  for (const auto &f : factorizations_) {
+    if (f->covers(indices)) {
+      return true;
+    }
+  }
   return false;
 }
 
+Index CovarianceMatrix::inverse_memory() const {
+  Index bytes = 0;
+  for (const Block &b : inverses_) {
+    if (b.get_matrix_type() == Block::MatrixType::dense) {
+      bytes += b.nrows() * b.ncols() * static_cast<Index>(sizeof(Numeric));
+    } else {
+      bytes += b.get_sparse().nnz() *
+               static_cast<Index>(sizeof(Numeric) + sizeof(int));
+    }
+  }
+  for (const auto &f : factorizations_) {
+    bytes += f->memory();
+  }
+  return bytes;
+}
+
 void CovarianceMatrix::generate_blocks(
     std::vector<std::vector<const Block *>> &corr_blocks) const {
   for (size_t i = 0; i < correlations_.size(); i++) {
@@ -416,6 +662,16 @@ void CovarianceMatrix::invert_correlation_block(
   };
   if (std::all_of(blocks.begin(), blocks.end(), block_has_inverse)) return;
 
+  // Sparse blocks are factorized, the inverse of a sparse matrix is in
+  // general dense.
+  auto block_is_sparse = [](const Block *a) {
+    return a->get_matrix_type() == Block::MatrixType::sparse;
+  };
+  if (std::all_of(blocks.begin(), blocks.end(), block_is_sparse)) {
+    factorizations_.push_back(std::make_shared<const SparseLDLT>(blocks));
+    return;
+  }
+
   // Otherwise go on to precompute the inverse of a block consisting
   // of correlations between multiple retrieval quantities.
 
@@ -538,6 +794,9 @@ Vector CovarianceMatrix::inverse_diagonal() const {
       diag[b.get_row_range()] = b.diagonal();
     }
   }
+  for (const auto &f : factorizations_) {
+    f->inverse_diagonal(diag);
+  }
   return diag;
 }
 
@@ -579,6 +838,9 @@ void mult_inv(MatrixView C, ConstMatrixView A, const CovarianceMatrix &B) {
     mult(T, A, c);
     C += T;
   }
+  for (const auto &f : B.factorizations_) {
+    f->add_solve_right(C, A);
+  }
 }
 
 void mult_inv(MatrixView C, const CovarianceMatrix &A, ConstMatrixView B) {
@@ -589,6 +851,9 @@ void mult_inv(MatrixView C, const CovarianceMatrix &A, ConstMatrixView B) {
     mult(T, c, B);
     C += T;
   }
+  for (const auto &f : A.factorizations_) {
+    f->add_solve(C, B);
+  }
 }
 
 void solve(VectorView w, const CovarianceMatrix &A, ConstVectorView v) {
@@ -599,6 +864,9 @@ void solve(VectorView w, const CovarianceMatrix &A, ConstVectorView v) {
     mult(t, c, v);
     w += t;
   }
+  for (const auto &f : A.factorizations_) {
+    f->add_solve(w, v);
+  }
 }
 
 MatrixView &operator+=(MatrixView &A, const CovarianceMatrix &B) {
@@ -612,6 +880,9 @@ void add_inv(MatrixView A, const CovarianceMatrix &B) {
   for (const Block &c : B.inverses_) {
     A += c;
   }
+  for (const auto &f : B.factorizations_) {
+    f->add_inverse(A);
+  }
 }
 
 std::ostream &operator<<(std::ostream &os, const CovarianceMatrix &covmat) {
@@ -629,5 +900,10 @@ std::ostream &operator<<(std::ostream &os, const CovarianceMatrix &covmat) {
        << (covmat.has_inverse(std::make_pair(i, j)) ? "yes" : "no");
     os << std::endl;
   }
+  for (const auto &f : covmat.factorizations_) {
+    os << "Sparse LDLT factorization: " << f->size() << " x " << f->size()
+       << ", non-zeros in L: " << f->nnz() << ", memory: " << f->memory()
+       << " bytes" << std::endl;
+  }
   return os;
 }
@@ -40,6 +40,7 @@
 #include "matpackII.h"
 
 class CovarianceMatrix;
+class SparseLDLT;
 
 //------------------------------------------------------------------------------
 // Type Aliases
@@ -222,6 +223,11 @@ void add_inv(MatrixView A, const Block &);
  * mult_inv methods that multiply the inverse of the covariance matrix by a given
  * vector or matrix. This, however, requires previously having computed the inverse
  * of the matrix using the compute_inverse method.
+ *
+ * Sets of correlated blocks that are all sparse are not inverted explicitly.
+ * Instead, a sparse LDLT factorization with fill-reducing ordering is
+ * computed, and the mult_inv and solve functions solve the corresponding
+ * linear systems.
  */
 class CovarianceMatrix {
  public:
@@ -325,9 +331,19 @@ class CovarianceMatrix {
      * Compute the inverse of this correlation matrix. This function must be executed
      * after all block have been added to the covariance matrix and before any of the
      * mult_inv or add_inv methods is used.
+     *
+     * Sets of correlated blocks that only consist of sparse blocks are
+     * factorized instead, see SparseLDLT.
      */
   void compute_inverse() const;
 
+  /** Memory used by the inverse.
+     *
+     * @return The number of bytes used by the blocks of the inverse and the
+     * sparse factorizations.
+     */
+  Index inverse_memory() const;
+
   /** Add block to covariance matrix.
      *
      * This function add a given block to the covariance matrix.
@@ -398,6 +414,7 @@ class CovarianceMatrix {
 
   std::vector<Block> correlations_;
   mutable std::vector<Block> inverses_;
+  mutable std::vector<std::shared_ptr<const SparseLDLT>> factorizations_;
 };
 
 void mult(MatrixView, ConstMatrixView, const CovarianceMatrix &);
@@ -31,6 +31,7 @@
 #include <stdexcept>
 #include "agenda_class.h"
 #include "array.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
 
@@ -643,16 +644,17 @@ void c_errmsg(const char* messag, int type) {
     arts_exit(1);
   }
 
-  if (warning_limit) return;
-
-  if (++num_warnings <= MAX_WARNINGS) {
-    CREATE_OUT1;
-    out1 << "  ******* WARNING >>>>>>  " << messag << "\n";
-  } else {
-    CREATE_OUT1;
-    out1 << "  >>>>>>  TOO MANY WARNING MESSAGES --  They will no longer be "
-            "printed  <<<<<<<\n\n";
-    warning_limit = TRUE;
+#pragma omp critical(c_errmsg_warning)
+  if (!warning_limit) {
+    if (++num_warnings <= MAX_WARNINGS) {
+      CREATE_OUT1;
+      out1 << "  ******* WARNING >>>>>>  " << messag << "\n";
+    } else {
+      CREATE_OUT1;
+      out1 << "  >>>>>>  TOO MANY WARNING MESSAGES --  They will no longer be "
+              "printed  <<<<<<<\n\n";
+      warning_limit = TRUE;
+    }
   }
 
   return;
@@ -665,12 +667,14 @@ int c_write_bad_var(int quiet, const char* varnam) {
   const int maxmsg = 50;
   static int nummsg = 0;
 
-  nummsg++;
+  int l_nummsg;
+#pragma omp critical(c_write_bad_var_nummsg)
+  l_nummsg = ++nummsg;
   if (quiet != QUIET) {
     Verbosity verbosity = disort_verbosity;
     CREATE_OUT1;
     out1 << "  ****  Input variable " << varnam << " in error  ****\n";
-    if (nummsg == maxmsg) {
+    if (l_nummsg == maxmsg) {
       c_errmsg("Too many input errors.  Aborting...", DS_ERROR);
     }
   }
@@ -806,116 +810,137 @@ void run_cdisort(Workspace& ws,
                 pnd_profiles,
                 cloudbox_limits);
 
-  disort_state ds;
-  disort_output out;
-
   if (quiet == 0)
     disort_verbosity = verbosity;
   else
     disort_verbosity = Verbosity(0, 0, 0);
+  // disort_verbosity is thread_local, this copy is used to set it in the
+  // worker threads
+  const Verbosity cdisort_verbosity = disort_verbosity;
 
   const Index nf = f_grid.nelem();
+  const int nlyr = static_cast<int>(p.nelem() - 1);
+  const Index Nlegendre = nstreams + 1;
 
-  ds.accur = 0.005;
-  ds.flag.prnt[0] = FALSE;
-  ds.flag.prnt[1] = FALSE;
-  ds.flag.prnt[2] = FALSE;
-  ds.flag.prnt[3] = FALSE;
-  ds.flag.prnt[4] = TRUE;
-
-  ds.flag.usrtau = FALSE;
-  ds.flag.usrang = TRUE;
-  ds.flag.spher = FALSE;
-  ds.flag.general_source = FALSE;
-  ds.flag.output_uum = FALSE;
-
-  ds.nlyr = static_cast<int>(p.nelem() - 1);
-
-  ds.flag.brdf_type = BRDF_NONE;
-
-  ds.flag.ibcnd = GENERAL_BC;
-  ds.flag.usrang = TRUE;
-  ds.flag.planck = TRUE;
-  ds.flag.onlyfl = FALSE;
-  ds.flag.lamber = TRUE;
-  ds.flag.quiet = FALSE;
-  ds.flag.intensity_correction = TRUE;
-  ds.flag.old_intensity_correction = TRUE;
-
-  ds.nstr = static_cast<int>(nstreams);
-  ds.nphase = ds.nstr;
-  ds.nmom = ds.nstr;
-  //ds.ntau = ds.nlyr + 1;   // With ds.flag.usrtau = FALSE; set by cdisort
-  ds.numu = static_cast<int>(za_grid.nelem());
-  ds.nphi = 1;
-  Index Nlegendre = nstreams + 1;
-
-  /* Allocate memory */
-  c_disort_state_alloc(&ds);
-  c_disort_out_alloc(&ds, &out);
-
-  // Properties of solar beam, set to zero as they are not needed
-  ds.bc.fbeam = 0.;
-  ds.bc.umu0 = 0.;
-  ds.bc.phi0 = 0.;
-  ds.bc.fluor = 0.;
-
-  // Since we have no solar source there is no angular dependance
-  ds.phi[0] = 0.;
-
-  for (Index i = 0; i <= ds.nlyr; i++) ds.temper[i] = t[ds.nlyr - i];
-
-  Matrix ext_bulk_gas(nf, ds.nlyr + 1);
+  //
+  // Optical properties, calculated for all frequencies before running
+  // the solver
+  //
+  Matrix ext_bulk_gas(nf, nlyr + 1);
   get_gasoptprop(ws, ext_bulk_gas, propmat_clearsky_agenda, t, vmr, p, f_grid);
-  Matrix ext_bulk_par(nf, ds.nlyr + 1), abs_bulk_par(nf, ds.nlyr + 1);
+  Matrix ext_bulk_par(nf, nlyr + 1), abs_bulk_par(nf, nlyr + 1);
   get_paroptprop(
       ext_bulk_par, abs_bulk_par, scat_data, pnd, t, p, cboxlims, f_grid);
 
   // Optical depth of layers
-  Matrix dtauc(nf, ds.nlyr);
+  Matrix dtauc(nf, nlyr);
   // Single scattering albedo of layers
-  Matrix ssalb(nf, ds.nlyr);
+  Matrix ssalb(nf, nlyr);
   get_dtauc_ssalb(dtauc, ssalb, ext_bulk_gas, ext_bulk_par, abs_bulk_par, z);
 
-  // Transform to mu, starting with negative values
-  for (Index i = 0; i < ds.numu; i++) ds.umu[i] = -cos(za_grid[i] * PI / 180);
-
-  //upper boundary conditions:
-  // DISORT offers isotropic incoming radiance or emissivity-scaled planck
-  // emission. Both are applied additively.
-  // We want to have cosmic background radiation, for which ttemp=COSMIC_BG_TEMP
-  // and temis=1 should give identical results to fisot(COSMIC_BG_TEMP). As they
-  // are additive we should use either the one or the other.
-  // Note: previous setup (using fisot) setting temis=0 should be avoided.
-  // Generally, temis!=1 should be avoided since that technically implies a
-  // reflective upper boundary (though it seems that this is not exploited in
-  // DISORT1.2, which we so far use).
-
-  // Cosmic background
-  // we use temis*ttemp as upper boundary specification, hence CBR set to 0.
-  ds.bc.fisot = 0;
-
-  // Top of the atmosphere temperature and emissivity
-  ds.bc.ttemp = COSMIC_BG_TEMP;
-  ds.bc.btemp = surface_skin_t;
-  ds.bc.temis = 1.;
-
   Vector pfct_angs;
   get_angs(pfct_angs, scat_data, Npfct);
   Index nang = pfct_angs.nelem();
 
   Index nf_ssd = scat_data[0][0].f_grid.nelem();
-  Tensor3 pha_bulk_par(nf_ssd, ds.nlyr + 1, nang);
+  Tensor3 pha_bulk_par(nf_ssd, nlyr + 1, nang);
   get_parZ(pha_bulk_par, scat_data, pnd, t, pfct_angs, cboxlims);
-  Tensor3 pfct_bulk_par(nf_ssd, ds.nlyr, nang);
+  Tensor3 pfct_bulk_par(nf_ssd, nlyr, nang);
   get_pfct(pfct_bulk_par, pha_bulk_par, ext_bulk_par, abs_bulk_par, cboxlims);
 
   // Legendre polynomials of phase function
-  Tensor3 pmom(nf_ssd, ds.nlyr, Nlegendre, 0.);
+  Tensor3 pmom(nf_ssd, nlyr, Nlegendre, 0.);
   get_pmom(pmom, pfct_bulk_par, pfct_angs, Nlegendre);
 
-  for (Index f_index = 0; f_index < f_grid.nelem(); f_index++) {
-    sprintf(ds.header, "ARTS Calc f_index = %ld", f_index);
+  //
+  // Solver state. Each thread has its own disort_state and disort_output.
+  //
+  auto init_cdisort = [&](disort_state& ds, disort_output& out) {
+    ds.accur = 0.005;
+    ds.flag.prnt[0] = FALSE;
+    ds.flag.prnt[1] = FALSE;
+    ds.flag.prnt[2] = FALSE;
+    ds.flag.prnt[3] = FALSE;
+    ds.flag.prnt[4] = TRUE;
+
+    ds.flag.usrtau = FALSE;
+    ds.flag.usrang = TRUE;
+    ds.flag.spher = FALSE;
+    ds.flag.general_source = FALSE;
+    ds.flag.output_uum = FALSE;
+
+    ds.nlyr = nlyr;
+
+    ds.flag.brdf_type = BRDF_NONE;
+
+    ds.flag.ibcnd = GENERAL_BC;
+    ds.flag.usrang = TRUE;
+    ds.flag.planck = TRUE;
+    ds.flag.onlyfl = FALSE;
+    ds.flag.lamber = TRUE;
+    ds.flag.quiet = FALSE;
+    ds.flag.intensity_correction = TRUE;
+    ds.flag.old_intensity_correction = TRUE;
+
+    ds.nstr = static_cast<int>(nstreams);
+    ds.nphase = ds.nstr;
+    ds.nmom = ds.nstr;
+    //ds.ntau = ds.nlyr + 1;   // With ds.flag.usrtau = FALSE; set by cdisort
+    ds.numu = static_cast<int>(za_grid.nelem());
+    ds.nphi = 1;
+
+    /* Allocate memory */
+    c_disort_state_alloc(&ds);
+    c_disort_out_alloc(&ds, &out);
+
+    // Properties of solar beam, set to zero as they are not needed
+    ds.bc.fbeam = 0.;
+    ds.bc.umu0 = 0.;
+    ds.bc.phi0 = 0.;
+    ds.bc.fluor = 0.;
+
+    // Since we have no solar source there is no angular dependance
+    ds.phi[0] = 0.;
+
+    for (Index i = 0; i <= ds.nlyr; i++) ds.temper[i] = t[ds.nlyr - i];
+
+    // Transform to mu, starting with negative values
+    for (Index i = 0; i < ds.numu; i++)
+      ds.umu[i] = -cos(za_grid[i] * PI / 180);
+
+    //upper boundary conditions:
+    // DISORT offers isotropic incoming radiance or emissivity-scaled planck
+    // emission. Both are applied additively.
+    // We want to have cosmic background radiation, for which ttemp=COSMIC_BG_TEMP
+    // and temis=1 should give identical results to fisot(COSMIC_BG_TEMP). As they
+    // are additive we should use either the one or the other.
+    // Note: previous setup (using fisot) setting temis=0 should be avoided.
+    // Generally, temis!=1 should be avoided since that technically implies a
+    // reflective upper boundary (though it seems that this is not exploited in
+    // DISORT1.2, which we so far use).
+
+    // Cosmic background
+    // we use temis*ttemp as upper boundary specification, hence CBR set to 0.
+    ds.bc.fisot = 0;
+
+    // Top of the atmosphere temperature and emissivity
+    ds.bc.ttemp = COSMIC_BG_TEMP;
+    ds.bc.btemp = surface_skin_t;
+    ds.bc.temis = 1.;
+  };
+
+  auto free_cdisort = [](disort_state& ds, disort_output& out) {
+    /* Free allocated memory */
+    c_disort_out_free(&ds, &out);
+    c_disort_state_free(&ds);
+  };
+
+  // Runs the solver for one frequency and stores the result directly in
+  // cloudbox_field
+  auto run_frequency = [&](disort_state& ds,
+                           disort_output& out,
+                           const Index f_index) {
+    snprintf(ds.header, sizeof(ds.header), "ARTS Calc f_index = %ld", f_index);
 
     std::memcpy(ds.dtauc,
                 dtauc(f_index, joker).get_c_array(),
@@ -950,11 +975,37 @@ void run_cdisort(Workspace& ws,
             cloudbox_field(f_index, k + 1, 0, 0, j, 0, 0);
       }
     }
+  };
+
+  if (!nf) return;
+
+  // c_disort runs a self-test and fills some internal static tables at its
+  // first call. The first frequency is therefore done before going
+  // parallel. Its call counter is thread-local, and is only used for
+  // BRDF surfaces, which are not set up here (ds.flag.lamber is TRUE).
+  {
+    disort_state ds;
+    disort_output out;
+    init_cdisort(ds, out);
+    run_frequency(ds, out, 0);
+    free_cdisort(ds, out);
   }
 
-  /* Free allocated memory */
-  c_disort_out_free(&ds, &out);
-  c_disort_state_free(&ds);
+#pragma omp parallel if (!arts_omp_in_parallel() && nf > 2)
+  {
+    disort_verbosity = cdisort_verbosity;
+
+    disort_state ds;
+    disort_output out;
+    init_cdisort(ds, out);
+
+#pragma omp for schedule(dynamic)
+    for (Index f_index = 1; f_index < nf; f_index++) {
+      run_frequency(ds, out, f_index);
+    }
+
+    free_cdisort(ds, out);
+  }
 }
 
 void surf_albedoCalc(Workspace& ws,
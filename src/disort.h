@@ -119,6 +119,10 @@ void get_disortsurf_props(  // Output
  *
  * This version uses the C implementation of Disort based on ::run_disort.
  *
+ * The optical properties are calculated for all frequencies before the
+ * solver is run. The frequencies are then handled in parallel, where each
+ * thread has its own cdisort state and output buffers.
+ *
  * Altitudes, temperatures, VMRs and PNDs shall be provided with lat and lon
  * dimensions removed
  *
@@ -33,6 +33,8 @@
 
 #include <cmath>
 #include <stdexcept>
+#include "fastem.h"
+#include "arts_omp.h"
 #include "complex.h"
 #include "exceptions.h"
 #include "matpackI.h"
@@ -130,3 +132,113 @@ void fastem(  // Output:
                  transmittance,
                  rel_azimuth);
 }
+
+//! Calculate the surface emissivity using FASTEM, for many cases
+/*!
+  As fastem, for all frequencies and zenith angles of a set of surface
+  points. The points are given by their temperature, salinity, wind speed
+  and relative azimuth. The evaluations are done in parallel, the FASTEM
+  code keeps no state between calls.
+
+  \param[out] emissivity      Calculated surface emissivity, with
+                                dimensions [point, za, frequency, 4].
+  \param[out] reflectivity    Calculated surface reflectivity, with the
+                                same dimensions.
+  \param[in]  f_grid          Frequencies [Hz]
+  \param[in]  za              Zenith angles of line-of-sight
+  \param[in]  temperature     Temperature of each point
+  \param[in]  salinity        Salinity [0-1] of each point
+  \param[in]  wind_speed      Wind speed of each point
+  \param[in]  transmittance   Transmittance along downwelling direction,
+                                [point, za, frequency].
+  \param[in]  rel_azimuth     Relative azimuth angle of each point
+  \param[in]  fastem_version  FASTEM version
+*/
+void fastem_batch(  // Output:
+    Tensor4& emissivity,
+    Tensor4& reflectivity,
+    // Input:
+    ConstVectorView f_grid,
+    ConstVectorView za,
+    ConstVectorView temperature,
+    ConstVectorView salinity,
+    ConstVectorView wind_speed,
+    ConstTensor3View transmittance,
+    ConstVectorView rel_azimuth,
+    const Index fastem_version) {
+  const Index np = temperature.nelem();
+  const Index nza = za.nelem();
+  const Index nf = f_grid.nelem();
+
+  assert(salinity.nelem() == np);
+  assert(wind_speed.nelem() == np);
+  assert(rel_azimuth.nelem() == np);
+  assert(transmittance.npages() == np);
+  assert(transmittance.nrows() == nza);
+  assert(transmittance.ncols() == nf);
+
+#ifndef ENABLE_FASTEM
+  // Fail here rather than inside the parallel region
+  if (np * nza * nf > 0)
+    throw std::runtime_error(
+        "This version of ARTS was compiled without FASTEM support.");
+#endif
+
+  emissivity.resize(np, nza, nf, 4);
+  reflectivity.resize(np, nza, nf, 4);
+
+  const Index n = np * nza;
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && n > 1)
+  for (Index i = 0; i < n; i++) {
+    const Index ip = i / nza;
+    const Index iza = i % nza;
+    for (Index iv = 0; iv < nf; iv++) {
+      rttov_fastem5_(fastem_version,
+                     f_grid[iv] / 1e9,
+                     180 - za[iza],
+                     temperature[ip],
+                     salinity[ip] * 1e3,
+                     wind_speed[ip],
+                     &emissivity(ip, iza, iv, 0),
+                     &reflectivity(ip, iza, iv, 0),
+                     transmittance(ip, iza, iv),
+                     rel_azimuth[ip]);
+    }
+  }
+}
+
+//! Limits FASTEM emissivities and reflectivities to [0,1]
+/*!
+  FASTEM does not work close to the horizon (at least v6). Make sure values
+  are inside [0,1]. Then seems best to make sure that e+r=1. Only the first
+  two values of each frequency are considered.
+
+  \param[in,out] emissivity    Emissivity, one row per frequency.
+  \param[in,out] reflectivity  Reflectivity, one row per frequency.
+*/
+void fastem_clip(  // Input and output:
+    MatrixView emissivity,
+    MatrixView reflectivity) {
+  const Index nf = emissivity.nrows();
+  for (Index i = 0; i < nf; i++) {
+    for (Index s = 0; s < 2; s++) {
+      if (emissivity(i, s) > 1) {
+        emissivity(i, s) = 1;
+        reflectivity(i, s) = 0;
+      }
+      if (emissivity(i, s) < 0) {
+        emissivity(i, s) = 0;
+        reflectivity(i, s) = 1;
+      }
+      if (reflectivity(i, s) > 1) {
+        emissivity(i, s) = 0;
+        reflectivity(i, s) = 1;
+      }
+      if (reflectivity(i, s) < 0) {
+        emissivity(i, s) = 1;
+        reflectivity(i, s) = 0;
+      }
+    }
+  }
+}
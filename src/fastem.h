@@ -30,7 +30,7 @@
 #ifndef fastem_h
 #define fastem_h
 
-#include "matpackI.h"
+#include "matpackIV.h"
 
 void fastem(  // Output:
     Vector &emissivity,
@@ -45,4 +45,21 @@ void fastem(  // Output:
     const Numeric rel_azimuth,
     const Index fastem_version);
 
+void fastem_batch(  // Output:
+    Tensor4 &emissivity,
+    Tensor4 &reflectivity,
+    // Input:
+    ConstVectorView f_grid,
+    ConstVectorView za,
+    ConstVectorView temperature,
+    ConstVectorView salinity,
+    ConstVectorView wind_speed,
+    ConstTensor3View transmittance,
+    ConstVectorView rel_azimuth,
+    const Index fastem_version);
+
+void fastem_clip(  // Input and output:
+    MatrixView emissivity,
+    MatrixView reflectivity);
+
 #endif  //fastem_h
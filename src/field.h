@@ -111,9 +111,9 @@ class Field3D {
    * @param[in] col Inner dim
    * @return base& 
    */
-  const base& operator()(size_t col = 0,
+  const base& operator()(size_t page = 0,
                          size_t row = 0,
-                         size_t page = 0) const {
+                         size_t col = 0) const {
     return data[col + row * mcols + page * mrows * mcols];
   }
 
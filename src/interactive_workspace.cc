@@ -275,6 +275,73 @@ void InteractiveWorkspace::set_tensor7_variable(Index id,
   }
 }
 
+void InteractiveWorkspace::adopt_external_variable(Index id,
+                                                   Index rank,
+                                                   const long *dims,
+                                                   Numeric *data) {
+  void *dst = this->operator[](id);
+  switch (rank) {
+    case 1:
+      static_cast<Vector *>(dst)->adopt_external(data, dims[0]);
+      break;
+    case 2:
+      static_cast<Matrix *>(dst)->adopt_external(data, dims[0], dims[1]);
+      break;
+    case 3:
+      static_cast<Tensor3 *>(dst)->adopt_external(
+          data, dims[0], dims[1], dims[2]);
+      break;
+    case 4:
+      static_cast<Tensor4 *>(dst)->adopt_external(
+          data, dims[0], dims[1], dims[2], dims[3]);
+      break;
+    case 5:
+      static_cast<Tensor5 *>(dst)->adopt_external(
+          data, dims[0], dims[1], dims[2], dims[3], dims[4]);
+      break;
+    case 6:
+      static_cast<Tensor6 *>(dst)->adopt_external(
+          data, dims[0], dims[1], dims[2], dims[3], dims[4], dims[5]);
+      break;
+    case 7:
+      static_cast<Tensor7 *>(dst)->adopt_external(
+          data, dims[0], dims[1], dims[2], dims[3], dims[4], dims[5], dims[6]);
+      break;
+    default:
+      throw std::runtime_error("Rank of external data must be 1 to 7.");
+  }
+}
+
+void InteractiveWorkspace::release_external(const Numeric *data) {
+  static const Index vector_group = get_wsv_group_id("Vector");
+  static const Index matrix_group = get_wsv_group_id("Matrix");
+  static const Index tensor3_group = get_wsv_group_id("Tensor3");
+  static const Index tensor4_group = get_wsv_group_id("Tensor4");
+  static const Index tensor5_group = get_wsv_group_id("Tensor5");
+  static const Index tensor6_group = get_wsv_group_id("Tensor6");
+  static const Index tensor7_group = get_wsv_group_id("Tensor7");
+
+  for (Index id = 0; id < nelem(); id++) {
+    if (!is_initialized(id)) continue;
+    const Index group = wsv_data[id].Group();
+    void *var = this->operator[](id);
+    if (group == vector_group)
+      static_cast<Vector *>(var)->detach_external(data);
+    else if (group == matrix_group)
+      static_cast<Matrix *>(var)->detach_external(data);
+    else if (group == tensor3_group)
+      static_cast<Tensor3 *>(var)->detach_external(data);
+    else if (group == tensor4_group)
+      static_cast<Tensor4 *>(var)->detach_external(data);
+    else if (group == tensor5_group)
+      static_cast<Tensor5 *>(var)->detach_external(data);
+    else if (group == tensor6_group)
+      static_cast<Tensor6 *>(var)->detach_external(data);
+    else if (group == tensor7_group)
+      static_cast<Tensor7 *>(var)->detach_external(data);
+  }
+}
+
 void InteractiveWorkspace::set_sparse_variable(Index id,
                                                Index m,
                                                Index n,
@@ -239,6 +239,33 @@ class InteractiveWorkspace : private Workspace {
                             size_t p,
                             size_t q,
                             const Numeric *src);
+  /** Let Vector, Matrix or Tensor variable refer to external data.
+   *
+   * No data is copied. The data remains owned by the caller, who must
+   * keep it alive until it is released with release_external. The
+   * variable detaches from the data when it is resized to other
+   * dimensions.
+   *
+   * \param[in] id Workspace id of the variable to set
+   * \param[in] rank Number of dimensions, 1 for Vector, 2 for Matrix, 3 to 7
+   * for Tensor3 to Tensor7
+   * \param[in] dims Pointer to the c-array holding the size of each dimension
+   * \param[in] data Pointer to the contiguous c-array of Numeric containing
+   * the elements in c-style memory layout.
+   */
+  void adopt_external_variable(Index id,
+                               Index rank,
+                               const long *dims,
+                               Numeric *data);
+  /** Detach all variables from external data.
+   *
+   * Vector, Matrix and Tensor variables referring to the data, see
+   * adopt_external_variable, get a copy of it as their own storage. The
+   * caller can free the data afterwards.
+   *
+   * \param[in] data Pointer to the external data.
+   */
+  void release_external(const Numeric *data);
   /** Deep-copy of Sparse matrix into workspace.
    *
    * Copies a sparse matrix in coordinate format into the workspace.
@@ -0,0 +1,687 @@
+/* Copyright (C) 2026 The ARTS developers
+
+   This program is free software; you can redistribute it and/or modify it
+   under the terms of the GNU General Public License as published by the
+   Free Software Foundation; either version 2, or (at your option) any
+   later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+   USA. */
+
+/*!
+  \file   jobserver.cc
+  \brief  Implementation of the arts job server.
+
+  Jobs run on a copy of the resident workspace. The copy shares the data
+  of the resident variables, but every variable the job writes to is
+  pushed on the stack of the copy first, the same way as for agenda
+  outputs. The resident data are thus never modified by jobs, and can be
+  read by all workers at the same time.
+
+  The execution of the controlfiles is serialized by mexecute_mutex.
+  Parallel jobs would compete for the OpenMP threads used inside the
+  workspace methods, and share global state such as the T-matrix and
+  DISORT work arrays, the verbosity and the agenda caches.
+*/
+
+#include "jobserver.h"
+
+#ifdef ENABLE_DOCSERVER
+
+#include <signal.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include "global_data.h"
+#include "libmicrohttpd/microhttpd.h"
+#include "libmicrohttpd/platform.h"
+#include "parser.h"
+#include "xml_io.h"
+#include "xml_io_private.h"
+#include "xml_io_types.h"
+
+namespace {
+
+//! Written to by request_shutdown, read by JobServer::launch
+int shutdown_pipe[2] = {-1, -1};
+
+//! Signal handler, also called for POST /shutdown
+void request_shutdown(int) {
+  const char c = 0;
+  if (write(shutdown_pipe[1], &c, 1) == -1) return;
+}
+
+//! Maximum number of pieces of a result waiting to be sent
+const size_t MAX_PENDING_PIECES = 4;
+
+//! Request body, collected over the calls of the access handler
+struct RequestState {
+  String body;
+};
+
+//! Reading position in the result of a job, for the content reader
+struct ResultReader {
+  std::shared_ptr<ServerJob> job;
+  String piece;
+  size_t offset;
+};
+
+ssize_t read_result(void* cls, uint64_t pos _U_, char* buf, size_t max) {
+  ResultReader* reader = static_cast<ResultReader*>(cls);
+  while (reader->offset == reader->piece.size()) {
+    if (!reader->job->result.read(reader->piece))
+      return reader->job->result.failed() ? MHD_CONTENT_READER_END_WITH_ERROR
+                                          : MHD_CONTENT_READER_END_OF_STREAM;
+    reader->offset = 0;
+  }
+
+  const size_t n = std::min(max, reader->piece.size() - reader->offset);
+  std::memcpy(buf, reader->piece.data() + reader->offset, n);
+  reader->offset += n;
+  return static_cast<ssize_t>(n);
+}
+
+void free_result(void* cls) {
+  ResultReader* reader = static_cast<ResultReader*>(cls);
+  reader->job->result.abandon();
+  delete reader;
+}
+
+int collect_argument(void* cls,
+                     enum MHD_ValueKind kind _U_,
+                     const char* key,
+                     const char* value) {
+  auto* arguments = static_cast<std::map<String, String>*>(cls);
+  (*arguments)[key] = value ? value : "";
+  return MHD_YES;
+}
+
+int access_handler(void* cls,
+                   struct MHD_Connection* connection,
+                   const char* url,
+                   const char* method,
+                   const char* version _U_,
+                   const char* upload_data,
+                   size_t* upload_data_size,
+                   void** con_cls) {
+  if (!*con_cls) {
+    // First call for this request, only the headers are known
+    *con_cls = new RequestState;
+    return MHD_YES;
+  }
+
+  RequestState* state = static_cast<RequestState*>(*con_cls);
+  if (*upload_data_size) {
+    state->body.append(upload_data, *upload_data_size);
+    *upload_data_size = 0;
+    return MHD_YES;
+  }
+
+  return static_cast<JobServer*>(cls)->respond(
+      connection, url, method, state->body);
+}
+
+void request_completed(void* cls _U_,
+                       struct MHD_Connection* connection _U_,
+                       void** con_cls,
+                       enum MHD_RequestTerminationCode toe _U_) {
+  delete static_cast<RequestState*>(*con_cls);
+  *con_cls = NULL;
+}
+
+int send_response(MHD_Connection* connection,
+                  const unsigned int status,
+                  const String& text,
+                  const String& content_type = "text/plain") {
+  struct MHD_Response* response = MHD_create_response_from_buffer(
+      text.length(), (void*)text.c_str(), MHD_RESPMEM_MUST_COPY);
+  if (response == NULL) {
+    cerr << "Jobserver error: response = 0\n";
+    return MHD_NO;
+  }
+
+  MHD_add_response_header(response, "Content-type", content_type.c_str());
+  const int ret = MHD_queue_response(connection, status, response);
+  MHD_destroy_response(response);
+  return ret;
+}
+
+//! Throws if an agenda, or any agenda defined by it, calls Exit
+void check_no_exit(const Agenda& agenda) {
+  using global_data::md_data;
+
+  for (auto&& method : agenda.Methods()) {
+    if (md_data[method.Id()].Name() == "Exit")
+      throw runtime_error(
+          "Controlfiles of the job server cannot call Exit, "
+          "it would stop the server.");
+    check_no_exit(method.Tasks());
+  }
+}
+
+//! Index of a workspace variable, with a proper error if unknown
+Index find_wsv(const String& name) {
+  const auto it = Workspace::WsvMap.find(name);
+  if (it == Workspace::WsvMap.end()) {
+    ostringstream os;
+    os << "Unknown workspace variable: " << name;
+    throw runtime_error(os.str());
+  }
+  return it->second;
+}
+
+//! Parses a value of type T from the whole string
+template <typename T>
+T parse_value(const String& name, const String& value) {
+  istringstream is(value);
+  T x;
+  is >> x;
+  if (is.fail() || !is.eof()) {
+    ostringstream os;
+    os << "Cannot parse value of " << name << ": " << value;
+    throw runtime_error(os.str());
+  }
+  return x;
+}
+
+//! Sets a variable in the workspace of a job, leaving the resident value
+void set_override(Workspace& ws, const String& name, const String& value) {
+  using global_data::wsv_group_names;
+
+  const Index id = find_wsv(name);
+  const String& group = wsv_group_names[Workspace::wsv_data[id].Group()];
+
+  if (ws.is_initialized(id))
+    ws.duplicate(id);
+  else
+    ws.push_uninitialized(id, NULL);
+
+  if (group == "Index") {
+    *static_cast<Index*>(ws[id]) = parse_value<Index>(name, value);
+  } else if (group == "Numeric") {
+    *static_cast<Numeric*>(ws[id]) = parse_value<Numeric>(name, value);
+  } else if (group == "String") {
+    *static_cast<String*>(ws[id]) = value;
+  } else if (group == "Vector") {
+    ArrayOfString elements;
+    value.split(elements, ",");
+    Vector& v = *static_cast<Vector*>(ws[id]);
+    v.resize(elements.nelem());
+    for (Index i = 0; i < elements.nelem(); i++)
+      v[i] = parse_value<Numeric>(name, elements[i]);
+  } else {
+    ostringstream os;
+    os << "Only Index, Numeric, String and Vector variables can be set "
+       << "by the request, not " << name << " of group " << group << ".";
+    throw runtime_error(os.str());
+  }
+}
+
+#define WRITE_WSV_GROUP(what)                                                \
+  if (group == #what) {                                                      \
+    if (os)                                                                  \
+      xml_write_to_stream(                                                   \
+          *os, *static_cast<const what*>(ws[id]), NULL, name, verbosity);    \
+    return;                                                                  \
+  }
+
+//! Writes a variable of the job workspace as ARTS XML
+/**
+  Throws if the variable cannot be written. With os NULL, nothing is
+  written, which checks the outputs before the result is sent.
+  */
+void write_output(ostream* os,
+                  Workspace& ws,
+                  const String& name,
+                  const Verbosity& verbosity) {
+  using global_data::wsv_group_names;
+
+  const Index id = find_wsv(name);
+  if (!ws.is_initialized(id)) {
+    ostringstream es;
+    es << "Output variable " << name << " is not set by the job.";
+    throw runtime_error(es.str());
+  }
+
+  const String& group = wsv_group_names[Workspace::wsv_data[id].Group()];
+  WRITE_WSV_GROUP(Index)
+  WRITE_WSV_GROUP(Numeric)
+  WRITE_WSV_GROUP(String)
+  WRITE_WSV_GROUP(Vector)
+  WRITE_WSV_GROUP(Matrix)
+  WRITE_WSV_GROUP(Sparse)
+  WRITE_WSV_GROUP(Tensor3)
+  WRITE_WSV_GROUP(Tensor4)
+  WRITE_WSV_GROUP(Tensor5)
+  WRITE_WSV_GROUP(Tensor6)
+  WRITE_WSV_GROUP(Tensor7)
+  WRITE_WSV_GROUP(ArrayOfIndex)
+  WRITE_WSV_GROUP(ArrayOfString)
+  WRITE_WSV_GROUP(ArrayOfVector)
+  WRITE_WSV_GROUP(ArrayOfMatrix)
+  WRITE_WSV_GROUP(ArrayOfTensor3)
+  WRITE_WSV_GROUP(ArrayOfTensor7)
+  WRITE_WSV_GROUP(GriddedField1)
+  WRITE_WSV_GROUP(GriddedField2)
+  WRITE_WSV_GROUP(GriddedField3)
+  WRITE_WSV_GROUP(GriddedField4)
+  WRITE_WSV_GROUP(Ppath)
+
+  ostringstream es;
+  es << "Variables of group " << group << " can currently not be returned "
+     << "by the job server.";
+  throw runtime_error(es.str());
+}
+
+#undef WRITE_WSV_GROUP
+
+}  // namespace
+
+bool JobResult::write(String piece) {
+  std::unique_lock<std::mutex> lock(mmutex);
+  mcv.wait(lock, [this]() {
+    return mabandoned || mpieces.size() < MAX_PENDING_PIECES;
+  });
+  if (mabandoned) return false;
+  mpieces.push_back(std::move(piece));
+  mcv.notify_all();
+  return true;
+}
+
+void JobResult::close(bool failed) {
+  std::lock_guard<std::mutex> lock(mmutex);
+  mclosed = true;
+  mfailed = failed;
+  mcv.notify_all();
+}
+
+void JobResult::abandon() {
+  std::lock_guard<std::mutex> lock(mmutex);
+  mabandoned = true;
+  mcv.notify_all();
+}
+
+bool JobResult::read(String& piece) {
+  std::unique_lock<std::mutex> lock(mmutex);
+  mcv.wait(lock, [this]() { return mclosed || !mpieces.empty(); });
+  if (mpieces.empty()) return false;
+  piece = std::move(mpieces.front());
+  mpieces.pop_front();
+  mcv.notify_all();
+  return true;
+}
+
+bool JobResult::failed() {
+  std::lock_guard<std::mutex> lock(mmutex);
+  return mfailed;
+}
+
+//! Construct job server.
+/**
+  Initializes the resident workspace and starts the workers.
+
+  \param[in]  port       Port to listen on.
+  \param[in]  nworkers   Number of jobs handled in parallel.
+  \param[in]  verbosity  Verbosity of all jobs.
+  */
+JobServer::JobServer(const Index port,
+                     const Index nworkers,
+                     const Verbosity& verbosity)
+    : mport(port == -1 ? 9001 : port),
+      mverbosity(verbosity),
+      mstop(false),
+      mnfinished(0),
+      mnfailed(0) {
+  mresident.initialize();
+  *static_cast<Verbosity*>(mresident[get_wsv_id("verbosity")]) = mverbosity;
+
+  for (Index i = 0; i < std::max(nworkers, Index(1)); i++)
+    mworkers.emplace_back(&JobServer::work, this);
+}
+
+JobServer::~JobServer() {
+  {
+    std::lock_guard<std::mutex> lock(mqueue_mutex);
+    mstop = true;
+  }
+  mqueue_cv.notify_all();
+  for (auto& worker : mworkers) worker.join();
+}
+
+//! Parse a controlfile.
+/**
+  The caller must hold mresident_mutex exclusively, since the parser can
+  add variables to the workspace.
+
+  \param[in]  controlfile  Text of the controlfile.
+
+  \returns The checked main agenda of the controlfile.
+  */
+Agenda JobServer::parse_controlfile(const String& controlfile) {
+  // The parser reads from file
+  char filename[] = "/tmp/arts_jobserver_XXXXXX";
+  const int fd = mkstemp(filename);
+  if (fd == -1) throw runtime_error("Cannot create temporary controlfile.");
+  close(fd);
+
+  Agenda tasklist;
+  try {
+    {
+      std::ofstream file(filename);
+      if (controlfile.find("Arts2") == std::string::npos)
+        file << "Arts2 {\n" << controlfile << "\n}\n";
+      else
+        file << controlfile;
+    }
+
+    ArtsParser arts_parser(tasklist, filename, mverbosity);
+    arts_parser.parse_tasklist();
+  } catch (const std::exception&) {
+    std::remove(filename);
+    throw;
+  }
+  std::remove(filename);
+
+  check_no_exit(tasklist);
+
+  // The record of main_agenda, without inputs and outputs, gives the
+  // variables to push and duplicate
+  tasklist.set_name("main_agenda");
+  tasklist.set_main_agenda();
+  tasklist.set_outputs_to_push_and_dup(mverbosity);
+
+  // Make room for the variables created by the controlfile
+  mresident.initialize();
+
+  return tasklist;
+}
+
+//! Main agenda of a job.
+/**
+  Jobs are often repeated with different variable settings only, so the
+  parsed controlfiles are kept.
+
+  \param[in]  controlfile  Text of the controlfile.
+
+  \returns The checked main agenda of the controlfile.
+  */
+Agenda JobServer::job_tasklist(const String& controlfile) {
+  {
+    std::lock_guard<std::mutex> lock(mtasklists_mutex);
+    const auto it = mtasklists.find(controlfile);
+    if (it != mtasklists.end()) return it->second;
+  }
+
+  Agenda tasklist;
+  {
+    std::unique_lock<std::shared_timed_mutex> lock(mresident_mutex);
+    tasklist = parse_controlfile(controlfile);
+  }
+
+  std::lock_guard<std::mutex> lock(mtasklists_mutex);
+  if (mtasklists.size() >= 1000) mtasklists.clear();
+  mtasklists[controlfile] = tasklist;
+  return tasklist;
+}
+
+void JobServer::update_resident(const String& controlfile) {
+  std::unique_lock<std::shared_timed_mutex> lock(mresident_mutex);
+  const Agenda tasklist = parse_controlfile(controlfile);
+  *static_cast<Verbosity*>(mresident[get_wsv_id("verbosity")]) = mverbosity;
+  tasklist.execute(mresident);
+}
+
+std::future<void> JobServer::submit(std::shared_ptr<ServerJob> job) {
+  std::future<void> executed = job->executed.get_future();
+  {
+    std::lock_guard<std::mutex> lock(mqueue_mutex);
+    mqueue.push_back(job);
+  }
+  mqueue_cv.notify_one();
+  return executed;
+}
+
+//! Worker thread.
+/**
+  Executes queued jobs until the server is stopped.
+  */
+void JobServer::work() {
+  for (;;) {
+    std::shared_ptr<ServerJob> job;
+    {
+      std::unique_lock<std::mutex> lock(mqueue_mutex);
+      mqueue_cv.wait(lock, [this]() { return mstop || !mqueue.empty(); });
+      if (mqueue.empty()) return;
+      job = mqueue.front();
+      mqueue.pop_front();
+    }
+
+    bool failed = false;
+    try {
+      failed = !run_job(*job);
+    } catch (const std::exception&) {
+      failed = true;
+      job->executed.set_exception(std::current_exception());
+      job->result.close(true);
+    }
+
+    std::lock_guard<std::mutex> lock(mqueue_mutex);
+    mnfinished++;
+    if (failed) mnfailed++;
+  }
+}
+
+//! Execute a job.
+/**
+  Throws if the job fails before its result is written. Errors while the
+  result is written close it as incomplete.
+
+  \param[in]  job  The job.
+
+  \returns False if the result is incomplete.
+  */
+bool JobServer::run_job(ServerJob& job) {
+  const Agenda tasklist = job_tasklist(job.controlfile);
+
+  // Resident variables must not change while the job runs
+  std::shared_lock<std::shared_timed_mutex> lock(mresident_mutex);
+  Workspace ws(mresident);
+
+  // Same as for agenda outputs, see auto_md_agenda_execute_helper
+  for (auto&& i : tasklist.get_output2push()) {
+    if (ws.is_initialized(i))
+      ws.duplicate(i);
+    else
+      ws.push_uninitialized(i, NULL);
+  }
+  for (auto&& i : tasklist.get_output2dup()) ws.duplicate(i);
+
+  for (auto&& o : job.overrides) set_override(ws, o.first, o.second);
+
+  const Index verbosity_id = get_wsv_id("verbosity");
+  ws.duplicate(verbosity_id);
+  *static_cast<Verbosity*>(ws[verbosity_id]) = mverbosity;
+
+  {
+    std::lock_guard<std::mutex> execute_lock(mexecute_mutex);
+    tasklist.execute(ws);
+  }
+
+  for (auto&& name : job.outputs) write_output(NULL, ws, name, mverbosity);
+  job.executed.set_value();
+
+  try {
+    ostringstream os;
+    xml_set_stream_precision(os);
+    xml_write_header_to_stream(os, FILE_TYPE_ASCII, mverbosity);
+    for (auto&& name : job.outputs) {
+      write_output(&os, ws, name, mverbosity);
+      if (!job.result.write(os.str())) return true;
+      os.str("");
+    }
+    xml_write_footer_to_stream(os, mverbosity);
+    job.result.write(os.str());
+  } catch (const std::exception&) {
+    job.result.close(true);
+    return false;
+  }
+  job.result.close();
+  return true;
+}
+
+String JobServer::status() {
+  ostringstream os;
+  std::lock_guard<std::mutex> lock(mqueue_mutex);
+  os << "workers " << mworkers.size() << '\n'
+     << "queued " << mqueue.size() << '\n'
+     << "finished " << mnfinished << '\n'
+     << "failed " << mnfailed << '\n';
+  return os.str();
+}
+
+int JobServer::respond(MHD_Connection* connection,
+                       const String& url,
+                       const String& method,
+                       const String& body) {
+  if (url == "/status") {
+    if (method != "GET")
+      return send_response(
+          connection, MHD_HTTP_METHOD_NOT_ALLOWED, "Use GET.\n");
+    return send_response(connection, MHD_HTTP_OK, status());
+  }
+
+  if (url != "/job" && url != "/resident" && url != "/shutdown")
+    return send_response(connection, MHD_HTTP_NOT_FOUND, "Unknown URL.\n");
+  if (method != "POST")
+    return send_response(
+        connection, MHD_HTTP_METHOD_NOT_ALLOWED, "Use POST.\n");
+
+  if (url == "/shutdown") {
+    request_shutdown(0);
+    return send_response(connection, MHD_HTTP_OK, "Shutting down.\n");
+  }
+
+  try {
+    if (url == "/resident") {
+      update_resident(body);
+      return send_response(connection, MHD_HTTP_OK, "Resident data updated.\n");
+    }
+
+    auto job = std::make_shared<ServerJob>();
+    job->controlfile = body;
+
+    std::map<String, String> arguments;
+    MHD_get_connection_values(
+        connection, MHD_GET_ARGUMENT_KIND, &collect_argument, &arguments);
+    for (auto&& a : arguments) {
+      if (a.first == "out")
+        a.second.split(job->outputs, ",");
+      else
+        job->overrides[a.first] = a.second;
+    }
+
+    // The connection thread waits for the execution, then sends the
+    // result while the worker writes it
+    submit(job).get();
+
+    struct MHD_Response* response =
+        MHD_create_response_from_callback(MHD_SIZE_UNKNOWN,
+                                          32 * 1024,
+                                          &read_result,
+                                          new ResultReader{job, "", 0},
+                                          &free_result);
+    if (response == NULL) {
+      job->result.abandon();
+      cerr << "Jobserver error: response = 0\n";
+      return MHD_NO;
+    }
+
+    MHD_add_response_header(response, "Content-type", "text/xml");
+    const int ret = MHD_queue_response(connection, MHD_HTTP_OK, response);
+    MHD_destroy_response(response);
+    return ret;
+  } catch (const std::exception& e) {
+    return send_response(
+        connection, MHD_HTTP_INTERNAL_SERVER_ERROR, String(e.what()) + '\n');
+  }
+}
+
+//! Start the server.
+/**
+  Listens on the loopback interface only, since jobs can read and write
+  files with the permissions of the server.
+
+  \returns Status code.
+  */
+int JobServer::launch() {
+  if (pipe(shutdown_pipe) == -1) {
+    cerr << "Error: Cannot create pipe for server shutdown.\n";
+    return 1;
+  }
+
+  struct sigaction action, old_sigint, old_sigterm;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = &request_shutdown;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGINT, &action, &old_sigint);
+  sigaction(SIGTERM, &action, &old_sigterm);
+
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons((uint16_t)mport);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  struct MHD_Daemon* d =
+      MHD_start_daemon(MHD_USE_THREAD_PER_CONNECTION | MHD_USE_DEBUG,
+                       (uint16_t)mport,
+                       NULL,
+                       NULL,
+                       &access_handler,
+                       (void*)this,
+                       MHD_OPTION_SOCK_ADDR,
+                       &addr,
+                       MHD_OPTION_NOTIFY_COMPLETED,
+                       &request_completed,
+                       NULL,
+                       MHD_OPTION_END);
+
+  int status = 0;
+  if (d == NULL) {
+    cerr << "Error: Cannot start server. Maybe port " << mport
+         << " is already in use?\n";
+    status = 1;
+  } else {
+    cerr << "ARTS job server listening at http://localhost:" << mport
+         << " with " << mworkers.size() << " worker"
+         << (mworkers.size() == 1 ? "" : "s") << ".\n";
+
+    char c;
+    while (read(shutdown_pipe[0], &c, 1) == -1 && errno == EINTR) {
+    }
+
+    cerr << "ARTS job server shutting down.\n";
+    MHD_stop_daemon(d);
+  }
+
+  sigaction(SIGINT, &old_sigint, NULL);
+  sigaction(SIGTERM, &old_sigterm, NULL);
+  close(shutdown_pipe[0]);
+  close(shutdown_pipe[1]);
+  shutdown_pipe[0] = shutdown_pipe[1] = -1;
+  return status;
+}
+
+#endif /* ENABLE_DOCSERVER */
@@ -0,0 +1,225 @@
+/* Copyright (C) 2026 The ARTS developers
+
+   This program is free software; you can redistribute it and/or modify it
+   under the terms of the GNU General Public License as published by the
+   Free Software Foundation; either version 2, or (at your option) any
+   later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+   USA. */
+
+/*!
+  \file   jobserver.h
+  \brief  Declarations for the arts job server.
+
+  The job server keeps a resident workspace in memory and executes
+  controlfile jobs on it, so that the start-up of ARTS and the reading
+  of large input data are paid for only once. Requests are served over
+  HTTP on the loopback interface:
+
+  - POST /resident  Executes the controlfile in the request body on the
+                    resident workspace. The variables it sets are kept
+                    for all later jobs.
+  - POST /job       Executes the controlfile in the request body on a
+                    copy of the resident workspace. The query argument
+                    out=var1,var2 lists the variables to return, all
+                    other query arguments set Index, Numeric, String or
+                    Vector variables before the job starts. The
+                    response is an ARTS XML document with the returned
+                    variables, streamed one variable at a time.
+  - GET /status     Short summary of the server state.
+  - POST /shutdown  Stops the server, as SIGINT and SIGTERM do.
+
+  A controlfile without an Arts2 block is treated as the content of one.
+  Controlfiles calling Exit are rejected.
+
+  The controlfiles are executed one at a time, since the workspace
+  methods use OpenMP on their own and keep some global state. The
+  workers overlap the preparation of jobs and the sending of results
+  with the execution.
+*/
+
+#ifndef jobserver_h
+#define jobserver_h
+
+#include "arts.h"
+
+#ifdef ENABLE_DOCSERVER
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+#include "agenda_class.h"
+#include "messages.h"
+#include "workspace_ng.h"
+
+struct MHD_Connection;
+
+/** The result of a job, written and read in pieces.
+
+    The worker writes the ARTS XML document with the outputs of the job
+    one variable at a time, while the connection sends the pieces
+    already written. The writer waits if the reader falls behind.
+*/
+class JobResult {
+ public:
+  /** Appends a piece of the document.
+
+      \param[in]  piece  The piece.
+      \return     False if the reader has gone and the rest of the
+                  document is not needed.
+  */
+  bool write(String piece);
+
+  /** Marks the end of the document.
+
+      \param[in]  failed  Whether the document is incomplete.
+  */
+  void close(bool failed = false);
+
+  /** Marks that the reader has gone. */
+  void abandon();
+
+  /** Takes the next piece of the document.
+
+      Waits until a piece is written or the document is closed.
+
+      \param[out] piece  The piece.
+      \return     False, leaving piece untouched, at the end of the
+                  document.
+  */
+  bool read(String& piece);
+
+  /** Whether the document was closed as incomplete. */
+  bool failed();
+
+ private:
+  std::mutex mmutex;
+  std::condition_variable mcv;
+  std::deque<String> mpieces;
+  bool mclosed = false;
+  bool mfailed = false;
+  bool mabandoned = false;
+};
+
+/** A job submitted to the server. */
+struct ServerJob {
+  /** Text of the controlfile. */
+  String controlfile;
+  /** Names of the variables to return. */
+  ArrayOfString outputs;
+  /** Values of the variables to set before the job starts, by name. */
+  std::map<String, String> overrides;
+  /** Set when the controlfile has been executed, or to the error of the
+      job. */
+  std::promise<void> executed;
+  /** ARTS XML document with the outputs, written after execution. */
+  JobResult result;
+};
+
+class JobServer {
+ public:
+  /** Constructor.
+
+      \param[in]  port       Port to listen on.
+      \param[in]  nworkers   Number of jobs handled in parallel.
+      \param[in]  verbosity  Verbosity of all jobs.
+  */
+  JobServer(const Index port, const Index nworkers, const Verbosity& verbosity);
+
+  JobServer(const JobServer&) = delete;
+  JobServer& operator=(const JobServer&) = delete;
+
+  ~JobServer();
+
+  /** Executes a controlfile on the resident workspace.
+
+      Waits for all running jobs to finish first.
+
+      \param[in]  controlfile  Text of the controlfile.
+  */
+  void update_resident(const String& controlfile);
+
+  /** Queues a job for execution.
+
+      \param[in]  job  The job.
+      \return     Future that is ready when the controlfile of the job has
+                  been executed. The outputs can then be read from the
+                  result of the job.
+  */
+  std::future<void> submit(std::shared_ptr<ServerJob> job);
+
+  /** Serves requests until a shutdown is requested.
+
+      A shutdown is requested by SIGINT, SIGTERM or POST /shutdown. The
+      jobs already submitted are completed.
+
+      \return Status code, non-zero if the server could not be started.
+  */
+  int launch();
+
+  /** Answers a HTTP request, called by the HTTP daemon.
+
+      \param[in]  connection  Connection of the request.
+      \param[in]  url         Requested URL.
+      \param[in]  method      Request method.
+      \param[in]  body        Request body.
+      \return     MHD status code.
+  */
+  int respond(MHD_Connection* connection,
+              const String& url,
+              const String& method,
+              const String& body);
+
+ private:
+  void work();
+
+  bool run_job(ServerJob& job);
+
+  Agenda parse_controlfile(const String& controlfile);
+
+  Agenda job_tasklist(const String& controlfile);
+
+  String status();
+
+  Index mport;
+  Verbosity mverbosity;
+
+  //! Workspace with the data kept between jobs
+  Workspace mresident;
+  //! Shared by running jobs, exclusive when parsing or updating mresident
+  std::shared_timed_mutex mresident_mutex;
+  //! Held while a controlfile is executed
+  std::mutex mexecute_mutex;
+
+  //! Parsed job controlfiles, by controlfile text
+  std::map<String, Agenda> mtasklists;
+  std::mutex mtasklists_mutex;
+
+  std::deque<std::shared_ptr<ServerJob> > mqueue;
+  std::mutex mqueue_mutex;
+  std::condition_variable mqueue_cv;
+  bool mstop;
+
+  std::vector<std::thread> mworkers;
+
+  Index mnfinished;
+  Index mnfailed;
+};
+
+#endif /* ENABLE_DOCSERVER */
+
+#endif /* jobserver_h */
@@ -398,6 +398,7 @@
 
 #include "legacy_continua.h"
 #include <cmath>
+#include <cstring>
 #include "absorption.h"
 #include "array.h"
 #include "arts.h"
@@ -20459,6 +20460,349 @@ void check_continuum_model(const String &name) {
     throw runtime_error(os.str());
   }
 }
+
+// #################################################################################
+// ########################## prepared continuum models ############################
+// #################################################################################
+
+namespace {
+// Parameter i, or zero if not given (the non-user models take no parameters).
+Numeric continuum_parameter(ConstVectorView parameters, const Index i) {
+  return parameters.nelem() > i ? parameters[i] : 0.0;
+}
+
+void h2o_self_standard_level(MatrixView pxsec,
+                             ConstVectorView parameters,
+                             const String &model,
+                             ConstVectorView f_grid,
+                             ConstVectorView abs_p,
+                             ConstVectorView abs_t,
+                             ConstVectorView abs_n2 _U_,
+                             ConstVectorView vmr,
+                             const Verbosity &verbosity) {
+  Standard_H2O_self_continuum(pxsec,
+                              continuum_parameter(parameters, 0),
+                              continuum_parameter(parameters, 1),
+                              model,
+                              f_grid,
+                              abs_p,
+                              abs_t,
+                              vmr,
+                              verbosity);
+}
+
+void h2o_foreign_standard_level(MatrixView pxsec,
+                                ConstVectorView parameters,
+                                const String &model,
+                                ConstVectorView f_grid,
+                                ConstVectorView abs_p,
+                                ConstVectorView abs_t,
+                                ConstVectorView abs_n2 _U_,
+                                ConstVectorView vmr,
+                                const Verbosity &verbosity) {
+  Standard_H2O_foreign_continuum(pxsec,
+                                 continuum_parameter(parameters, 0),
+                                 continuum_parameter(parameters, 1),
+                                 model,
+                                 f_grid,
+                                 abs_p,
+                                 abs_t,
+                                 vmr,
+                                 verbosity);
+}
+
+void h2o_foreign_matipping_level(MatrixView pxsec,
+                                 ConstVectorView parameters,
+                                 const String &model,
+                                 ConstVectorView f_grid,
+                                 ConstVectorView abs_p,
+                                 ConstVectorView abs_t,
+                                 ConstVectorView abs_n2 _U_,
+                                 ConstVectorView vmr,
+                                 const Verbosity &verbosity) {
+  MaTipping_H2O_foreign_continuum(pxsec,
+                                  continuum_parameter(parameters, 0),
+                                  continuum_parameter(parameters, 1),
+                                  model,
+                                  f_grid,
+                                  abs_p,
+                                  abs_t,
+                                  vmr,
+                                  verbosity);
+}
+
+void n2_self_standard_level(MatrixView pxsec,
+                            ConstVectorView parameters,
+                            const String &model,
+                            ConstVectorView f_grid,
+                            ConstVectorView abs_p,
+                            ConstVectorView abs_t,
+                            ConstVectorView abs_n2 _U_,
+                            ConstVectorView vmr,
+                            const Verbosity &verbosity) {
+  Standard_N2_self_continuum(pxsec,
+                             continuum_parameter(parameters, 0),
+                             continuum_parameter(parameters, 1),
+                             continuum_parameter(parameters, 2),
+                             continuum_parameter(parameters, 3),
+                             model,
+                             f_grid,
+                             abs_p,
+                             abs_t,
+                             vmr,
+                             verbosity);
+}
+
+void co2_self_pwr93_level(MatrixView pxsec,
+                          ConstVectorView parameters,
+                          const String &model,
+                          ConstVectorView f_grid,
+                          ConstVectorView abs_p,
+                          ConstVectorView abs_t,
+                          ConstVectorView abs_n2 _U_,
+                          ConstVectorView vmr,
+                          const Verbosity &verbosity) {
+  Rosenkranz_CO2_self_continuum(pxsec,
+                                continuum_parameter(parameters, 0),
+                                continuum_parameter(parameters, 1),
+                                model,
+                                f_grid,
+                                abs_p,
+                                abs_t,
+                                vmr,
+                                verbosity);
+}
+
+void co2_foreign_pwr93_level(MatrixView pxsec,
+                             ConstVectorView parameters,
+                             const String &model,
+                             ConstVectorView f_grid,
+                             ConstVectorView abs_p,
+                             ConstVectorView abs_t,
+                             ConstVectorView abs_n2,
+                             ConstVectorView vmr,
+                             const Verbosity &verbosity) {
+  Rosenkranz_CO2_foreign_continuum(pxsec,
+                                   continuum_parameter(parameters, 0),
+                                   continuum_parameter(parameters, 1),
+                                   model,
+                                   f_grid,
+                                   abs_p,
+                                   abs_t,
+                                   abs_n2,
+                                   vmr,
+                                   verbosity);
+}
+
+void co2_self_ho66_level(MatrixView pxsec,
+                         ConstVectorView parameters,
+                         const String &model,
+                         ConstVectorView f_grid,
+                         ConstVectorView abs_p,
+                         ConstVectorView abs_t,
+                         ConstVectorView abs_n2 _U_,
+                         ConstVectorView vmr,
+                         const Verbosity &verbosity) {
+  Ho66_CO2_self_continuum(pxsec,
+                          continuum_parameter(parameters, 0),
+                          continuum_parameter(parameters, 1),
+                          model,
+                          f_grid,
+                          abs_p,
+                          abs_t,
+                          vmr,
+                          verbosity);
+}
+
+void co2_foreign_ho66_level(MatrixView pxsec,
+                            ConstVectorView parameters,
+                            const String &model,
+                            ConstVectorView f_grid,
+                            ConstVectorView abs_p,
+                            ConstVectorView abs_t,
+                            ConstVectorView abs_n2,
+                            ConstVectorView vmr,
+                            const Verbosity &verbosity) {
+  Ho66_CO2_foreign_continuum(pxsec,
+                             continuum_parameter(parameters, 0),
+                             continuum_parameter(parameters, 1),
+                             model,
+                             f_grid,
+                             abs_p,
+                             abs_t,
+                             abs_n2,
+                             vmr,
+                             verbosity);
+}
+
+// Level function and frequency exponent of the separable continua, see
+// the model functions above for the exponents. Returns nullptr for all
+// other continua.
+ContinuumLevelFunction separable_continuum(const String &name,
+                                           ConstVectorView parameters,
+                                           const String &model,
+                                           Numeric &xf) {
+  xf = 2.0;
+  if ("H2O-SelfContStandardType" == name) return h2o_self_standard_level;
+  if ("H2O-ForeignContStandardType" == name) return h2o_foreign_standard_level;
+  if ("H2O-ForeignContMaTippingType" == name) {
+    xf = 2.0389;
+    return h2o_foreign_matipping_level;
+  }
+  if ("N2-SelfContStandardType" == name) {
+    if (model == "user") xf = continuum_parameter(parameters, 1);
+    return n2_self_standard_level;
+  }
+  if ("CO2-SelfContPWR93" == name) return co2_self_pwr93_level;
+  if ("CO2-ForeignContPWR93" == name) return co2_foreign_pwr93_level;
+  if ("CO2-SelfContHo66" == name) return co2_self_ho66_level;
+  if ("CO2-ForeignContHo66" == name) return co2_foreign_ho66_level;
+  return nullptr;
+}
+}  // namespace
+
+bool PreparedContinuum::Separable(const String &name) {
+  Numeric xf;
+  return separable_continuum(name, Vector(), "", xf) != nullptr;
+}
+
+PreparedContinuum::PreparedContinuum(const String &name,
+                                     ConstVectorView parameters,
+                                     const String &model,
+                                     ConstVectorView f_grid,
+                                     const Verbosity &verbosity)
+    : mname(name),
+      mmodel(model),
+      mparameters(parameters),
+      mf_grid(f_grid),
+      mf_key(FrequencyKey(f_grid)) {
+  Numeric xf;
+  mlevel_function = separable_continuum(name, parameters, model, xf);
+
+  if (!IsSeparable()) return;
+
+  // Run the standard path once for a single frequency and level, to get
+  // the same checks of model and parameters.
+  Matrix xsec_test(1, 1, 0.0);
+  const Vector one(1, 1.0);
+  const Vector p_test(1, 1e5), t_test(1, 280.), vmr_test(1, 0.01);
+  xsec_continuum_tag(xsec_test,
+                     name,
+                     parameters,
+                     model,
+                     one,
+                     p_test,
+                     t_test,
+                     vmr_test,
+                     vmr_test,
+                     vmr_test,
+                     vmr_test,
+                     verbosity);
+
+  mf_factor.resize(mf_grid.nelem());
+  for (Index s = 0; s < mf_grid.nelem(); ++s)
+    mf_factor[s] = pow(mf_grid[s], xf);
+}
+
+bool PreparedContinuum::Matches(const String &name,
+                                ConstVectorView parameters,
+                                const String &model,
+                                const Index nf,
+                                const std::uint64_t f_key) const {
+  if (nf != mf_grid.nelem() || f_key != mf_key || name != mname ||
+      model != mmodel || parameters.nelem() != mparameters.nelem())
+    return false;
+
+  for (Index i = 0; i < parameters.nelem(); ++i)
+    if (parameters[i] != mparameters[i]) return false;
+
+  return true;
+}
+
+std::uint64_t PreparedContinuum::FrequencyKey(ConstVectorView f_grid) {
+  // Frequency grids are practically always contiguous, others are copied
+  const Index n = f_grid.nelem();
+  const Numeric* f = f_grid.contiguous().data;
+  Vector copy;
+  if (!f && n) {
+    copy = Vector(f_grid);
+    f = copy.get_c_array();
+  }
+
+  // 64 bit FNV-1a over the bit patterns of the values, in four
+  // interleaved streams so that the multiplications can overlap
+  constexpr std::uint64_t prime = 1099511628211ULL;
+  constexpr std::uint64_t basis = 14695981039346656037ULL;
+  std::uint64_t k0 = basis, k1 = basis ^ 1, k2 = basis ^ 2, k3 = basis ^ 3;
+  std::uint64_t bits[4];
+  Index i = 0;
+  for (; i + 4 <= n; i += 4) {
+    std::memcpy(bits, f + i, sizeof(bits));
+    k0 = (k0 ^ bits[0]) * prime;
+    k1 = (k1 ^ bits[1]) * prime;
+    k2 = (k2 ^ bits[2]) * prime;
+    k3 = (k3 ^ bits[3]) * prime;
+  }
+  for (; i < n; ++i) {
+    std::memcpy(bits, f + i, sizeof(bits[0]));
+    k0 = (k0 ^ bits[0]) * prime;
+  }
+  std::uint64_t key = std::uint64_t(n);
+  for (const std::uint64_t k : {k0, k1, k2, k3}) key = (key ^ k) * prime;
+  return key;
+}
+
+void PreparedContinuum::Add(MatrixView xsec,
+                            ConstVectorView abs_p,
+                            ConstVectorView abs_t,
+                            ConstVectorView abs_n2,
+                            ConstVectorView abs_h2o,
+                            ConstVectorView abs_o2,
+                            ConstVectorView vmr,
+                            const Verbosity &verbosity) const {
+  if (!IsSeparable()) {
+    xsec_continuum_tag(xsec,
+                       mname,
+                       mparameters,
+                       mmodel,
+                       mf_grid,
+                       abs_p,
+                       abs_t,
+                       abs_n2,
+                       abs_h2o,
+                       abs_o2,
+                       vmr,
+                       verbosity);
+    return;
+  }
+
+  const Index n_p = abs_p.nelem();
+  const Index n_f = mf_grid.nelem();
+
+  assert(n_f == xsec.nrows());
+  assert(n_p == xsec.ncols());
+
+  // Level dependent part, evaluated at 1 Hz:
+  Matrix pxsec(1, n_p, 0.0);
+  const Vector one(1, 1.0);
+  mlevel_function(
+      pxsec, mparameters, mmodel, one, abs_p, abs_t, abs_n2, vmr, verbosity);
+
+  // Boltzmann constant
+  extern const Numeric BOLTZMAN_CONST;
+
+  // Scale the frequency factors, including the conversion from pseudo
+  // cross section to true cross section as in xsec_continuum_tag.
+  Vector level_factor(n_p);
+  for (Index i = 0; i < n_p; ++i)
+    level_factor[i] = pxsec(0, i) / (abs_p[i] / BOLTZMAN_CONST / abs_t[i]);
+
+  // Levels in the inner loop, they are adjacent in xsec
+  for (Index s = 0; s < n_f; ++s) {
+    const Numeric f_factor = mf_factor[s];
+    for (Index i = 0; i < n_p; ++i) xsec(s, i) += level_factor[i] * f_factor;
+  }
+}
 //
 //
 // #################################################################################
@@ -32,6 +32,7 @@
 #ifndef continua_h
 #define continua_h
 
+#include <cstdint>
 #include "matpackI.h"
 #include "messages.h"
 #include "mystring.h"
@@ -53,6 +54,103 @@ void xsec_continuum_tag(MatrixView xsec,             // calculated x-section
                         ConstVectorView vmr,         // species vmr profile
                         const Verbosity& verbosity);
 
+////////////////////////////////////////////////////////////////////////////
+// continua prepared for repeated use on a fixed frequency grid
+////////////////////////////////////////////////////////////////////////////
+
+/** Level dependent part of a continuum with separable frequency dependence.
+
+   Computes the pseudo cross section of the continuum for a frequency grid
+   of a single element at 1 Hz, i.e., everything except the frequency factor.
+ */
+typedef void (*ContinuumLevelFunction)(MatrixView pxsec,
+                                       ConstVectorView parameters,
+                                       const String& model,
+                                       ConstVectorView f_grid,
+                                       ConstVectorView abs_p,
+                                       ConstVectorView abs_t,
+                                       ConstVectorView abs_n2,
+                                       ConstVectorView vmr,
+                                       const Verbosity& verbosity);
+
+/** A continuum model prepared for a fixed frequency grid.
+
+   The name dispatch and the frequency dependent factors are done once when
+   the object is created.  For continua where the frequency dependence
+   separates from the pressure, temperature and VMR dependence (the
+   "StandardType", MaTipping, PWR93 and Ho66 CO2 continua), a call then only
+   applies the level dependent scaling to the stored frequency factors, via
+   a direct pointer to the model function.  All other continua, e.g. the
+   CKD and MPM93 families, are passed on to xsec_continuum_tag unchanged.
+   Their frequency and temperature dependencies do not separate, so the
+   frequency factors cannot be stored without reworking each model.
+ */
+class PreparedContinuum {
+ public:
+  PreparedContinuum() = default;
+
+  /** Prepare a continuum.
+
+     Throws the same errors as xsec_continuum_tag for wrong model names and
+     parameters.
+
+     \param name        Continuum tag name, e.g. "H2O-SelfContStandardType".
+     \param parameters  Model parameters, as in abs_cont_parameters.
+     \param model       Model option, as in abs_cont_models.
+     \param f_grid      Frequency grid.
+     \param verbosity   Verbosity.
+   */
+  PreparedContinuum(const String& name,
+                    ConstVectorView parameters,
+                    const String& model,
+                    ConstVectorView f_grid,
+                    const Verbosity& verbosity);
+
+  /** Check whether this object was prepared for the given input.
+
+     The frequency grid is identified by its size and FrequencyKey, so that
+     callers can compute the key once for many continua. Grids of the same
+     size and key are taken to be equal.
+   */
+  bool Matches(const String& name,
+               ConstVectorView parameters,
+               const String& model,
+               Index nf,
+               std::uint64_t f_key) const;
+
+  /** Hash of the values of a frequency grid, for Matches. */
+  static std::uint64_t FrequencyKey(ConstVectorView f_grid);
+
+  /** True if the continuum uses the separable fast path. */
+  bool IsSeparable() const { return mlevel_function != nullptr; }
+
+  /** True if continua of this tag name use the separable fast path. */
+  static bool Separable(const String& name);
+
+  /** Add the continuum cross section to xsec.
+
+     Same meaning of arguments and result as for xsec_continuum_tag, with
+     the frequency grid given when preparing.
+   */
+  void Add(MatrixView xsec,
+           ConstVectorView abs_p,
+           ConstVectorView abs_t,
+           ConstVectorView abs_n2,
+           ConstVectorView abs_h2o,
+           ConstVectorView abs_o2,
+           ConstVectorView vmr,
+           const Verbosity& verbosity) const;
+
+ private:
+  String mname;
+  String mmodel;
+  Vector mparameters;
+  Vector mf_grid;
+  std::uint64_t mf_key{0};
+  Vector mf_factor;
+  ContinuumLevelFunction mlevel_function{nullptr};
+};
+
 ////////////////////////////////////////////////////////////////////////////
 // check of consistency of all full and continua absorption models
 ////////////////////////////////////////////////////////////////////////////
@@ -648,6 +648,10 @@ void abs_xsec_per_speciesAddConts(  // WS Output:
 
   out3 << "  Calculating continuum spectra.\n";
 
+  // Key of f_grid for the prepared continua, set at the first use
+  std::uint64_t f_grid_key = 0;
+  bool f_grid_key_set = false;
+
   // Loop tag groups:
   for (Index ii = 0; ii < abs_species_active.nelem(); ++ii) {
     const Index i = abs_species_active[ii];
@@ -723,19 +727,68 @@ void abs_xsec_per_speciesAddConts(  // WS Output:
         //   CO2-ForeignContPWR93, CO2-ForeignContHo66
         // abs_o2 for
         //   N2-CIArotCKDMT252, N2-CIAfunCKDMT252
+        // Continua with separable frequency dependence are prepared once
+        // per model, parameters and frequency grid and kept between calls,
+        // since for on-the-fly absorption this method is called once per
+        // propagation path point. Other continua, e.g. the CKD and MPM93
+        // models, gain nothing from preparing and are calculated directly.
+        const PreparedContinuum* prepared_continuum = nullptr;
+        if (PreparedContinuum::Separable(name)) {
+          thread_local Array<PreparedContinuum> prepared_continua;
+          if (!f_grid_key_set) {
+            f_grid_key = PreparedContinuum::FrequencyKey(f_grid);
+            f_grid_key_set = true;
+          }
+          Index ipc = 0;
+          while (ipc < prepared_continua.nelem() &&
+                 !prepared_continua[ipc].Matches(name,
+                                                 abs_cont_parameters[n],
+                                                 abs_cont_models[n],
+                                                 f_grid.nelem(),
+                                                 f_grid_key))
+            ipc++;
+          if (ipc == prepared_continua.nelem()) {
+            if (prepared_continua.nelem() >= 32) {
+              prepared_continua.resize(0);
+              ipc = 0;
+            }
+            prepared_continua.push_back(
+                PreparedContinuum(name,
+                                  abs_cont_parameters[n],
+                                  abs_cont_models[n],
+                                  f_grid,
+                                  verbosity));
+          }
+          prepared_continuum = &prepared_continua[ipc];
+        }
+
+        const auto add_continuum = [&](MatrixView xsec, ConstVectorView t) {
+          if (prepared_continuum)
+            prepared_continuum->Add(xsec,
+                                    abs_p,
+                                    t,
+                                    abs_n2,
+                                    abs_h2o,
+                                    abs_o2,
+                                    abs_vmrs(i, Range(joker)),
+                                    verbosity);
+          else
+            xsec_continuum_tag(xsec,
+                               name,
+                               abs_cont_parameters[n],
+                               abs_cont_models[n],
+                               f_grid,
+                               abs_p,
+                               t,
+                               abs_n2,
+                               abs_h2o,
+                               abs_o2,
+                               abs_vmrs(i, Range(joker)),
+                               verbosity);
+        };
+
         if (!do_jac)
-          xsec_continuum_tag(abs_xsec_per_species[i],
-                             name,
-                             abs_cont_parameters[n],
-                             abs_cont_models[n],
-                             f_grid,
-                             abs_p,
-                             abs_t,
-                             abs_n2,
-                             abs_h2o,
-                             abs_o2,
-                             abs_vmrs(i, Range(joker)),
-                             verbosity);
+          add_continuum(abs_xsec_per_species[i], abs_t);
         else  // The Jacobian block
         {
           // Needs a reseted block here...
@@ -748,18 +801,7 @@ void abs_xsec_per_speciesAddConts(  // WS Output:
           }
 
           // Normal calculations
-          xsec_continuum_tag(normal,
-                             name,
-                             abs_cont_parameters[n],
-                             abs_cont_models[n],
-                             f_grid,
-                             abs_p,
-                             abs_t,
-                             abs_n2,
-                             abs_h2o,
-                             abs_o2,
-                             abs_vmrs(i, Range(joker)),
-                             verbosity);
+          add_continuum(normal, abs_t);
 
           // Frequency calculations
           if (do_freq_jac)
@@ -778,18 +820,7 @@ void abs_xsec_per_speciesAddConts(  // WS Output:
 
           //Temperature calculations
           if (do_temp_jac)
-            xsec_continuum_tag(jacs_dt,
-                               name,
-                               abs_cont_parameters[n],
-                               abs_cont_models[n],
-                               f_grid,
-                               abs_p,
-                               dabs_t,
-                               abs_n2,
-                               abs_h2o,
-                               abs_o2,
-                               abs_vmrs(i, Range(joker)),
-                               verbosity);
+            add_continuum(jacs_dt, dabs_t);
           for (Index iv = 0; iv < f_grid.nelem(); iv++) {
             for (Index ip = 0; ip < abs_p.nelem(); ip++) {
               abs_xsec_per_species[i](iv, ip) += normal(iv, ip);
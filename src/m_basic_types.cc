@@ -61,6 +61,7 @@
 #include "messages.h"
 #include "mystring.h"
 #include "optproperties.h"
+#include "ppath.h"
 #include "quantum.h"
 #include "sorting.h"
 
@@ -2164,6 +2165,85 @@ void Compare(const SingleScatteringData& var1,
           verbosity);
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void Compare(const Ppath& var1,
+             const Ppath& var2,
+             const Numeric& maxabsdiff,
+             const String& error_message,
+             const String& var1name,
+             const String& var2name,
+             const String&,
+             const String&,
+             const Verbosity& verbosity) {
+  if (var1.dim != var2.dim || var1.np != var2.np ||
+      var1.background != var2.background) {
+    std::ostringstream os;
+    os << var1name << " and " << var2name << " differ in dimensionality, "
+       << "number of points or radiative background:\n"
+       << var1name << ": " << var1.dim << ", " << var1.np << ", "
+       << var1.background << "\n"
+       << var2name << ": " << var2.dim << ", " << var2.np << ", "
+       << var2.background;
+    throw std::runtime_error(os.str());
+  }
+  if (!var1.np) return;
+
+  Compare(var1.pos,
+          var2.pos,
+          maxabsdiff,
+          error_message,
+          var1name + ".pos",
+          var2name + ".pos",
+          "",
+          "",
+          verbosity);
+  Compare(var1.los,
+          var2.los,
+          maxabsdiff,
+          error_message,
+          var1name + ".los",
+          var2name + ".los",
+          "",
+          "",
+          verbosity);
+  Compare(var1.lstep,
+          var2.lstep,
+          maxabsdiff,
+          error_message,
+          var1name + ".lstep",
+          var2name + ".lstep",
+          "",
+          "",
+          verbosity);
+  Compare(var1.start_pos,
+          var2.start_pos,
+          maxabsdiff,
+          error_message,
+          var1name + ".start_pos",
+          var2name + ".start_pos",
+          "",
+          "",
+          verbosity);
+  Compare(var1.end_pos,
+          var2.end_pos,
+          maxabsdiff,
+          error_message,
+          var1name + ".end_pos",
+          var2name + ".end_pos",
+          "",
+          "",
+          verbosity);
+  Compare(var1.nreal,
+          var2.nreal,
+          maxabsdiff,
+          error_message,
+          var1name + ".nreal",
+          var2name + ".nreal",
+          "",
+          "",
+          verbosity);
+}
+
 inline void _cr_internal_(const Numeric& var1,
                           const Numeric& var2,
                           const Numeric& maxabsreldiff,
@@ -28,6 +28,7 @@
 
 #include "absorption.h"
 #include "arts.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "cia.h"
 #include "file.h"
@@ -122,17 +123,18 @@ void abs_xsec_per_speciesAddCIA(  // WS Output:
     }
   }
 
-  // Allocate a vector with dimension frequencies for constructing our
-  // cross-sections before adding them (more efficient to allocate this here
-  // outside of the loops)
-  Vector xsec_temp(f_grid.nelem());
+  // Allocate a matrix with dimension frequencies and pressures for
+  // constructing our cross-sections before adding them (more efficient to
+  // allocate this here outside of the loops)
+  const Index np = abs_p.nelem();
+  Matrix xsec_temp(f_grid.nelem(), np);
 
-  // Jacobian vectors START
-  Vector dxsec_temp_dT;
-  Vector dxsec_temp_dF;
-  if (do_freq_jac) dxsec_temp_dF.resize(f_grid.nelem());
-  if (do_temp_jac) dxsec_temp_dT.resize(f_grid.nelem());
-  // Jacobian vectors END
+  // Jacobian matrices START
+  Matrix dxsec_temp_dT;
+  Matrix dxsec_temp_dF;
+  if (do_freq_jac) dxsec_temp_dF.resize(f_grid.nelem(), np);
+  if (do_temp_jac) dxsec_temp_dT.resize(f_grid.nelem(), np);
+  // Jacobian matrices END
 
   // Loop over CIA data sets.
   // Index ii loops through the outer array (different tag groups),
@@ -193,40 +195,42 @@ void abs_xsec_per_speciesAddCIA(  // WS Output:
         throw runtime_error(os.str());
       }
 
-      // Loop over pressure:
-      for (Index ip = 0; ip < abs_p.nelem(); ip++) {
-        // Get the binary absorption cross sections from the CIA data:
-        try {
-          this_cia.Extract(xsec_temp,
+      // Get the binary absorption cross sections from the CIA data, for
+      // all pressure levels at once:
+      try {
+        this_cia.Extract(xsec_temp,
+                         f_grid,
+                         abs_t,
+                         this_species.CIADataset(),
+                         T_extrapolfac,
+                         robust,
+                         verbosity);
+        if (do_freq_jac)
+          this_cia.Extract(dxsec_temp_dF,
+                           dfreq,
+                           abs_t,
+                           this_species.CIADataset(),
+                           T_extrapolfac,
+                           robust,
+                           verbosity);
+        if (do_temp_jac)
+          this_cia.Extract(dxsec_temp_dT,
                            f_grid,
-                           abs_t[ip],
+                           dabs_t,
                            this_species.CIADataset(),
                            T_extrapolfac,
                            robust,
                            verbosity);
-          if (do_freq_jac)
-            this_cia.Extract(dxsec_temp_dF,
-                             dfreq,
-                             abs_t[ip],
-                             this_species.CIADataset(),
-                             T_extrapolfac,
-                             robust,
-                             verbosity);
-          if (do_temp_jac)
-            this_cia.Extract(dxsec_temp_dT,
-                             f_grid,
-                             dabs_t[ip],
-                             this_species.CIADataset(),
-                             T_extrapolfac,
-                             robust,
-                             verbosity);
-        } catch (const std::runtime_error& e) {
-          ostringstream os;
-          os << "Problem with CIA species " << this_species.Name() << ":\n"
-             << e.what();
-          throw runtime_error(os.str());
-        }
+      } catch (const std::runtime_error& e) {
+        ostringstream os;
+        os << "Problem with CIA species " << this_species.Name() << ":\n"
+           << e.what();
+        throw runtime_error(os.str());
+      }
 
+      // Loop over pressure:
+#pragma omp parallel for if (!arts_omp_in_parallel() && np > 1)
+      for (Index ip = 0; ip < np; ip++) {
         // We have to multiply with the number density of the second CIA species.
         // We do not have to multiply with the first, since we still
         // want to return a (unary) absorption cross-section, not an
@@ -237,31 +241,31 @@ void abs_xsec_per_speciesAddCIA(  // WS Output:
             abs_vmrs(i_sec, ip) * number_density(abs_p[ip], abs_t[ip]);
 
         if (!do_jac) {
-          xsec_temp *= n;
           // Add to result variable:
-          this_xsec(joker, ip) += xsec_temp;
+          for (Index iv = 0; iv < xsec_temp.nrows(); iv++)
+            this_xsec(iv, ip) += n * xsec_temp(iv, ip);
         } else {
           const Numeric dn_dT =
               abs_vmrs(i_sec, ip) * dnumber_density_dt(abs_p[ip], abs_t[ip]);
 
-          for (Index iv = 0; iv < xsec_temp.nelem(); iv++) {
-            this_xsec(iv, ip) += n * xsec_temp[iv];
+          for (Index iv = 0; iv < xsec_temp.nrows(); iv++) {
+            this_xsec(iv, ip) += n * xsec_temp(iv, ip);
             for (Index iq = 0; iq < jacobian_quantities_position.nelem();
                  iq++) {
               if (is_frequency_parameter(
                       jacobian_quantities[jacobian_quantities_position[iq]]))
                 dabs_xsec_per_species_dx[i][iq](iv, ip) +=
-                    n * (dxsec_temp_dF[iv] - xsec_temp[iv]) / df;
+                    n * (dxsec_temp_dF(iv, ip) - xsec_temp(iv, ip)) / df;
               else if (jacobian_quantities[jacobian_quantities_position[iq]] ==
                        JacPropMatType::Temperature)
                 dabs_xsec_per_species_dx[i][iq](iv, ip) +=
-                    n * (dxsec_temp_dT[iv] - xsec_temp[iv]) / dt +
-                    xsec_temp[iv] * dn_dT;
+                    n * (dxsec_temp_dT(iv, ip) - xsec_temp(iv, ip)) / dt +
+                    xsec_temp(iv, ip) * dn_dT;
               else if (species_match(jacobian_quantities
                                          [jacobian_quantities_position[iq]],
                                      this_species.BathSpecies()))
                 dabs_xsec_per_species_dx[i][iq](iv, ip) +=
-                    number_density(abs_p[ip], abs_t[ip]) * xsec_temp[iv];
+                    number_density(abs_p[ip], abs_t[ip]) * xsec_temp(iv, ip);
             }
           }
         }
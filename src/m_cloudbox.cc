@@ -60,6 +60,7 @@
 #include "parameters.h"
 #include "physics_funcs.h"
 #include "rte.h"
+#include "scat_database.h"
 #include "sorting.h"
 #include "special_interp.h"
 #include "xml_io.h"
@@ -1500,6 +1501,137 @@ void ScatSpeciesScatAndMetaRead(  //WS Output:
   scat_meta.push_back(std::move(arr_smd));
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ScatElementsDatabaseWrite(  // Keywords:
+    const ArrayOfString& scat_data_files,
+    const ArrayOfString& database_files,
+    const Verbosity& verbosity) {
+  CREATE_OUT3;
+
+  if (database_files.nelem() != scat_data_files.nelem()) {
+    ostringstream os;
+    os << "The number of database files (" << database_files.nelem()
+       << ") must match the number of scattering data files ("
+       << scat_data_files.nelem() << ").";
+    throw runtime_error(os.str());
+  }
+
+  // One element at a time, to never hold more than one in memory
+  for (Index i = 0; i < scat_data_files.nelem(); i++) {
+    SingleScatteringData ssd;
+    ScatteringMetaData smd;
+
+    out3 << "  Read single scattering data file " << scat_data_files[i] << "\n";
+    xml_read_from_file(scat_data_files[i], ssd, verbosity);
+
+    // Same naming conventions of the meta data as ScatSpeciesScatAndMetaRead
+    ArrayOfString strarr;
+    scat_data_files[i].split(strarr, ".xml");
+    String scat_meta_file = strarr[0] + ".meta.xml";
+
+    try {
+      find_xml_file(scat_meta_file, verbosity);
+    } catch (const runtime_error&) {
+    }
+
+    if (!file_exists(scat_meta_file)) {
+      scat_data_files[i].split(strarr, "scat_data");
+      if (strarr.nelem() < 2) {
+        ostringstream os;
+        os << "No meta data file following one of the allowed naming "
+           << "conventions was found.\n"
+           << "Allowed are "
+           << "*.meta.xml from *.xml and "
+           << "*scat_meta* from *scat_data*\n"
+           << "Scattering meta data file not found: " << scat_meta_file;
+        throw runtime_error(os.str());
+      }
+      scat_meta_file = strarr[0] + "scat_meta" + strarr[1];
+    }
+
+    out3 << "  Read scattering meta data\n";
+    xml_read_from_file(scat_meta_file, smd, verbosity);
+    chk_scattering_meta_data(smd, scat_meta_file, verbosity);
+
+    out3 << "  Write scattering database file " << database_files[i] << "\n";
+    scat_database_write(database_files[i], ssd, smd);
+  }
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ScatSpeciesScatAndMetaReadDatabase(  //WS Output:
+    ArrayOfArrayOfSingleScatteringData& scat_data_raw,
+    ArrayOfArrayOfScatteringMetaData& scat_meta,
+    //WS Input:
+    const Vector& f_grid,
+    const Tensor3& t_field,
+    // Keywords:
+    const ArrayOfString& database_files,
+    const Index& interp_order,
+    const Numeric& cache_size,
+    const Verbosity& verbosity) {
+  CREATE_OUT2;
+  CREATE_OUT3;
+
+  if (f_grid.empty()) throw runtime_error("*f_grid* is empty.");
+  if (t_field.empty()) throw runtime_error("*t_field* is empty.");
+  if (interp_order < 1)
+    throw runtime_error("*interp_order* must be at least 1.");
+  if (cache_size < 0) throw runtime_error("*cache_size* must be >= 0.");
+
+  const Numeric f_min = min(f_grid);
+  const Numeric f_max = max(f_grid);
+  const Numeric t_min = min(t_field);
+  const Numeric t_max = max(t_field);
+
+  const ScatDatabaseCacheStats stats_start = scat_database_cache_stats();
+
+  ArrayOfSingleScatteringData arr_ssd(database_files.nelem());
+  ArrayOfScatteringMetaData arr_smd(database_files.nelem());
+  ArrayOfString fail_msg;
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && \
+                             database_files.nelem() > 1)
+  for (Index i = 0; i < database_files.nelem(); i++) {
+    try {
+      out3 << "  Read scattering database file " << database_files[i] << "\n";
+      scat_database_read(arr_ssd[i],
+                         arr_smd[i],
+                         database_files[i],
+                         f_min,
+                         f_max,
+                         t_min,
+                         t_max,
+                         interp_order,
+                         Index(cache_size));
+    } catch (const std::exception& e) {
+      ostringstream os;
+      os << "Run-time error reading scattering data : \n" << e.what();
+#pragma omp critical(ScatSpeciesScatAndMetaReadDatabase_push_fail_msg)
+      fail_msg.push_back(os.str());
+    }
+  }
+
+  if (fail_msg.nelem()) {
+    ostringstream os;
+    for (auto& msg : fail_msg) os << msg << '\n';
+
+    throw runtime_error(os.str());
+  }
+
+  const ScatDatabaseCacheStats stats_end = scat_database_cache_stats();
+  out2 << "  Scattering database records: "
+       << stats_end.hits - stats_start.hits << " from cache, "
+       << stats_end.misses - stats_start.misses << " read from file.\n";
+
+  // check if arrays have same size
+  chk_scattering_data(arr_ssd, arr_smd, verbosity);
+
+  // append as new scattering species
+  scat_data_raw.push_back(std::move(arr_ssd));
+  scat_meta.push_back(std::move(arr_smd));
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void ScatElementsSelect(  //WS Output:
     ArrayOfArrayOfSingleScatteringData& scat_data_raw,
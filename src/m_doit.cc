@@ -61,6 +61,7 @@
 
 extern const Numeric PI;
 extern const Numeric RAD2DEG;
+extern const Numeric DEG2RAD;
 
 /*===========================================================================
   === The functions (in alphabetical order)
@@ -1583,6 +1584,8 @@ void DoitInit(  //WS Output
     Tensor6& doit_scat_field,
     Tensor7& cloudbox_field,
     Index& doit_is_initialized,
+    Tensor3& doit_scat_operator,
+    ArrayOfIndex& doit_scat_operator_info,
     // WS Input
     const Index& stokes_dim,
     const Index& atmosphere_dim,
@@ -1692,6 +1695,8 @@ void DoitInit(  //WS Output
 
   cloudbox_field = NAN;
   doit_scat_field = NAN;
+  doit_scat_operator.resize(0, 0, 0);
+  doit_scat_operator_info.resize(0);
   doit_is_initialized = 1;
 }
 
@@ -2077,6 +2082,98 @@ void DoitWriteIterationFields(  //WS input
   }
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void doit_scat_operatorCalc(  // WS Output:
+    Tensor3& doit_scat_operator,
+    ArrayOfIndex& doit_scat_operator_info,
+    // WS Input:
+    const Tensor7& pha_mat_doit,
+    const Index& f_index,
+    const Index& atmosphere_dim,
+    const Vector& za_grid,
+    const Vector& aa_grid,
+    const Index& doit_za_grid_size,
+    const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  if (atmosphere_dim != 1)
+    throw runtime_error(
+        "*doit_scat_operator* can only be used for 1D atmospheres.");
+
+  const Index Np = pha_mat_doit.nlibraries();
+  const Index Nza = za_grid.nelem();
+  const Index Naa = aa_grid.nelem();
+  const Index stokes_dim = pha_mat_doit.ncols();
+
+  if (doit_za_grid_size != Nza)
+    throw runtime_error(
+        "The zenith angle grids for the computation of\n"
+        "the scattering integral and the RT part must \n"
+        "be equal. Check definitions in \n"
+        "*DOAngularGridsSet*. The keyword \n"
+        "'za_grid_opt_file' should be empty. \n");
+
+  if (pha_mat_doit.nvitrines() != Nza || pha_mat_doit.npages() < Naa) {
+    ostringstream os;
+    os << "The size of *pha_mat_doit* does not match *za_grid* and\n"
+       << "*aa_grid*. *doit_scat_operatorCalc* must be called after\n"
+       << "*DoitScatteringDataPrepare*.";
+    throw runtime_error(os.str());
+  }
+
+  // Quadrature weights of the incoming directions, matching the
+  // integration in doit_scat_fieldCalc
+  Matrix weights(Nza, Naa, 0.);
+  if (Naa == 1) {
+    // AngIntegrate_trapezoid divided by 2*PI
+    for (Index za_in = 0; za_in < Nza - 1; za_in++) {
+      const Numeric w = 0.5 * DEG2RAD * (za_grid[za_in + 1] - za_grid[za_in]);
+      weights(za_in, 0) += w * sin(za_grid[za_in] * DEG2RAD);
+      weights(za_in + 1, 0) += w * sin(za_grid[za_in + 1] * DEG2RAD);
+    }
+  } else {
+    // AngIntegrate_trapezoid_opti
+    const Numeric stepsize_za = 180. / (Numeric)(doit_za_grid_size - 1);
+    const Numeric stepsize_aa = 360. / (Numeric)(Naa - 1);
+    for (Index za_in = 0; za_in < Nza; za_in++) {
+      for (Index aa_in = 0; aa_in < Naa; aa_in++) {
+        weights(za_in, aa_in) =
+            (za_in == 0 || za_in == Nza - 1 ? 1 : 2) *
+            (aa_in == 0 || aa_in == Naa - 1 ? 1 : 2) * 0.25 * DEG2RAD *
+            DEG2RAD * stepsize_za * stepsize_aa * sin(za_grid[za_in] * DEG2RAD);
+      }
+    }
+  }
+
+  out2 << "  Assemble the scattering operator ("
+       << Np * Nza * stokes_dim * Nza * stokes_dim * sizeof(Numeric) / 1000000
+       << " MB)\n";
+
+  // Rows are outgoing (za, stokes), columns incoming (za, stokes), the
+  // ordering of a profile of *cloudbox_field_mono* and *doit_scat_field*
+  doit_scat_operator.resize(Np, Nza * stokes_dim, Nza * stokes_dim);
+  doit_scat_operator = 0;
+
+  for (Index p_index = 0; p_index < Np; p_index++) {
+    for (Index za_out = 0; za_out < Nza; za_out++) {
+      for (Index za_in = 0; za_in < Nza; za_in++) {
+        for (Index aa_in = 0; aa_in < Naa; aa_in++) {
+          const Numeric w = weights(za_in, aa_in);
+          for (Index i = 0; i < stokes_dim; i++) {
+            for (Index j = 0; j < stokes_dim; j++) {
+              doit_scat_operator(
+                  p_index, za_out * stokes_dim + i, za_in * stokes_dim + j) +=
+                  w * pha_mat_doit(p_index, za_out, 0, za_in, aa_in, i, j);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  doit_scat_operator_info = ArrayOfIndex{f_index, Np, Nza, Naa, stokes_dim};
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void doit_scat_fieldCalc(Workspace& ws,
                          // WS Output and Input
@@ -2092,6 +2189,9 @@ void doit_scat_fieldCalc(Workspace& ws,
                          const Vector& aa_grid,
                          const Index& doit_za_grid_size,
                          const Tensor7& pha_mat_doit,
+                         const Tensor3& doit_scat_operator,
+                         const ArrayOfIndex& doit_scat_operator_info,
+                         const Index& f_index,
                          const Verbosity& verbosity)
 
 {
@@ -2207,7 +2307,34 @@ void doit_scat_fieldCalc(Workspace& ws,
 
   out2 << "  Calculate the scattered field\n";
 
-  if (atmosphere_dim == 1) {
+  if (atmosphere_dim == 1 && !doit_scat_operator.empty()) {
+    const Index Np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+    const ArrayOfIndex info{f_index, Np, Nza, Naa, stokes_dim};
+    if (doit_scat_operator_info != info ||
+        !is_size(doit_scat_operator, Np, Nza * stokes_dim, Nza * stokes_dim))
+      throw runtime_error(
+          "*doit_scat_operator* does not match *f_index*, the cloudbox,\n"
+          "*za_grid*, *aa_grid* or *stokes_dim*. Is *doit_scat_operatorCalc*\n"
+          "called after *DoitScatteringDataPrepare* in *doit_mono_agenda*?");
+
+    // One matrix-vector product per level
+#pragma omp parallel for if (!arts_omp_in_parallel() && Np > 1)
+    for (Index p_index = 0; p_index < Np; p_index++) {
+      Vector field_in(Nza * stokes_dim);
+      Vector field_out(Nza * stokes_dim);
+      for (Index za_in = 0; za_in < Nza; za_in++)
+        for (Index j = 0; j < stokes_dim; j++)
+          field_in[za_in * stokes_dim + j] =
+              cloudbox_field_mono(p_index, 0, 0, za_in, 0, j);
+
+      mult(field_out, doit_scat_operator(p_index, joker, joker), field_in);
+
+      for (Index za_out = 0; za_out < Nza; za_out++)
+        for (Index i = 0; i < stokes_dim; i++)
+          doit_scat_field(p_index, 0, 0, za_out, 0, i) =
+              field_out[za_out * stokes_dim + i];
+    }
+  } else if (atmosphere_dim == 1) {
     // Get pha_mat at the grid positions
     // Since atmosphere_dim = 1, there is no loop over lat and lon grids
     for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
@@ -32,6 +32,7 @@
 #include <string>
 #include "absorption.h"
 #include "arts.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
 #include "cloudbox.h"
@@ -41,6 +42,7 @@
 #include "math_funcs.h"
 #include "messages.h"
 #include "physics_funcs.h"
+#include "ppath.h"
 #include "rte.h"
 
 extern const Numeric PI;
@@ -2081,6 +2083,66 @@ void jacobianSetFuncTransformation(ArrayOfRetrievalQuantity& jqs,
 // Methods for doing perturbations
 //----------------------------------------------------------------------------
 
+//! Perturbation of an atmospheric field for one retrieval grid point
+/*!
+  Maps a unit perturbation at one point of the retrieval grids to the
+  atmospheric grids. For mode "absolute" the returned field shall be added
+  to the original field, for mode "relative" it is a multiplicative
+  factor.
+
+  \param[out] pert          Perturbation at the atmospheric grids.
+  \param[in]  atmosphere_dim As the WSV.
+  \param[in]  gp_p          Mapping from retrieval to atmospheric pressure grid.
+  \param[in]  gp_lat        Mapping from retrieval to atmospheric latitude grid.
+  \param[in]  gp_lon        Mapping from retrieval to atmospheric longitude grid.
+  \param[in]  n_p           Length of pressure retrieval grid.
+  \param[in]  n_lat         Length of latitude retrieval grid (1 for 1D).
+  \param[in]  n_lon         Length of longitude retrieval grid (1 for 1D/2D).
+  \param[in]  pert_index    Index of the perturbed retrieval grid point.
+  \param[in]  pert_size     Size of perturbation.
+  \param[in]  pert_mode     "absolute" or "relative".
+*/
+void atm_field_perturbation(Tensor3& pert,
+                            const Index& atmosphere_dim,
+                            const ArrayOfGridPos& gp_p,
+                            const ArrayOfGridPos& gp_lat,
+                            const ArrayOfGridPos& gp_lon,
+                            const Index& n_p,
+                            const Index& n_lat,
+                            const Index& n_lon,
+                            const Index& pert_index,
+                            const Numeric& pert_size,
+                            const String& pert_mode) {
+  if (pert_index<0){
+    throw runtime_error("Bad *pert_index*. It is negative.");
+  }
+  const Index n_tot = n_p * n_lat * n_lon;
+  if (pert_index >= n_tot){
+    throw runtime_error("Bad *pert_index*. It is too high with respect "
+                        "to length of retrieval grids.");
+  }    
+  
+  // Create x-vector that matches perturbation
+  Vector x(n_tot);
+  if (pert_mode == "absolute" ){
+    x = 0;
+    x[pert_index] = pert_size;
+  }
+  else if (pert_mode == "relative" ){
+    x = 1;
+    x[pert_index] += pert_size;
+  }
+  else{
+    throw runtime_error("Bad *pert_mode*. Allowed choices are: "
+                        """absolute"" and ""relative"".");
+  }
+  
+  // Map x to a perturbation defined at atmospheric grids
+  Tensor3 x3d(n_p, n_lat, n_lon);
+  reshape(x3d, x);
+  regrid_atmfield_by_gp_oem(pert, atmosphere_dim, x3d, gp_p, gp_lat, gp_lon);
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void AtmFieldPerturb(Tensor3& perturbed_field,
                     const Index& atmosphere_dim,
@@ -2129,35 +2191,19 @@ void AtmFieldPerturb(Tensor3& perturbed_field,
                         lat_grid,
                         lon_grid);
 
-  // Now we can chec *pert_index*
-  if (pert_index<0){
-    throw runtime_error("Bad *pert_index*. It is negative.");
-  }
-  const Index n_tot = n_p * n_lat * n_lon;
-  if (pert_index >= n_tot){
-    throw runtime_error("Bad *pert_index*. It is too high with respect "
-                        "to length of retrieval grids.");
-  }    
-  
-  // Create x-vector that matches perturbation
-  Vector x(n_tot);
-  if (pert_mode == "absolute" ){
-    x = 0;
-    x[pert_index] = pert_size;
-  }
-  else if (pert_mode == "relative" ){
-    x = 1;
-    x[pert_index] += pert_size;
-  }
-  else{
-    throw runtime_error("Bad *pert_mode*. Allowed choices are: "
-                        """absolute"" and ""relative"".");
-  }
-  
-  // Map x to a perturbation defined at atmospheric grids
-  Tensor3 x3d(n_p, n_lat, n_lon), pert(n_p, n_lat, n_lon);
-  reshape(x3d, x);
-  regrid_atmfield_by_gp_oem(pert, atmosphere_dim, x3d, gp_p, gp_lat, gp_lon);
+  // Get perturbation at atmospheric grids (includes check of *pert_index*)
+  Tensor3 pert;
+  atm_field_perturbation(pert,
+                         atmosphere_dim,
+                         gp_p,
+                         gp_lat,
+                         gp_lon,
+                         n_p,
+                         n_lat,
+                         n_lon,
+                         pert_index,
+                         pert_size,
+                         pert_mode);
   
   // Init perturbed_field, if not equal to original_field
   if (&perturbed_field != &original_field) {
@@ -2284,6 +2330,197 @@ void jacobianFromYbatch(Matrix& jacobian,
   jacobian /= pert_size;
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void jacobianFromPerturbations(Workspace& ws,
+                               Matrix& jacobian,
+                               const Vector& y,
+                               const Index& atmosphere_dim,
+                               const Vector& p_grid,
+                               const Vector& lat_grid,
+                               const Vector& lon_grid,
+                               const Tensor3& t_field,
+                               const Tensor4& vmr_field,
+                               const ArrayOfArrayOfSpeciesTag& abs_species,
+                               const Agenda& ybatch_calc_agenda,
+                               const String& quantity,
+                               const Vector& p_ret_grid,
+                               const Vector& lat_ret_grid,
+                               const Vector& lon_ret_grid,
+                               const Numeric& pert_size,
+                               const String& pert_mode,
+                               const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  // Determine what field to perturb
+  const bool do_t = quantity == "Temperature";
+  Index iq = -1;
+  if (!do_t) {
+    const Index species = SpeciesTag(quantity).Species();
+    for (Index i = 0; i < abs_species.nelem(); i++) {
+      if (abs_species[i][0].Species() == species) {
+        iq = i;
+        break;
+      }
+    }
+    if (iq < 0) {
+      ostringstream os;
+      os << "Could not find " << quantity << " in *abs_species*.\n";
+      throw std::runtime_error(os.str());
+    }
+  }
+
+  // Input checks
+  if (do_t) {
+    chk_atm_field(
+        "t_field", t_field, atmosphere_dim, p_grid, lat_grid, lon_grid);
+  } else {
+    chk_atm_field("vmr_field",
+                  vmr_field,
+                  atmosphere_dim,
+                  abs_species.nelem(),
+                  p_grid,
+                  lat_grid,
+                  lon_grid);
+  }
+  if (pert_mode != "absolute" && pert_mode != "relative") {
+    throw runtime_error("Bad *pert_mode*. Allowed choices are: "
+                        """absolute"" and ""relative"".");
+  }
+
+  // Mapping from retrieval grids to atmospheric grids. Common to all
+  // perturbations and thus only done once.
+  ArrayOfVector ret_grids(atmosphere_dim);
+  ret_grids[0] = p_ret_grid;
+  if (atmosphere_dim > 1) {
+    ret_grids[1] = lat_ret_grid;
+    if (atmosphere_dim > 2) {
+      ret_grids[2] = lon_ret_grid;
+    }
+  }
+  ArrayOfGridPos gp_p, gp_lat, gp_lon;
+  Index n_p, n_lat, n_lon;
+  get_gp_rq_to_atmgrids(gp_p,
+                        gp_lat,
+                        gp_lon,
+                        n_p,
+                        n_lat,
+                        n_lon,
+                        ret_grids,
+                        atmosphere_dim,
+                        p_grid,
+                        lat_grid,
+                        lon_grid);
+  const Index n_tot = n_p * n_lat * n_lon;
+
+  const Index ny = y.nelem();
+  jacobian.resize(ny, n_tot);
+
+  // The perturbed field is put on top of the WSV stack of a local copy of
+  // the workspace, and the unperturbed field below is left untouched.
+  // Each thread has its own copy of the workspace and the field.
+  const Index wsv_id = get_wsv_id(do_t ? "t_field" : "vmr_field");
+  Workspace l_ws(ws);
+  Agenda l_ybatch_calc_agenda(ybatch_calc_agenda);
+
+  // The geometry is not perturbed, and the propagation paths calculated
+  // for the first perturbations can be used for all others. One path per
+  // element of y is an upper limit for the number of pencil beams.
+  const PpathCacheActivation ppath_cache_activation(ny);
+
+  ArrayOfString fail_msg;
+  bool failed = false;
+
+  if (n_tot)
+#pragma omp parallel for schedule(dynamic) if (!arts_omp_in_parallel() && \
+                                               n_tot > 1)                 \
+    firstprivate(l_ws, l_ybatch_calc_agenda)
+    for (Index ipert = 0; ipert < n_tot; ipert++) {
+      if (failed) continue;
+
+      try {
+        {
+          ostringstream os;
+          os << "  Perturbation " << ipert + 1 << " of " << n_tot
+             << ", Thread-Id " << arts_omp_get_thread_num() << "\n";
+          out2 << os.str();
+        }
+
+        Tensor3 pert;
+        atm_field_perturbation(pert,
+                               atmosphere_dim,
+                               gp_p,
+                               gp_lat,
+                               gp_lon,
+                               n_p,
+                               n_lat,
+                               n_lon,
+                               ipert,
+                               pert_size,
+                               pert_mode);
+
+        Tensor3 t_pert;
+        Tensor4 vmr_pert;
+        if (do_t) {
+          t_pert = t_field;
+          if (pert_mode == "absolute") {
+            t_pert += pert;
+          } else {
+            t_pert *= pert;
+          }
+          l_ws.push(wsv_id, (void*)&t_pert);
+        } else {
+          vmr_pert = vmr_field;
+          if (pert_mode == "absolute") {
+            vmr_pert(iq, joker, joker, joker) += pert;
+          } else {
+            vmr_pert(iq, joker, joker, joker) *= pert;
+          }
+          l_ws.push(wsv_id, (void*)&vmr_pert);
+        }
+
+        Vector y_pert;
+        ArrayOfVector y_aux;
+        Matrix jacobian_pert;
+        try {
+          ybatch_calc_agendaExecute(
+              l_ws, y_pert, y_aux, jacobian_pert, ipert, l_ybatch_calc_agenda);
+        } catch (const std::exception&) {
+          l_ws.pop(wsv_id);
+          throw;
+        }
+        l_ws.pop(wsv_id);
+
+        if (y_pert.nelem() != ny) {
+          ostringstream os;
+          os << "Inconsistency in length of *y* and the spectrum "
+             << "calculated for perturbation " << ipert << ".\n"
+             << "Length of *y*: " << ny << "\n"
+             << "Length of perturbed spectrum: " << y_pert.nelem() << "\n";
+          throw runtime_error(os.str());
+        }
+
+        for (Index i = 0; i < ny; i++) {
+          jacobian(i, ipert) = (y_pert[i] - y[i]) / pert_size;
+        }
+      } catch (const std::exception& e) {
+#pragma omp critical(jacobianFromPerturbations_fail)
+        {
+          failed = true;
+          ostringstream os;
+          os << "Run-time error for perturbation " << ipert << ":\n"
+             << e.what();
+          fail_msg.push_back(os.str());
+        }
+      }
+    }
+
+  if (fail_msg.nelem()) {
+    ostringstream os;
+    for (const auto& msg : fail_msg) os << msg << '\n';
+    throw runtime_error(os.str());
+  }
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void particle_bulkprop_fieldPerturb(Tensor4& particle_bulkprop_field,
                                     const Index& atmosphere_dim,
@@ -1080,62 +1080,57 @@ void x2artsSpectroscopy(const Verbosity&) {
 
 
 #ifdef OEM_SUPPORT
-/* Workspace method: Doxygen documentation will be auto-generated */
-void OEM(Workspace& ws,
-         Vector& x,
-         Vector& yf,
-         Matrix& jacobian,
-         Matrix& dxdy,
-         Vector& oem_diagnostics,
-         Vector& lm_ga_history,
-         ArrayOfString& errors,
-         const Vector& xa,
-         const CovarianceMatrix& covmat_sx,
-         const Vector& y,
-         const CovarianceMatrix& covmat_se,
-         const ArrayOfRetrievalQuantity& jacobian_quantities,
-         const Agenda& inversion_iterate_agenda,
-         const String& method,
-         const Numeric& max_start_cost,
-         const Vector& x_norm,
-         const Index& max_iter,
-         const Numeric& stop_dx,
-         const Vector& lm_ga_settings,
-         const Index& clear_matrices,
-         const Index& display_progress,
-         const Verbosity&) {
+/** OEM inversion without the checks of the input.
+ *
+ * Does the work of the OEM WSM, and of OEMBatch for each profile, after
+ * OEM_checks has been passed and the inverses of the covariance matrices
+ * have been computed. See the OEM WSM for the arguments.
+ */
+void OEM_unchecked(Workspace& ws,
+                   Vector& x,
+                   Vector& yf,
+                   Matrix& jacobian,
+                   Matrix& dxdy,
+                   Vector& oem_diagnostics,
+                   Vector& lm_ga_history,
+                   ArrayOfString& errors,
+                   const Vector& xa,
+                   const CovarianceMatrix& covmat_sx,
+                   const Vector& y,
+                   const CovarianceMatrix& covmat_se,
+                   const Agenda& inversion_iterate_agenda,
+                   const String& method,
+                   const Numeric& max_start_cost,
+                   const Vector& x_norm,
+                   const Index& max_iter,
+                   const Numeric& stop_dx,
+                   const Vector& lm_ga_settings,
+                   const Index& clear_matrices,
+                   const Index& display_progress,
+                   const Vector& broyden_settings) {
   // Main sizes
   const Index n = covmat_sx.nrows();
   const Index m = y.nelem();
 
-  // Checks
-  covmat_sx.compute_inverse();
-  covmat_se.compute_inverse();
+  const bool broyden = (method == "gn_broyden") || (method == "lm_broyden");
 
-  OEM_checks(ws,
-             x,
-             yf,
-             jacobian,
-             inversion_iterate_agenda,
-             xa,
-             covmat_sx,
-             y,
-             covmat_se,
-             jacobian_quantities,
-             method,
-             x_norm,
-             max_iter,
-             stop_dx,
-             lm_ga_settings,
-             clear_matrices,
-             display_progress);
+  // If necessary compute yf and jacobian.
+  if (x.nelem() == 0) {
+    x = xa;
+    inversion_iterate_agendaExecute(
+        ws, yf, jacobian, xa, 1, 0, inversion_iterate_agenda);
+  }
+  if ((yf.nelem() == 0) || (jacobian.empty())) {
+    inversion_iterate_agendaExecute(
+        ws, yf, jacobian, x, 1, 0, inversion_iterate_agenda);
+  }
 
   // Size diagnostic output and init with NaNs
   oem_diagnostics.resize(5);
   oem_diagnostics = NAN;
   //
   if (method == "ml" || method == "lm" || method == "ml_cg" ||
-      method == "lm_cg") {
+      method == "lm_cg" || method == "lm_broyden") {
     lm_ga_history.resize(max_iter + 1);
     lm_ga_history = NAN;
   } else {
@@ -1217,6 +1212,21 @@ void OEM(Workspace& ws,
                           jacobian,
                           yf,
                           &inversion_iterate_agenda);
+    oem::AgendaWrapper* broyden_model = nullptr;
+    if (broyden) {
+      aw.set_broyden_updates(
+          static_cast<Index>(broyden_settings[0]),
+          broyden_settings[1],
+          [&](ConstVectorView xi, ConstVectorView yi) {
+            Vector dy(y), sdy(m), dx(xi), sdx(n);
+            dy -= yi;
+            solve(sdy, covmat_se, dy);
+            dx -= xa;
+            solve(sdx, covmat_sx, dx);
+            return (dx * sdx + dy * sdy) / static_cast<Numeric>(m);
+          });
+      broyden_model = &aw;
+    }
     oem::OEM_STANDARD<oem::AgendaWrapper> oem(aw, xa_oem, Sa, Se);
     oem::OEM_MFORM<oem::AgendaWrapper> oem_m(aw, xa_oem, Sa, Se);
     int oem_verbosity = static_cast<int>(display_progress);
@@ -1248,11 +1258,16 @@ void OEM(Workspace& ws,
         return_code = oem_m.compute<oem::GN_CG, oem::ArtsLog>(
             x_oem, y_oem, gn, oem_verbosity, lm_ga_history, true);
         oem_diagnostics[0] = static_cast<Index>(return_code);
-      } else if (method == "gn") {
+      } else if ((method == "gn") || (method == "gn_broyden")) {
         oem::Std s(T, apply_norm);
         oem::GN gn(stop_dx, (unsigned int)max_iter, s);
-        return_code = oem.compute<oem::GN, oem::ArtsLog>(
-            x_oem, y_oem, gn, oem_verbosity, lm_ga_history);
+        return_code = oem.compute<oem::GN, oem::ArtsLog>(x_oem,
+                                                         y_oem,
+                                                         gn,
+                                                         oem_verbosity,
+                                                         lm_ga_history,
+                                                         false,
+                                                         broyden_model);
         oem_diagnostics[0] = static_cast<Index>(return_code);
       } else if (method == "gn_m") {
         oem::Std s(T, apply_norm);
@@ -1272,7 +1287,8 @@ void OEM(Workspace& ws,
         return_code = oem_m.compute<oem::GN_CG, oem::ArtsLog>(
             x_oem, y_oem, gn, oem_verbosity, lm_ga_history);
         oem_diagnostics[0] = static_cast<Index>(return_code);
-      } else if ((method == "lm") || (method == "ml")) {
+      } else if ((method == "lm") || (method == "ml") ||
+                 (method == "lm_broyden")) {
         oem::Std s(T, apply_norm);
         Sparse diagonal = Sparse::diagonal(covmat_sx.inverse_diagonal());
         CovarianceMatrix SaDiag{};
@@ -1292,8 +1308,13 @@ void OEM(Workspace& ws,
         lm.set_lambda_threshold(lm_ga_settings[4]);
         lm.set_lambda_constraint(lm_ga_settings[5]);
 
-        return_code = oem.compute<oem::LM&, oem::ArtsLog>(
-            x_oem, y_oem, lm, oem_verbosity, lm_ga_history);
+        return_code = oem.compute<oem::LM&, oem::ArtsLog>(x_oem,
+                                                          y_oem,
+                                                          lm,
+                                                          oem_verbosity,
+                                                          lm_ga_history,
+                                                          false,
+                                                          broyden_model);
         oem_diagnostics[0] = static_cast<Index>(return_code);
         if (lm.get_lambda() > lm.get_lambda_maximum()) {
           oem_diagnostics[0] = 2;
@@ -1364,6 +1385,246 @@ void OEM(Workspace& ws,
   }
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void OEM(Workspace& ws,
+         Vector& x,
+         Vector& yf,
+         Matrix& jacobian,
+         Matrix& dxdy,
+         Vector& oem_diagnostics,
+         Vector& lm_ga_history,
+         ArrayOfString& errors,
+         const Vector& xa,
+         const CovarianceMatrix& covmat_sx,
+         const Vector& y,
+         const CovarianceMatrix& covmat_se,
+         const ArrayOfRetrievalQuantity& jacobian_quantities,
+         const Agenda& inversion_iterate_agenda,
+         const String& method,
+         const Numeric& max_start_cost,
+         const Vector& x_norm,
+         const Index& max_iter,
+         const Numeric& stop_dx,
+         const Vector& lm_ga_settings,
+         const Index& clear_matrices,
+         const Index& display_progress,
+         const Vector& broyden_settings,
+         const Verbosity&) {
+  // Checks
+  covmat_sx.compute_inverse();
+  covmat_se.compute_inverse();
+
+  OEM_checks(x,
+             yf,
+             jacobian,
+             xa,
+             covmat_sx,
+             y,
+             covmat_se,
+             jacobian_quantities,
+             method,
+             x_norm,
+             max_iter,
+             stop_dx,
+             lm_ga_settings,
+             clear_matrices,
+             display_progress,
+             broyden_settings);
+
+  OEM_unchecked(ws,
+                x,
+                yf,
+                jacobian,
+                dxdy,
+                oem_diagnostics,
+                lm_ga_history,
+                errors,
+                xa,
+                covmat_sx,
+                y,
+                covmat_se,
+                inversion_iterate_agenda,
+                method,
+                max_start_cost,
+                x_norm,
+                max_iter,
+                stop_dx,
+                lm_ga_settings,
+                clear_matrices,
+                display_progress,
+                broyden_settings);
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void OEMBatch(Workspace& ws,
+              ArrayOfString& errors,
+              Matrix& x_batch,
+              Matrix& yf_batch,
+              Tensor3& jacobian_batch,
+              Tensor3& dxdy_batch,
+              Matrix& oem_diagnostics_batch,
+              const CovarianceMatrix& covmat_sx,
+              const CovarianceMatrix& covmat_se,
+              const ArrayOfRetrievalQuantity& jacobian_quantities,
+              const Agenda& inversion_iterate_agenda,
+              const Matrix& y_batch,
+              const Matrix& xa_batch,
+              const String& method,
+              const Numeric& max_start_cost,
+              const Vector& x_norm,
+              const Index& max_iter,
+              const Numeric& stop_dx,
+              const Vector& lm_ga_settings,
+              const Index& clear_matrices,
+              const Vector& broyden_settings,
+              const Verbosity& verbosity) {
+  CREATE_OUTS;
+
+  // Main sizes
+  const Index nprofiles = y_batch.nrows();
+  const Index n = covmat_sx.nrows();
+  const Index m = covmat_se.nrows();
+
+  if (y_batch.ncols() != m) {
+    ostringstream os;
+    os << "The number of columns of *y_batch* must match *covmat_se*.\n"
+       << "Columns of *y_batch*: " << y_batch.ncols() << "\n"
+       << "Size of *covmat_se*: " << m << "\n";
+    throw runtime_error(os.str());
+  }
+  if (xa_batch.nrows() != nprofiles || xa_batch.ncols() != n) {
+    ostringstream os;
+    os << "*xa_batch* must have one row per row of *y_batch*, and one\n"
+       << "column per row of *covmat_sx*.\n"
+       << "Size of *xa_batch*: " << xa_batch.nrows() << " x "
+       << xa_batch.ncols() << "\n"
+       << "Expected size: " << nprofiles << " x " << n << "\n";
+    throw runtime_error(os.str());
+  }
+
+  // The checks do not depend on the profile and are done once, before the
+  // threads are started. So are the inverses of the covariance matrices,
+  // that are stored by the matrices themselves.
+  covmat_sx.compute_inverse();
+  covmat_se.compute_inverse();
+  {
+    Vector x, yf;
+    Matrix jacobian;
+    OEM_checks(x,
+               yf,
+               jacobian,
+               Vector(n, 0),
+               covmat_sx,
+               Vector(m, 0),
+               covmat_se,
+               jacobian_quantities,
+               method,
+               x_norm,
+               max_iter,
+               stop_dx,
+               lm_ga_settings,
+               clear_matrices,
+               0,
+               broyden_settings);
+  }
+
+  // Init output with NaNs, left for profiles that fail
+  x_batch.resize(nprofiles, n);
+  x_batch = NAN;
+  yf_batch.resize(nprofiles, m);
+  yf_batch = NAN;
+  oem_diagnostics_batch.resize(nprofiles, 5);
+  oem_diagnostics_batch = NAN;
+  if (clear_matrices) {
+    jacobian_batch.resize(0, 0, 0);
+    dxdy_batch.resize(0, 0, 0);
+  } else {
+    jacobian_batch.resize(nprofiles, m, n);
+    jacobian_batch = NAN;
+    dxdy_batch.resize(nprofiles, n, m);
+    dxdy_batch = NAN;
+  }
+
+  ArrayOfArrayOfString profile_errors(nprofiles);
+
+  // We have to make a local copy of the Workspace and the agendas because
+  // only non-reference types can be declared firstprivate in OpenMP
+  Workspace l_ws(ws);
+  Agenda l_inversion_iterate_agenda(inversion_iterate_agenda);
+
+#pragma omp parallel for schedule(dynamic) if (!arts_omp_in_parallel() && \
+                                               nprofiles > 1)             \
+    firstprivate(l_ws, l_inversion_iterate_agenda)
+  for (Index i = 0; i < nprofiles; i++) {
+    {
+      ostringstream os;
+      os << "  Profile " << i << " of " << nprofiles << ", Thread-Id "
+         << arts_omp_get_thread_num() << "\n";
+      out2 << os.str();
+    }
+
+    try {
+      Vector x, yf, oem_diagnostics, lm_ga_history;
+      Matrix jacobian, dxdy;
+      const Vector xa = xa_batch(i, joker);
+      const Vector y = y_batch(i, joker);
+
+      OEM_unchecked(l_ws,
+                    x,
+                    yf,
+                    jacobian,
+                    dxdy,
+                    oem_diagnostics,
+                    lm_ga_history,
+                    profile_errors[i],
+                    xa,
+                    covmat_sx,
+                    y,
+                    covmat_se,
+                    l_inversion_iterate_agenda,
+                    method,
+                    max_start_cost,
+                    x_norm,
+                    max_iter,
+                    stop_dx,
+                    lm_ga_settings,
+                    clear_matrices,
+                    0,
+                    broyden_settings);
+
+      // Each profile has its own row, no synchronisation needed
+      oem_diagnostics_batch(i, joker) = oem_diagnostics;
+      if (x.nelem() == n) x_batch(i, joker) = x;
+      if (yf.nelem() == m) yf_batch(i, joker) = yf;
+      if (!clear_matrices) {
+        if (jacobian.nrows() == m && jacobian.ncols() == n)
+          jacobian_batch(i, joker, joker) = jacobian;
+        if (dxdy.nrows() == n && dxdy.ncols() == m)
+          dxdy_batch(i, joker, joker) = dxdy;
+      }
+    } catch (const std::exception& e) {
+      oem_diagnostics_batch(i, 0) = 9;
+      profile_errors[i].push_back(e.what());
+    }
+  }
+
+  // Collect the errors, tagged by profile
+  errors.resize(0);
+  Index nfailed = 0;
+  for (Index i = 0; i < nprofiles; i++) {
+    if (oem_diagnostics_batch(i, 0) == 9) nfailed++;
+    for (const auto& e : profile_errors[i]) {
+      ostringstream os;
+      os << "Profile " << i << ": " << e;
+      errors.push_back(os.str());
+    }
+  }
+  if (nfailed) {
+    out1 << "  OEM failed for " << nfailed << " of " << nprofiles
+         << " profiles, see *oem_errors*.\n";
+  }
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void covmat_soCalc(Matrix& covmat_so,
                    const Matrix& dxdy,
@@ -1495,11 +1756,39 @@ void OEM(Workspace&,
          const Vector&,
          const Index&,
          const Index&,
+         const Vector&,
          const Verbosity&) {
   throw runtime_error(
       "WSM is not available because ARTS was compiled without "
       "OEM support.");
 }
+
+void OEMBatch(Workspace&,
+              ArrayOfString&,
+              Matrix&,
+              Matrix&,
+              Tensor3&,
+              Tensor3&,
+              Matrix&,
+              const CovarianceMatrix&,
+              const CovarianceMatrix&,
+              const ArrayOfRetrievalQuantity&,
+              const Agenda&,
+              const Matrix&,
+              const Matrix&,
+              const String&,
+              const Numeric&,
+              const Vector&,
+              const Index&,
+              const Numeric&,
+              const Vector&,
+              const Index&,
+              const Vector&,
+              const Verbosity&) {
+  throw runtime_error(
+      "WSM is not available because ARTS was compiled without "
+      "OEM support.");
+}
 #endif
 
 #if defined(OEM_SUPPORT) && 0
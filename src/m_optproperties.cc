@@ -129,6 +129,9 @@ void pha_mat_sptFromData(  // Output:
   // [frequency, za_inc, aa_inc, stokes_dim, stokes_dim]
   Tensor5 pha_mat_data_int;
 
+  // Transformation table, shared by scattering elements with the same grids
+  PhaMatTransformTable pha_mat_table;
+
   Index i_se_flat = 0;
   // Loop over scattering species
   for (Index i_ss = 0; i_ss < N_ss; i_ss++) {
@@ -246,25 +249,25 @@ void pha_mat_sptFromData(  // Output:
         }
 
         // Do the transformation into the laboratory coordinate system.
-        for (Index za_inc_idx = 0; za_inc_idx < za_grid.nelem();
-             za_inc_idx++) {
-          for (Index aa_inc_idx = 0; aa_inc_idx < aa_grid.nelem();
-               aa_inc_idx++) {
-            pha_matTransform(
-                pha_mat_spt(i_se_flat, za_inc_idx, aa_inc_idx, joker, joker),
-                pha_mat_data_int,
-                ZA_DATAGRID,
-                AA_DATAGRID,
-                PART_TYPE,
-                za_index,
-                aa_index,
-                za_inc_idx,
-                aa_inc_idx,
-                za_grid,
-                aa_grid,
-                verbosity);
-          }
-        }
+        pha_mat_transform_tableCalc(pha_mat_table,
+                                    ZA_DATAGRID,
+                                    AA_DATAGRID,
+                                    PART_TYPE,
+                                    za_grid[Range(za_index, 1)],
+                                    aa_grid[Range(aa_index, 1)],
+                                    za_grid,
+                                    aa_grid);
+        pha_matTransformTabulated(
+            pha_mat_spt(i_se_flat,
+                        Range(0, za_grid.nelem()),
+                        Range(0, aa_grid.nelem()),
+                        joker,
+                        joker),
+            pha_mat_data_int,
+            pha_mat_table,
+            0,
+            0,
+            verbosity);
       }
       i_se_flat++;
     }
@@ -1408,6 +1411,8 @@ void DoitScatteringDataPrepare(
   // contains a WS method that requires it as input
   pha_mat_sptDOITOpt.resize(TotalNumberOfElements(scat_data));
 
+  PhaMatTransformTable pha_mat_table;
+
   Index i_se_flat = 0;
   for (Index i_ss = 0; i_ss < N_ss; i_ss++) {
     const Index N_se = scat_data[i_ss].nelem();
@@ -1426,39 +1431,32 @@ void DoitScatteringDataPrepare(
       pha_mat_sptDOITOpt[i_se_flat] = 0.;
 
       // Calculate all scattering angles for all combinations of incoming
-      // and scattered directions and interpolation.
+      // and scattered directions and interpolation. The angles only
+      // depend on the grids, and are shared by the temperatures and
+      // elements with the same grids.
+      pha_mat_transform_tableCalc(pha_mat_table,
+                                  scat_data_mono[i_ss][i_se].za_grid,
+                                  scat_data_mono[i_ss][i_se].aa_grid,
+                                  scat_data_mono[i_ss][i_se].ptype,
+                                  za_grid,
+                                  aa_grid[Range(0, N_aa_sca)],
+                                  za_grid,
+                                  aa_grid);
       for (Index t_idx = 0; t_idx < N_T; t_idx++) {
         // These are the scattered directions as called in *scat_field_calc*
         for (Index za_sca_idx = 0; za_sca_idx < doit_za_grid_size;
              za_sca_idx++) {
           for (Index aa_sca_idx = 0; aa_sca_idx < N_aa_sca; aa_sca_idx++) {
             // Integration is performed over all incoming directions
-            for (Index za_inc_idx = 0; za_inc_idx < doit_za_grid_size;
-                 za_inc_idx++) {
-              for (Index aa_inc_idx = 0; aa_inc_idx < aa_grid.nelem();
-                   aa_inc_idx++) {
-                pha_matTransform(
-                    pha_mat_sptDOITOpt[i_se_flat](t_idx,
-                                                  za_sca_idx,
-                                                  aa_sca_idx,
-                                                  za_inc_idx,
-                                                  aa_inc_idx,
-                                                  joker,
-                                                  joker),
-                    scat_data_mono[i_ss][i_se].pha_mat_data(
-                        0, t_idx, joker, joker, joker, joker, joker),
-                    scat_data_mono[i_ss][i_se].za_grid,
-                    scat_data_mono[i_ss][i_se].aa_grid,
-                    scat_data_mono[i_ss][i_se].ptype,
-                    za_sca_idx,
-                    aa_sca_idx,
-                    za_inc_idx,
-                    aa_inc_idx,
-                    za_grid,
-                    aa_grid,
-                    verbosity);
-              }
-            }
+            pha_matTransformTabulated(
+                pha_mat_sptDOITOpt[i_se_flat](
+                    t_idx, za_sca_idx, aa_sca_idx, joker, joker, joker, joker),
+                scat_data_mono[i_ss][i_se].pha_mat_data(
+                    0, t_idx, joker, joker, joker, joker, joker),
+                pha_mat_table,
+                za_sca_idx,
+                aa_sca_idx,
+                verbosity);
           }
         }
       }
@@ -2484,6 +2482,9 @@ void pha_mat_sptFromMonoData(  // Output:
   GridPos T_gp = {0, {0, 1}}, Tred_gp;
   Vector itw(2);
 
+  // Transformation table, shared by scattering elements with the same grids
+  PhaMatTransformTable pha_mat_table;
+
   // Initialisation
   pha_mat_spt = 0.;
 
@@ -2495,9 +2496,11 @@ void pha_mat_sptFromMonoData(  // Output:
       // do the transformation!
       if (pnd_field(i_se_flat, scat_p_index, scat_lat_index, scat_lon_index) >
           PND_LIMIT) {
-        // Temporary phase matrix which includes all temperatures.
+        // Temporary phase matrix at the two temperatures to interpolate
+        // between.
         Index nT = scat_data_mono[i_ss][i_se].pha_mat_data.nvitrines();
-        Tensor3 pha_mat_spt_tmp(nT, pha_mat_spt.nrows(), pha_mat_spt.ncols());
+        Tensor5 pha_mat_spt_tmp(
+            2, doit_za_grid_size, aa_grid.nelem(), stokes_dim, stokes_dim);
 
         pha_mat_spt_tmp = 0.;
 
@@ -2537,53 +2540,56 @@ void pha_mat_sptFromMonoData(  // Output:
         }
 
         // Do the transformation into the laboratory coordinate system.
-        for (Index za_inc_idx = 0; za_inc_idx < doit_za_grid_size;
-             za_inc_idx++) {
-          for (Index aa_inc_idx = 0; aa_inc_idx < aa_grid.nelem();
-               aa_inc_idx++) {
-            if (ti < 0)  // Temperature interpolation
-            {
-              for (Index t_idx = 0; t_idx < 2; t_idx++) {
-                pha_matTransform(
-                    pha_mat_spt_tmp(t_idx, joker, joker),
-                    scat_data_mono[i_ss][i_se].pha_mat_data(
-                        0, t_idx + T_gp.idx, joker, joker, joker, joker, joker),
-                    scat_data_mono[i_ss][i_se].za_grid,
-                    scat_data_mono[i_ss][i_se].aa_grid,
-                    scat_data_mono[i_ss][i_se].ptype,
-                    za_index,
-                    aa_index,
-                    za_inc_idx,
-                    aa_inc_idx,
-                    za_grid,
-                    aa_grid,
-                    verbosity);
-              }
+        pha_mat_transform_tableCalc(pha_mat_table,
+                                    scat_data_mono[i_ss][i_se].za_grid,
+                                    scat_data_mono[i_ss][i_se].aa_grid,
+                                    scat_data_mono[i_ss][i_se].ptype,
+                                    za_grid[Range(za_index, 1)],
+                                    aa_grid[Range(aa_index, 1)],
+                                    za_grid,
+                                    aa_grid);
+        if (ti < 0)  // Temperature interpolation
+        {
+          for (Index t_idx = 0; t_idx < 2; t_idx++) {
+            pha_matTransformTabulated(
+                pha_mat_spt_tmp(t_idx, joker, joker, joker, joker),
+                scat_data_mono[i_ss][i_se].pha_mat_data(
+                    0, t_idx + T_gp.idx, joker, joker, joker, joker, joker),
+                pha_mat_table,
+                0,
+                0,
+                verbosity);
+          }
 
+          for (Index za_inc_idx = 0; za_inc_idx < doit_za_grid_size;
+               za_inc_idx++) {
+            for (Index aa_inc_idx = 0; aa_inc_idx < aa_grid.nelem();
+                 aa_inc_idx++) {
               for (Index i = 0; i < stokes_dim; i++) {
                 for (Index j = 0; j < stokes_dim; j++) {
                   pha_mat_spt(i_se_flat, za_inc_idx, aa_inc_idx, i, j) =
-                      interp(itw, pha_mat_spt_tmp(joker, i, j), Tred_gp);
+                      interp(itw,
+                             pha_mat_spt_tmp(
+                                 joker, za_inc_idx, aa_inc_idx, i, j),
+                             Tred_gp);
                 }
               }
-            } else  // no temperature interpolation required
-            {
-              pha_matTransform(
-                  pha_mat_spt(i_se_flat, za_inc_idx, aa_inc_idx, joker, joker),
-                  scat_data_mono[i_ss][i_se].pha_mat_data(
-                      0, ti, joker, joker, joker, joker, joker),
-                  scat_data_mono[i_ss][i_se].za_grid,
-                  scat_data_mono[i_ss][i_se].aa_grid,
-                  scat_data_mono[i_ss][i_se].ptype,
-                  za_index,
-                  aa_index,
-                  za_inc_idx,
-                  aa_inc_idx,
-                  za_grid,
-                  aa_grid,
-                  verbosity);
             }
           }
+        } else  // no temperature interpolation required
+        {
+          pha_matTransformTabulated(
+              pha_mat_spt(i_se_flat,
+                          Range(0, doit_za_grid_size),
+                          Range(0, aa_grid.nelem()),
+                          joker,
+                          joker),
+              scat_data_mono[i_ss][i_se].pha_mat_data(
+                  0, ti, joker, joker, joker, joker, joker),
+              pha_mat_table,
+              0,
+              0,
+              verbosity);
         }
       }
 
@@ -2640,6 +2646,9 @@ void pha_mat_sptFromScat_data(  // Output:
   // [frequency, za_inc, aa_inc, stokes_dim, stokes_dim]
   Tensor5 pha_mat_data_int;
 
+  // Transformation table, shared by scattering elements with the same grids
+  PhaMatTransformTable pha_mat_table;
+
   Index this_f_index;
 
   Index i_se_flat = 0;
@@ -2752,25 +2761,25 @@ void pha_mat_sptFromScat_data(  // Output:
         }
 
         // Do the transformation into the laboratory coordinate system.
-        for (Index za_inc_idx = 0; za_inc_idx < za_grid.nelem();
-             za_inc_idx++) {
-          for (Index aa_inc_idx = 0; aa_inc_idx < aa_grid.nelem();
-               aa_inc_idx++) {
-            pha_matTransform(
-                pha_mat_spt(i_se_flat, za_inc_idx, aa_inc_idx, joker, joker),
-                pha_mat_data_int,
-                ZA_DATAGRID,
-                AA_DATAGRID,
-                PART_TYPE,
-                za_index,
-                aa_index,
-                za_inc_idx,
-                aa_inc_idx,
-                za_grid,
-                aa_grid,
-                verbosity);
-          }
-        }
+        pha_mat_transform_tableCalc(pha_mat_table,
+                                    ZA_DATAGRID,
+                                    AA_DATAGRID,
+                                    PART_TYPE,
+                                    za_grid[Range(za_index, 1)],
+                                    aa_grid[Range(aa_index, 1)],
+                                    za_grid,
+                                    aa_grid);
+        pha_matTransformTabulated(
+            pha_mat_spt(i_se_flat,
+                        Range(0, za_grid.nelem()),
+                        Range(0, aa_grid.nelem()),
+                        joker,
+                        joker),
+            pha_mat_data_int,
+            pha_mat_table,
+            0,
+            0,
+            verbosity);
       }
       i_se_flat++;
     }
@@ -189,6 +189,16 @@ void geo_posWherePpathPassesZref(Vector& geo_pos,
   out2 << "  Sets geo-position to:\n" << geo_pos;
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ppathCacheClear(const Verbosity& verbosity) {
+  CREATE_OUT2;
+  Index size, hits, misses;
+  ppath_cache_stats(size, hits, misses);
+  out2 << "  Propagation path cache: " << size << " paths, " << hits
+       << " hits and " << misses << " misses.\n";
+  ppath_cache_clear();
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void ppathCalc(Workspace& ws,
                Ppath& ppath,
@@ -228,6 +238,58 @@ void ppathCalc(Workspace& ws,
                       ppath_agenda);
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ppathCalcBatch(Workspace& ws,
+                    ArrayOfPpath& ppaths,
+                    const Agenda& ppath_step_agenda,
+                    const Index& ppath_inside_cloudbox_do,
+                    const Index& atmosphere_dim,
+                    const Vector& p_grid,
+                    const Vector& lat_grid,
+                    const Vector& lon_grid,
+                    const Tensor3& z_field,
+                    const Vector& f_grid,
+                    const Vector& refellipsoid,
+                    const Matrix& z_surface,
+                    const Index& atmgeom_checked,
+                    const Index& cloudbox_on,
+                    const ArrayOfIndex& cloudbox_limits,
+                    const Index& cloudbox_checked,
+                    const Matrix& sensor_pos,
+                    const Matrix& sensor_los,
+                    const Numeric& ppath_lmax,
+                    const Numeric& ppath_lraytrace,
+                    const Verbosity& verbosity) {
+  if (atmgeom_checked != 1)
+    throw runtime_error(
+        "The atmospheric geometry must be flagged to have "
+        "passed a consistency check (atmgeom_checked=1).");
+  if (cloudbox_checked != 1)
+    throw runtime_error(
+        "The cloudbox must be flagged to have "
+        "passed a consistency check (cloudbox_checked=1).");
+
+  ppath_calc_batch(ws,
+                   ppaths,
+                   ppath_step_agenda,
+                   atmosphere_dim,
+                   p_grid,
+                   lat_grid,
+                   lon_grid,
+                   z_field,
+                   f_grid,
+                   refellipsoid,
+                   z_surface,
+                   cloudbox_on,
+                   cloudbox_limits,
+                   sensor_pos,
+                   sensor_los,
+                   ppath_lmax,
+                   ppath_lraytrace,
+                   ppath_inside_cloudbox_do,
+                   verbosity);
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void ppathCalcFromAltitude(Workspace& ws,
                            Ppath& ppath,
@@ -1065,26 +1127,28 @@ void ppathStepByStep(Workspace& ws,
                      const Vector& rte_los,
                      const Numeric& ppath_lmax,
                      const Numeric& ppath_lraytrace,
+                     const Index& cache_size,
                      const Verbosity& verbosity) {
-  ppath_calc(ws,
-             ppath,
-             ppath_step_agenda,
-             atmosphere_dim,
-             p_grid,
-             lat_grid,
-             lon_grid,
-             z_field,
-             f_grid,
-             refellipsoid,
-             z_surface,
-             cloudbox_on,
-             cloudbox_limits,
-             rte_pos,
-             rte_los,
-             ppath_lmax,
-             ppath_lraytrace,
-             ppath_inside_cloudbox_do,
-             verbosity);
+  ppath_calc_cached(ws,
+                    ppath,
+                    ppath_step_agenda,
+                    atmosphere_dim,
+                    p_grid,
+                    lat_grid,
+                    lon_grid,
+                    z_field,
+                    f_grid,
+                    refellipsoid,
+                    z_surface,
+                    cloudbox_on,
+                    cloudbox_limits,
+                    rte_pos,
+                    rte_los,
+                    ppath_lmax,
+                    ppath_lraytrace,
+                    ppath_inside_cloudbox_do,
+                    cache_size,
+                    verbosity);
 }
 
 /* Workspace method: Doxygen documentation will be auto-generated */
@@ -170,54 +170,33 @@ void line_irradianceCalcForSingleSpeciesNonOverlappingLinesPseudo2D(
   for (Index i = 0; i < np; i++)
     line_radiance[i].resize(sorted_index[i].nelem(), nl);
 
-  Workspace l_ws(ws);
-  Agenda l_iy_main_agenda(iy_main_agenda);
-  Agenda l_iy_space_agenda(iy_space_agenda);
-  Agenda l_iy_surface_agenda(iy_surface_agenda);
-  Agenda l_iy_cloudbox_agenda(iy_cloudbox_agenda);
-
-#pragma omp parallel for if (not arts_omp_in_parallel())               \
-    schedule(guided) default(shared) firstprivate(l_ws,                \
-                                                  l_iy_main_agenda,    \
-                                                  l_iy_space_agenda,   \
-                                                  l_iy_surface_agenda, \
-                                                  l_iy_cloudbox_agenda,\
-                                                  il)
-  for (Index i = 0; i < ppath_field.nelem(); i++) {
-    const Ppath& path = ppath_field[i];
-
-    thread_local ArrayOfRadiationVector lvl_rad;
-    thread_local ArrayOfRadiationVector src_rad;
-    thread_local ArrayOfTransmissionMatrix lyr_tra;
-    thread_local ArrayOfTransmissionMatrix tot_tra;
-
-    emission_from_propmat_field(l_ws,
-                                lvl_rad,
-                                src_rad,
-                                lyr_tra,
-                                tot_tra,
-                                propmat_field,
-                                absorption_field,
-                                additional_source_field,
-                                f_grid,
-                                t_field,
-                                nlte_field,
-                                path,
-                                l_iy_main_agenda,
-                                l_iy_space_agenda,
-                                l_iy_surface_agenda,
-                                l_iy_cloudbox_agenda,
-                                surface_props_data,
-                                verbosity);
-    
-    for (Index ip_path = 0; ip_path < path.np; ip_path++) {
-      const Index ip_grid = grid_index_from_gp(path.gp_p[ip_path]);
-      for (il = 0; il < nl; il++)
-        line_radiance[ip_grid](counted_path_index[i][ip_path], il) =
-            integrate_convolved(
-                lvl_rad[ip_path], lineshapes[il][ip_grid], f_grid);
-    }
-  }
+  // The radiation of each path is integrated over the line shapes as soon
+  // as the path is done, so only one path per thread is held in memory
+  emission_from_propmat_field(
+      ws,
+      [&](const Index i, const ArrayOfRadiationVector& lvl_rad) {
+        const Ppath& path = ppath_field[i];
+        for (Index ip_path = 0; ip_path < path.np; ip_path++) {
+          const Index ip_grid = grid_index_from_gp(path.gp_p[ip_path]);
+          for (Index jl = 0; jl < nl; jl++)
+            line_radiance[ip_grid](counted_path_index[i][ip_path], jl) =
+                integrate_convolved(
+                    lvl_rad[ip_path], lineshapes[jl][ip_grid], f_grid);
+        }
+      },
+      propmat_field,
+      absorption_field,
+      additional_source_field,
+      f_grid,
+      t_field,
+      nlte_field,
+      ppath_field,
+      iy_main_agenda,
+      iy_space_agenda,
+      iy_surface_agenda,
+      iy_cloudbox_agenda,
+      surface_props_data,
+      verbosity);
 
   for (Index ip = 0; ip < np; ip++) {
     for (il = 0; il < nl; il++) {
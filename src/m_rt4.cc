@@ -79,6 +79,7 @@ void RT4Calc(Workspace& ws,
              const Index& za_interp_order,
              const Index& cos_za_interp,
              const Numeric& max_delta_tau,
+             const Index& nprocesses,
              const Verbosity& verbosity) {
   if (!cloudbox_on) {
     CREATE_OUT1;
@@ -192,6 +193,7 @@ void RT4Calc(Workspace& ws,
           pfct_aa_grid_size,
           pfct_threshold,
           max_delta_tau,
+          nprocesses,
           verbosity);
 
   za_grid_adjust(za_grid, mu_values, nummu);
@@ -237,6 +239,7 @@ void RT4CalcWithRT4Surface(Workspace& ws,
                            const Index& za_interp_order,
                            const Index& cos_za_interp,
                            const Numeric& max_delta_tau,
+                           const Index& nprocesses,
                            const Verbosity& verbosity) {
   if (!cloudbox_on) {
     CREATE_OUT0;
@@ -352,6 +355,7 @@ void RT4CalcWithRT4Surface(Workspace& ws,
           pfct_aa_grid_size,
           pfct_threshold,
           max_delta_tau,
+          nprocesses,
           verbosity);
 
   za_grid_adjust(za_grid, mu_values, nummu);
@@ -394,6 +398,7 @@ void RT4Calc(Workspace&,
              const Index&,
              const Index&,
              const Numeric&,
+             const Index&,
              const Verbosity&) {
   throw runtime_error("This version of ARTS was compiled without RT4 support.");
 }
@@ -437,6 +442,7 @@ void RT4CalcWithRT4Surface(Workspace&,
                            const Index&,
                            const Index&,
                            const Numeric&,
+                           const Index&,
                            const Verbosity&) {
   throw runtime_error("This version of ARTS was compiled without RT4 support.");
 }
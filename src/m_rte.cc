@@ -39,6 +39,7 @@
 #include "jacobian.h"
 #include "logic.h"
 #include "math_funcs.h"
+#include "matpack_alloc.h"
 #include "messages.h"
 #include "montecarlo.h"
 #include "physics_funcs.h"
@@ -608,6 +609,13 @@ void iyEmissionStandard(
     const Numeric& rte_alonglos_v,
     const Tensor3& surface_props_data,
     const Verbosity& verbosity) {
+  CREATE_OUT3;
+
+  // Allocations of matpack data during this call, reported at verbosity 3.
+  // The counters include the threads of the parallel loop over the path
+  // points, and anything else running at the same time.
+  const MatpackAllocStats alloc_start = matpack_alloc_stats();
+
   // Some basic sizes
   const Index nf = f_grid.nelem();
   const Index ns = stokes_dim;
@@ -993,6 +1001,13 @@ void iyEmissionStandard(
                               j_analytical_do,
                               iy_unit);
   }
+
+  const MatpackAllocStats alloc_end = matpack_alloc_stats();
+  out3 << "  Matpack allocations in iyEmissionStandard: "
+       << alloc_end.heap_allocs - alloc_start.heap_allocs << " from heap ("
+       << alloc_end.heap_bytes - alloc_start.heap_bytes << " bytes), "
+       << alloc_end.arena_allocs - alloc_start.arena_allocs
+       << " from arenas.\n";
 }
 
 /* Workspace method: Doxygen documentation will be auto-generated */
@@ -1866,6 +1881,10 @@ void yCalc(Workspace& ws,
   String fail_msg;
   bool failed = false;
 
+  // The geometry is the same for all pencil beams, a cached propagation
+  // path needs then only to be matched once to the atmosphere
+  const PpathCacheScope ppath_cache_scope(ws);
+
   if (nmblock >= arts_omp_get_max_threads() ||
       (nf <= nmblock && nmblock >= nlos)) {
     out3 << "  Parallelizing mblock loop (" << nmblock << " iterations)\n";
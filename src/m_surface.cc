@@ -85,55 +85,97 @@ void FastemStandAlone(Matrix& emissivity,
     throw std::runtime_error(
         "Invalid fastem version: 3 <= fastem_version <= 6");
 
-  emissivity.resize(nf, 4);
-  reflectivity.resize(nf, 4);
-
-  const Numeric t = max(surface_skin_t, Numeric(270));
-
   for (Index i = 0; i < nf; i++) {
     if (f_grid[i] > 250e9)
       throw std::runtime_error("Only frequency <= 250 GHz are allowed");
     chk_if_in_range("transmittance", transmittance[i], 0, 1);
+  }
+
+  const Numeric t = max(surface_skin_t, Numeric(270));
 
-    Vector e, r;
+  Tensor3 trans(1, 1, nf);
+  trans(0, 0, joker) = transmittance;
 
-    fastem(e,
-           r,
-           f_grid[i],
-           za,
-           t,
-           salinity,
-           wind_speed,
-           transmittance[i],
-           rel_aa,
-           fastem_version);
+  Tensor4 e, r;
+  fastem_batch(e,
+               r,
+               f_grid,
+               ConstVectorView(za),
+               ConstVectorView(t),
+               ConstVectorView(salinity),
+               ConstVectorView(wind_speed),
+               trans,
+               ConstVectorView(rel_aa),
+               fastem_version);
 
-    emissivity(i, joker) = e;
-    reflectivity(i, joker) = r;
-  }
+  emissivity = e(0, 0, joker, joker);
+  reflectivity = r(0, 0, joker, joker);
 
   // FASTEM does not work close to the horizon (at least v6). Make sure values
   // are inside [0,1]. Then seems best to make sure that e+r=1.
+  fastem_clip(emissivity, reflectivity);
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void FastemStandAloneBatch(Tensor4& emissivity,
+                           Tensor4& reflectivity,
+                           const Vector& f_grid,
+                           const Vector& surface_skin_t,
+                           const Vector& za,
+                           const Vector& salinity,
+                           const Vector& wind_speed,
+                           const Vector& rel_aa,
+                           const Tensor3& transmittance,
+                           const Index& fastem_version,
+                           const Verbosity&) {
+  const Index nf = f_grid.nelem();
+  const Index np = surface_skin_t.nelem();
+  const Index nza = za.nelem();
+
+  if (nf == 0 || np == 0 || nza == 0)
+    throw std::runtime_error(
+        "*f_grid*, *surface_skin_t* and *za* must not be empty.");
+  chk_vector_length("salinity", "surface_skin_t", salinity, surface_skin_t);
+  chk_vector_length("wind_speed", "surface_skin_t", wind_speed, surface_skin_t);
+  chk_vector_length("rel_aa", "surface_skin_t", rel_aa, surface_skin_t);
+  chk_size("transmittance", transmittance, np, nza, nf);
+  for (Index i = 0; i < nza; i++)
+    chk_if_in_range("zenith angle", za[i], 90, 180);
+  for (Index i = 0; i < np; i++) {
+    chk_if_in_range_exclude(
+        "surface skin temperature", surface_skin_t[i], 260, 373);
+    chk_if_in_range_exclude_high("salinity", salinity[i], 0, 1);
+    chk_if_in_range_exclude_high("wind speed", wind_speed[i], 0, 100);
+    chk_if_in_range("azimuth angle", rel_aa[i], -180, 180);
+  }
+  if (fastem_version < 3 || fastem_version > 6)
+    throw std::runtime_error(
+        "Invalid fastem version: 3 <= fastem_version <= 6");
   for (Index i = 0; i < nf; i++) {
-    for (Index s = 0; s < 2; s++) {
-      if (emissivity(i, s) > 1) {
-        emissivity(i, s) = 1;
-        reflectivity(i, s) = 0;
-      }
-      if (emissivity(i, s) < 0) {
-        emissivity(i, s) = 0;
-        reflectivity(i, s) = 1;
-      }
-      if (reflectivity(i, s) > 1) {
-        emissivity(i, s) = 0;
-        reflectivity(i, s) = 1;
-      }
-      if (reflectivity(i, s) < 0) {
-        emissivity(i, s) = 1;
-        reflectivity(i, s) = 0;
-      }
-    }
+    if (f_grid[i] > 250e9)
+      throw std::runtime_error("Only frequency <= 250 GHz are allowed");
   }
+  if (min(transmittance) < 0 || max(transmittance) > 1)
+    throw std::runtime_error("All transmittance values must be inside [0,1].");
+
+  Vector t(np);
+  for (Index i = 0; i < np; i++) t[i] = max(surface_skin_t[i], Numeric(270));
+
+  fastem_batch(emissivity,
+               reflectivity,
+               f_grid,
+               za,
+               t,
+               salinity,
+               wind_speed,
+               transmittance,
+               rel_aa,
+               fastem_version);
+
+  for (Index ip = 0; ip < np; ip++)
+    for (Index iza = 0; iza < nza; iza++)
+      fastem_clip(emissivity(ip, iza, joker, joker),
+                  reflectivity(ip, iza, joker, joker));
 }
 
 /* Workspace method: Doxygen documentation will be auto-generated */
@@ -1129,36 +1171,36 @@ void surfaceTessem(Matrix& surface_los,
                                atmosphere_dim,
                                verbosity);
 
-  // TESSEM in and out
-  //
-  Vector out(2);
-  VectorView e_h = out[Range(0, 1)];
-  VectorView e_v = out[Range(1, 1)];
-  //
-  Vector in(5);
-  in[1] = 180.0 - abs(rtp_los[0]);
-  in[2] = wind_speed;
-  in[3] = surface_skin_t;
-  in[4] = salinity;
-
-  // Get Rv and Rh
+  // TESSEM in and out, one row per frequency
   //
   const Index nf = f_grid.nelem();
-  Matrix surface_rv_rh(nf, 2);
+  Matrix e_h(nf, 1), e_v(nf, 1);
   //
+  Matrix in(nf, 5);
+  in(joker, 1) = 180.0 - abs(rtp_los[0]);
+  in(joker, 2) = wind_speed;
+  in(joker, 3) = surface_skin_t;
+  in(joker, 4) = salinity;
+
   for (Index i = 0; i < nf; ++i) {
     if (f_grid[i] < 5e9)
       throw std::runtime_error("Only frequency >= 5 GHz are allowed");
     if (f_grid[i] > 900e9)
       throw std::runtime_error("Only frequency <= 900 GHz are allowed");
 
-    in[0] = f_grid[i];
+    in(i, 0) = f_grid[i];
+  }
 
-    tessem_prop_nn(e_h, net_h, in);
-    tessem_prop_nn(e_v, net_v, in);
+  tessem_prop_nn_batch(e_h, net_h, in);
+  tessem_prop_nn_batch(e_v, net_v, in);
 
-    surface_rv_rh(i, 0) = min(max(1 - e_v[0], (Numeric)0), (Numeric)1);
-    surface_rv_rh(i, 1) = min(max(1 - e_h[0], (Numeric)0), (Numeric)1);
+  // Get Rv and Rh
+  //
+  Matrix surface_rv_rh(nf, 2);
+  //
+  for (Index i = 0; i < nf; ++i) {
+    surface_rv_rh(i, 0) = min(max(1 - e_v(i, 0), (Numeric)0), (Numeric)1);
+    surface_rv_rh(i, 1) = min(max(1 - e_h(i, 0), (Numeric)0), (Numeric)1);
   }
 
   surfaceFlatRvRh(surface_los,
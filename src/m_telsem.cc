@@ -80,6 +80,27 @@ void telsemStandalone(Matrix &emis,
   }
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void telsemStandaloneBatch(Tensor3 &emis,
+                           const Vector &lat,
+                           const Vector &lon,
+                           const Vector &theta,
+                           const Vector &f,
+                           const TelsemAtlas &atlas,
+                           const Numeric &d_max,
+                           const Verbosity &) {
+  for (Index i = 0; i < lat.nelem(); ++i) {
+    chk_if_in_range("Latitude input to TELSEM2", lat[i], -90.0, 90.0);
+  }
+  for (Index i = 0; i < lon.nelem(); ++i) {
+    chk_if_in_range("Longitude input to TELSEM2", lon[i], 0.0, 360.0);
+  }
+
+  Vector f_ghz(f);
+  f_ghz *= 1e-9;
+  atlas.emis_interp_batch(emis, lat, lon, theta, f_ghz, d_max);
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void telsemSurfaceTypeLandSea(Index &surface_type,
                               const Index &atmosphere_dim,
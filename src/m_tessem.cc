@@ -50,3 +50,15 @@ void TestTessem(Vector& outvalues,
   out1 << "Input values    : " << invalues << "\n";
   out1 << "Output values   : " << outvalues << "\n";
 }
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void TestTessem(Matrix& outvalues,
+                const TessemNN& net,
+                const Matrix& invalues,
+                const Verbosity& verbosity) {
+  CREATE_OUT1;
+  outvalues.resize(invalues.nrows(), net.nb_outputs);
+  tessem_prop_nn_batch(outvalues, net, invalues);
+  out1 << "Input values    :\n" << invalues << "\n";
+  out1 << "Output values   :\n" << outvalues << "\n";
+}
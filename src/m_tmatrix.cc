@@ -23,16 +23,37 @@
   \brief  T-Matrix related workspace methods.
 */
 
+#include <cerrno>
 #include <cfloat>
 #include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <map>
 #include <stdexcept>
+#include "arts_omp.h"
+#include "auto_md.h"
 #include "check_input.h"
+#include "file.h"
 #include "logic.h"
 #include "math_funcs.h"
 #include "messages.h"
 #include "refraction.h"
 #include "special_interp.h"
 #include "tmatrix.h"
+#include "xml_io_private.h"
+#include "xml_io_types.h"
+
+#ifdef HAVE_UNISTD_H
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#ifndef WINDOWS
+// T-matrix work units can be run in forked worker processes
+#define TMATRIX_PROCESS_POOL
+#endif
+#endif
 
 extern const Numeric PI;
 
@@ -275,6 +296,391 @@ void scat_data_singleTmatrix(SingleScatteringData& scat_data_single,
   scat_meta_single.diameter_area_equ_aerodynamical = area_max;
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void TMatrixDatabaseCalc(const GriddedField3& complex_refr_index,
+                         const String& shape,
+                         const Vector& diameter_volume_equ,
+                         const Vector& aspect_ratio,
+                         const Vector& mass,
+                         const String& ptype,
+                         const Vector& data_f_grid,
+                         const Vector& data_t_grid,
+                         const Vector& data_za_grid,
+                         const Vector& data_aa_grid,
+                         const Numeric& precision,
+                         const String& cri_source,
+                         const Index& ndgs,
+                         const Index& robust,
+                         const Index& quiet,
+                         const String& filename_scat_data,
+                         const String& filename_scat_meta,
+                         const String& checkpoint_dir,
+                         const Index& nprocesses,
+                         const Verbosity& verbosity) {
+  CREATE_OUT1;
+  CREATE_OUT2;
+
+  const Index np = diameter_volume_equ.nelem();
+  const Index nf = data_f_grid.nelem();
+
+  // Check input
+  if (aspect_ratio.nelem() != np && aspect_ratio.nelem() != 1) {
+    throw runtime_error(
+        "*aspect_ratio* must have the same length as *diameter_volume_equ*,"
+        " or length 1.");
+  }
+  if (mass.nelem() != np && mass.nelem() != 0) {
+    throw runtime_error(
+        "*mass* must have the same length as *diameter_volume_equ*,"
+        " or be empty.");
+  }
+  if (!nf) throw runtime_error("*data_f_grid* is empty.");
+  if (filename_scat_data == "" || filename_scat_meta == "") {
+    throw runtime_error(
+        "*filename_scat_data* and *filename_scat_meta* must be set.");
+  }
+
+  auto ar_of = [&](const Index ip) {
+    return aspect_ratio.nelem() == 1 ? aspect_ratio[0] : aspect_ratio[ip];
+  };
+  auto mass_of = [&](const Index ip) {
+    return mass.nelem() ? mass[ip] : Numeric(NAN);
+  };
+
+  // Directory for the results of the work units. A temporary directory is
+  // used if no checkpointing is requested.
+  String unit_dir = checkpoint_dir;
+  const bool use_tmp_dir = unit_dir == "";
+  if (use_tmp_dir) {
+    char tmpl[] = "/tmp/arts_tmatrix_XXXXXX";
+    if (!mkdtemp(tmpl)) {
+      throw runtime_error(
+          "Could not create a temporary directory for T-matrix work units.");
+    }
+    unit_dir = tmpl;
+  } else if (mkdir(unit_dir.c_str(), 0755) != 0 && errno != EEXIST) {
+    ostringstream os;
+    os << "Could not create checkpoint directory " << unit_dir << ".";
+    throw runtime_error(os.str());
+  }
+
+  // A work unit is a combination of particle and frequency
+  const Index nunits = np * nf;
+  auto unit_file = [&](const Index iu) {
+    ostringstream os;
+    os << unit_dir << "/tmatrix_unit_" << iu / nf << "_" << iu % nf << ".xml";
+    return String(os.str());
+  };
+
+  // Settings of the T-matrix calculation that are not part of the
+  // scattering data. They are appended to the description of each work
+  // unit, so a unit from a checkpoint made with other settings is rejected.
+  // The values are written with enough digits to compare exactly.
+  String unit_settings;
+  {
+    ostringstream os;
+    os << std::setprecision(17) << " Settings: precision = " << precision
+       << ", ndgs = " << ndgs << ", cri_source = " << cri_source
+       << ", complex_refr_index =";
+    for (Index i = 0; i < 3; i++) {
+      const Vector& grid = complex_refr_index.get_numeric_grid(i);
+      os << " [";
+      for (Index j = 0; j < grid.nelem(); j++) os << " " << grid[j];
+      os << " ]";
+    }
+    const Tensor3& cri = complex_refr_index.data;
+    for (Index p = 0; p < cri.npages(); p++)
+      for (Index r = 0; r < cri.nrows(); r++)
+        for (Index c = 0; c < cri.ncols(); c++) os << " " << cri(p, r, c);
+    unit_settings = os.str();
+  }
+
+  // Description of the scattering data of a particle, as set by
+  // scat_data_singleTmatrix
+  auto description_of = [&](const Index ip) {
+    ostringstream os;
+    os << "T-matrix calculation for a " << shape << " particle, with "
+       << "diameter_volume_equ = " << 1e6 * diameter_volume_equ[ip]
+       << "um and "
+       << "aspect ratio = " << ar_of(ip) << ".";
+    return String(os.str());
+  };
+
+  // Calculation of a work unit. The result is stored in the unit file.
+  auto calc_unit = [&](const Index iu) {
+    const Index ip = iu / nf;
+    const Index f_index = iu % nf;
+
+    SingleScatteringData ssd;
+    ScatteringMetaData smd;
+    const Vector f_grid_unit(1, data_f_grid[f_index]);
+    scat_data_singleTmatrix(ssd,
+                            smd,
+                            complex_refr_index,
+                            shape,
+                            diameter_volume_equ[ip],
+                            ar_of(ip),
+                            mass_of(ip),
+                            ptype,
+                            f_grid_unit,
+                            data_t_grid,
+                            data_za_grid,
+                            data_aa_grid,
+                            precision,
+                            cri_source,
+                            ndgs,
+                            robust,
+                            quiet,
+                            verbosity);
+    ssd.description += unit_settings;
+    xml_write_to_file(unit_file(iu), ssd, FILE_TYPE_BINARY, 0, verbosity);
+  };
+
+  // Reads a work unit, returns false if it is missing or does not match the
+  // present settings (in case of a checkpoint from another run)
+  auto read_unit = [&](SingleScatteringData& ssd, const Index iu) {
+    if (!file_exists(unit_file(iu))) return false;
+    try {
+      xml_read_from_file(unit_file(iu), ssd, verbosity);
+    } catch (const std::exception&) {
+      return false;
+    }
+    auto same_grid = [](ConstVectorView a, ConstVectorView b) {
+      if (a.nelem() != b.nelem()) return false;
+      for (Index i = 0; i < a.nelem(); i++)
+        if (a[i] != b[i]) return false;
+      return true;
+    };
+    return ssd.description == description_of(iu / nf) + unit_settings &&
+           ssd.ptype == PTypeFromString(ptype) && ssd.f_grid.nelem() == 1 &&
+           ssd.f_grid[0] == data_f_grid[iu % nf] &&
+           same_grid(ssd.T_grid, data_t_grid) &&
+           same_grid(ssd.za_grid, data_za_grid) &&
+           (ssd.ptype == PTYPE_TOTAL_RND ||
+            same_grid(ssd.aa_grid, data_aa_grid));
+  };
+
+  // Find units left to calculate
+  ArrayOfIndex todo;
+  {
+    SingleScatteringData ssd;
+    for (Index iu = 0; iu < nunits; iu++) {
+      if (use_tmp_dir || !read_unit(ssd, iu)) todo.push_back(iu);
+    }
+  }
+  out1 << "  T-matrix database: " << nunits - todo.nelem() << " of " << nunits
+       << " work units found in checkpoint, " << todo.nelem()
+       << " to calculate.\n";
+
+  //
+  // Calculate remaining work units
+  //
+  ostringstream fail_msg;
+#ifdef TMATRIX_PROCESS_POOL
+  if (nprocesses > 1 && !arts_omp_in_parallel()) {
+    // The T-matrix code has global state. The work units are therefore
+    // distributed to a pool of forked worker processes, each running one
+    // unit at a time.
+    std::map<pid_t, Index> running;
+    Index next = 0;
+    while (next < todo.nelem() || running.size()) {
+      while (next < todo.nelem() && Index(running.size()) < nprocesses) {
+        const Index iu = todo[next++];
+        std::remove(unit_file(iu).c_str());
+        const pid_t pid = fork();
+        if (pid == 0) {
+          // Worker process
+          int status = 0;
+          try {
+            calc_unit(iu);
+          } catch (const std::exception& e) {
+            std::ofstream ofs((unit_file(iu) + ".err").c_str());
+            ofs << e.what();
+            status = 1;
+          }
+          _exit(status);
+        } else if (pid < 0) {
+          fail_msg << "Could not start worker process for "
+                   << "particle " << iu / nf << ", f_index " << iu % nf
+                   << ".\n";
+        } else {
+          running[pid] = iu;
+        }
+      }
+
+      if (running.size()) {
+        int status;
+        const pid_t pid = wait(&status);
+        if (pid < 0) {
+          if (errno == EINTR) continue;
+          break;
+        }
+        const auto it = running.find(pid);
+        if (it == running.end()) continue;
+        const Index iu = it->second;
+        running.erase(it);
+
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+          fail_msg << "T-matrix calculation failed for particle " << iu / nf
+                   << ", f_index " << iu % nf;
+          ArrayOfString err;
+          if (file_exists(unit_file(iu) + ".err")) {
+            read_text_from_file(err, unit_file(iu) + ".err");
+            std::remove((unit_file(iu) + ".err").c_str());
+          }
+          if (err.nelem()) {
+            fail_msg << ":\n";
+            for (const auto& line : err) fail_msg << line << "\n";
+          } else if (WIFSIGNALED(status)) {
+            fail_msg << " (terminated by signal " << WTERMSIG(status)
+                     << ").\n";
+          } else {
+            fail_msg << ".\n";
+          }
+        } else {
+          out2 << "  Finished particle " << iu / nf << ", f_index "
+               << iu % nf << ".\n";
+        }
+      }
+    }
+  } else
+#endif
+  {
+    if (nprocesses > 1 && arts_omp_in_parallel()) {
+      out1 << "  Running T-matrix work units in-process, as called inside"
+           << " a parallel region.\n";
+    }
+    for (const Index iu : todo) {
+      try {
+        calc_unit(iu);
+        out2 << "  Finished particle " << iu / nf << ", f_index " << iu % nf
+             << ".\n";
+      } catch (const std::exception& e) {
+        fail_msg << "T-matrix calculation failed for particle " << iu / nf
+                 << ", f_index " << iu % nf << ":\n"
+                 << e.what() << "\n";
+      }
+    }
+  }
+
+  auto remove_tmp_dir = [&]() {
+    if (use_tmp_dir) {
+      for (Index iu = 0; iu < nunits; iu++)
+        std::remove(unit_file(iu).c_str());
+      rmdir(unit_dir.c_str());
+    }
+  };
+
+  if (fail_msg.str().length()) {
+    remove_tmp_dir();
+    ostringstream os;
+    os << fail_msg.str();
+    if (!use_tmp_dir) {
+      os << "Completed work units are kept in " << unit_dir
+         << " and are reused when the method is called again.";
+    }
+    throw runtime_error(os.str());
+  }
+
+  //
+  // Write the database. The scattering data is streamed particle by
+  // particle, combining the frequencies of the work units.
+  //
+  try {
+    String efilename = add_basedir(filename_scat_data);
+    out2 << "  Writing " << efilename << '\n';
+    std::ofstream ofs;
+    xml_open_output_file(ofs, efilename);
+    xml_write_header_to_stream(ofs, FILE_TYPE_ASCII, verbosity);
+
+    ArtsXMLTag open_tag(verbosity);
+    open_tag.set_name("Array");
+    open_tag.add_attribute("type", "SingleScatteringData");
+    open_tag.add_attribute("nelem", np);
+    open_tag.write_to_stream(ofs);
+    ofs << '\n';
+
+    ArrayOfScatteringMetaData scat_meta(np);
+    for (Index ip = 0; ip < np; ip++) {
+      SingleScatteringData ssd, ssd_f;
+      for (Index f_index = 0; f_index < nf; f_index++) {
+        if (!read_unit(ssd_f, ip * nf + f_index)) {
+          ostringstream os;
+          os << "Could not read T-matrix work unit " << unit_file(ip * nf)
+             << ".";
+          throw runtime_error(os.str());
+        }
+        if (f_index == 0) {
+          ssd = ssd_f;
+          ssd.description = description_of(ip);
+          ssd.f_grid = data_f_grid;
+          ssd.pha_mat_data.resize(nf,
+                                  ssd_f.pha_mat_data.nvitrines(),
+                                  ssd_f.pha_mat_data.nshelves(),
+                                  ssd_f.pha_mat_data.nbooks(),
+                                  ssd_f.pha_mat_data.npages(),
+                                  ssd_f.pha_mat_data.nrows(),
+                                  ssd_f.pha_mat_data.ncols());
+          ssd.ext_mat_data.resize(nf,
+                                  ssd_f.ext_mat_data.nbooks(),
+                                  ssd_f.ext_mat_data.npages(),
+                                  ssd_f.ext_mat_data.nrows(),
+                                  ssd_f.ext_mat_data.ncols());
+          ssd.abs_vec_data.resize(nf,
+                                  ssd_f.abs_vec_data.nbooks(),
+                                  ssd_f.abs_vec_data.npages(),
+                                  ssd_f.abs_vec_data.nrows(),
+                                  ssd_f.abs_vec_data.ncols());
+        }
+        ssd.pha_mat_data(Range(f_index, 1),
+                         joker,
+                         joker,
+                         joker,
+                         joker,
+                         joker,
+                         joker) = ssd_f.pha_mat_data;
+        ssd.ext_mat_data(Range(f_index, 1), joker, joker, joker, joker) =
+            ssd_f.ext_mat_data;
+        ssd.abs_vec_data(Range(f_index, 1), joker, joker, joker, joker) =
+            ssd_f.abs_vec_data;
+      }
+      xml_write_to_stream(ofs, ssd, NULL, "", verbosity);
+
+      // Meta data, as in scat_data_singleTmatrix
+      ScatteringMetaData& smd = scat_meta[ip];
+      smd.description =
+          "Meta data for associated file with single scattering data.";
+      smd.source = "ARTS interface to T-matrix code by Mishchenko et al.";
+      smd.refr_index = cri_source;
+      Numeric diameter_max, area_max;
+      diameter_maxFromDiameter_volume_equ(diameter_max,
+                                          area_max,
+                                          shape,
+                                          diameter_volume_equ[ip],
+                                          ar_of(ip),
+                                          verbosity);
+      smd.mass = mass_of(ip);
+      smd.diameter_max = diameter_max;
+      smd.diameter_volume_equ = diameter_volume_equ[ip];
+      smd.diameter_area_equ_aerodynamical = area_max;
+    }
+
+    ArtsXMLTag close_tag(verbosity);
+    close_tag.set_name("/Array");
+    close_tag.write_to_stream(ofs);
+    ofs << '\n';
+    xml_write_footer_to_stream(ofs, verbosity);
+
+    xml_write_to_file(
+        filename_scat_meta, scat_meta, FILE_TYPE_ASCII, 0, verbosity);
+  } catch (const std::exception&) {
+    remove_tmp_dir();
+    throw;
+  }
+
+  remove_tmp_dir();
+}
+
 void TMatrixTest(const Verbosity& verbosity) {
   tmatrix_tmd_test(verbosity);
   tmatrix_ampld_test(verbosity);
@@ -46,6 +46,7 @@
 #include "auto_md.h"
 #include "auto_version.h"
 #include "docserver.h"
+#include "jobserver.h"
 #include "exceptions.h"
 #include "file.h"
 #include "global_data.h"
@@ -895,14 +896,18 @@ int main(int argc, char** argv) {
   // Ok, we are past all the special options. This means the user
   // wants to get serious and really do a calculation. Check if we
   // have at least one control file:
-  if (0 == parameters.controlfiles.nelem()) {
+  if (0 == parameters.controlfiles.nelem() && 0 == parameters.server) {
     cerr << "You must specify at least one control file name.\n";
     polite_goodby();
   }
 
   // Set the basename according to the first control file, if not
   // explicitly specified.
-  if ("" == parameters.basename) {
+  if ("" == parameters.basename && 0 == parameters.controlfiles.nelem()) {
+    // Job server without resident control files
+    extern String out_basename;
+    out_basename = "arts_server";
+  } else if ("" == parameters.basename) {
     extern String out_basename;
     ArrayOfString fileparts;
     parameters.controlfiles[0].split(fileparts, "/");
@@ -1011,6 +1016,44 @@ int main(int argc, char** argv) {
          << "                    Report file: "
          << verbosity.get_file_verbosity() << "\n";
 
+#ifdef ENABLE_DOCSERVER
+    if (0 != parameters.server) {
+      int status;
+      {
+        JobServer server(parameters.server, parameters.workers, verbosity);
+
+        // The control files given on the command line set up the data
+        // that is kept in memory for all jobs
+        out3 << "\nReading resident control files:\n";
+        for (Index i = 0; i < parameters.controlfiles.nelem(); ++i) {
+          out3 << "- " << parameters.controlfiles[i] << "\n";
+          ifstream file(parameters.controlfiles[i].c_str());
+          if (!file) {
+            ostringstream os;
+            os << "Cannot open controlfile: " << parameters.controlfiles[i];
+            throw runtime_error(os.str());
+          }
+          ostringstream text;
+          text << file.rdbuf();
+          try {
+            server.update_resident(text.str());
+          } catch (const std::exception& x) {
+            ostringstream os;
+            os << "Run-time error in controlfile: "
+               << parameters.controlfiles[i] << '\n'
+               << x.what();
+            throw runtime_error(os.str());
+          }
+        }
+
+        status = server.launch();
+      }
+
+      // The server has completed all jobs when it is destroyed
+      arts_exit(status);
+    }
+#endif
+
     out3 << "\nReading control files:\n";
     for (Index i = 0; i < parameters.controlfiles.nelem(); ++i) {
       try {
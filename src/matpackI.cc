@@ -26,6 +26,7 @@
 #include <cstring>
 #include "blas.h"
 #include "exceptions.h"
+#include "matpack_alloc.h"
 
 using std::cout;
 using std::endl;
@@ -156,7 +157,8 @@ VectorView& VectorView::operator=(const ConstVectorView& v) {
   // Check that sizes are compatible:
   assert(mrange.mextent == v.mrange.mextent);
 
-  copy(v.begin(), v.end(), begin());
+  if (!copy_contiguous(contiguous(), v.contiguous()))
+    copy(v.begin(), v.end(), begin());
 
   return *this;
 }
@@ -167,7 +169,8 @@ VectorView& VectorView::operator=(const VectorView& v) {
   // Check that sizes are compatible:
   assert(mrange.mextent == v.mrange.mextent);
 
-  copy(v.begin(), v.end(), begin());
+  if (!copy_contiguous(contiguous(), v.contiguous()))
+    copy(v.begin(), v.end(), begin());
 
   return *this;
 }
@@ -178,35 +181,48 @@ VectorView& VectorView::operator=(const Vector& v) {
   // Check that sizes are compatible:
   assert(mrange.mextent == v.mrange.mextent);
 
-  copy(v.begin(), v.end(), begin());
+  if (!copy_contiguous(contiguous(), v.contiguous()))
+    copy(v.begin(), v.end(), begin());
 
   return *this;
 }
 
 VectorView& VectorView::operator=(Numeric x) {
-  copy(x, begin(), end());
+  if (!fill_contiguous(contiguous(), x)) copy(x, begin(), end());
   return *this;
 }
 
 VectorView VectorView::operator*=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a *= x; }))
+    return *this;
+
   const Iterator1D e = end();
   for (Iterator1D i = begin(); i != e; ++i) *i *= x;
   return *this;
 }
 
 VectorView VectorView::operator/=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a /= x; }))
+    return *this;
+
   const Iterator1D e = end();
   for (Iterator1D i = begin(); i != e; ++i) *i /= x;
   return *this;
 }
 
 VectorView VectorView::operator+=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a += x; }))
+    return *this;
+
   const Iterator1D e = end();
   for (Iterator1D i = begin(); i != e; ++i) *i += x;
   return *this;
 }
 
 VectorView VectorView::operator-=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a -= x; }))
+    return *this;
+
   const Iterator1D e = end();
   for (Iterator1D i = begin(); i != e; ++i) *i -= x;
   return *this;
@@ -214,6 +230,11 @@ VectorView VectorView::operator-=(Numeric x) {
 
 VectorView VectorView::operator*=(const ConstVectorView& x) {
   assert(nelem() == x.nelem());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a *= b; }))
+    return *this;
+
 
   ConstIterator1D s = x.begin();
 
@@ -226,6 +247,11 @@ VectorView VectorView::operator*=(const ConstVectorView& x) {
 
 VectorView VectorView::operator/=(const ConstVectorView& x) {
   assert(nelem() == x.nelem());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a /= b; }))
+    return *this;
+
 
   ConstIterator1D s = x.begin();
 
@@ -238,6 +264,11 @@ VectorView VectorView::operator/=(const ConstVectorView& x) {
 
 VectorView VectorView::operator+=(const ConstVectorView& x) {
   assert(nelem() == x.nelem());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a += b; }))
+    return *this;
+
 
   ConstIterator1D s = x.begin();
 
@@ -250,6 +281,11 @@ VectorView VectorView::operator+=(const ConstVectorView& x) {
 
 VectorView VectorView::operator-=(const ConstVectorView& x) {
   assert(nelem() == x.nelem());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a -= b; }))
+    return *this;
+
 
   ConstIterator1D s = x.begin();
 
@@ -318,23 +354,23 @@ void copy(Numeric x, Iterator1D target, const Iterator1D& end) {
 // ---------------------
 
 Vector::Vector(std::initializer_list<Numeric> init)
-    : VectorView(new Numeric[init.size()], Range(0, init.size())) {
+    : VectorView(matpack_alloc(init.size()), Range(0, init.size())) {
   std::copy(init.begin(), init.end(), begin());
 }
 
-Vector::Vector(Index n) : VectorView(new Numeric[n], Range(0, n)) {
+Vector::Vector(Index n) : VectorView(matpack_alloc(n), Range(0, n)) {
   // Nothing to do here.
 }
 
 Vector::Vector(Index n, Numeric fill)
-    : VectorView(new Numeric[n], Range(0, n)) {
+    : VectorView(matpack_alloc(n), Range(0, n)) {
   // Here we can access the raw memory directly, for slightly
   // increased efficiency:
   std::fill_n(mdata, n, fill);
 }
 
 Vector::Vector(Numeric start, Index extent, Numeric stride)
-    : VectorView(new Numeric[extent], Range(0, extent)) {
+    : VectorView(matpack_alloc(extent), Range(0, extent)) {
   // Fill with values:
   Numeric x = start;
   Iterator1D i = begin();
@@ -346,17 +382,17 @@ Vector::Vector(Numeric start, Index extent, Numeric stride)
 }
 
 Vector::Vector(const ConstVectorView& v)
-    : VectorView(new Numeric[v.nelem()], Range(0, v.nelem())) {
+    : VectorView(matpack_alloc(v.nelem()), Range(0, v.nelem())) {
   copy(v.begin(), v.end(), begin());
 }
 
 Vector::Vector(const Vector& v)
-    : VectorView(new Numeric[v.nelem()], Range(0, v.nelem())) {
+    : VectorView(matpack_alloc(v.nelem()), Range(0, v.nelem())) {
   std::memcpy(mdata, v.mdata, nelem() * sizeof(Numeric));
 }
 
 Vector::Vector(const std::vector<Numeric>& v)
-    : VectorView(new Numeric[v.size()], Range(0, v.size())) {
+    : VectorView(matpack_alloc(v.size()), Range(0, v.size())) {
   std::vector<Numeric>::const_iterator vec_it_end = v.end();
   Iterator1D this_it = this->begin();
   for (std::vector<Numeric>::const_iterator vec_it = v.begin();
@@ -381,11 +417,18 @@ Vector& Vector::operator=(const Vector& v) {
 
 Vector& Vector::operator=(Vector&& v) noexcept {
   if (this != &v) {
-    delete[] mdata;
+    // External data of the same size is kept, see adopt_external
+    if (mexternal && mrange.mextent == v.mrange.mextent) {
+      std::memcpy(mdata, v.mdata, nelem() * sizeof(Numeric));
+      return *this;
+    }
+    if (!mexternal) matpack_free(mdata);
     mdata = v.mdata;
+    mexternal = v.mexternal;
     mrange = v.mrange;
     v.mrange = Range(0, 0);
     v.mdata = nullptr;
+    v.mexternal = false;
   }
   return *this;
 }
@@ -404,20 +447,41 @@ Vector& Vector::operator=(Numeric x) {
 void Vector::resize(Index n) {
   assert(0 <= n);
   if (mrange.mextent != n) {
-    delete[] mdata;
-    mdata = new Numeric[n];
+    if (!mexternal) matpack_free(mdata);
+    mdata = matpack_alloc(n);
+    mexternal = false;
     mrange.mstart = 0;
     mrange.mextent = n;
     mrange.mstride = 1;
   }
 }
 
+void Vector::adopt_external(Numeric* data, Index n) {
+  assert(0 <= n);
+
+  if (!mexternal && mdata != data) matpack_free(mdata);
+  mdata = data;
+  mexternal = true;
+
+  mrange = Range(0, n);
+}
+
+void Vector::detach_external(const Numeric* data) {
+  if (!mexternal || mdata != data) return;
+
+  const Index n = nelem();
+  mdata = matpack_alloc(n);
+  std::memcpy(mdata, data, n * sizeof(Numeric));
+  mexternal = false;
+}
+
 void swap(Vector& v1, Vector& v2) {
   std::swap(v1.mrange, v2.mrange);
   std::swap(v1.mdata, v2.mdata);
+  std::swap(v1.mexternal, v2.mexternal);
 }
 
-Vector::~Vector() { delete[] mdata; }
+Vector::~Vector() { if (!mexternal) matpack_free(mdata); }
 
 // Functions for ConstMatrixView:
 // ------------------------------
@@ -635,7 +699,8 @@ MatrixView& MatrixView::operator=(const ConstMatrixView& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
@@ -649,7 +714,8 @@ MatrixView& MatrixView::operator=(const MatrixView& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
@@ -661,7 +727,8 @@ MatrixView& MatrixView::operator=(const Matrix& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
@@ -682,12 +749,15 @@ MatrixView& MatrixView::operator=(const ConstVectorView& v) {
 /** Assigning a scalar to a MatrixView will set all elements to this
     value. */
 MatrixView& MatrixView::operator=(Numeric x) {
-  copy(x, begin(), end());
+  if (!fill_contiguous(contiguous(), x)) copy(x, begin(), end());
   return *this;
 }
 
 /** Multiplication by scalar. */
 MatrixView& MatrixView::operator*=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a *= x; }))
+    return *this;
+
   const Iterator2D er = end();
   for (Iterator2D r = begin(); r != er; ++r) {
     const Iterator1D ec = r->end();
@@ -698,6 +768,9 @@ MatrixView& MatrixView::operator*=(Numeric x) {
 
 /** Division by scalar. */
 MatrixView& MatrixView::operator/=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a /= x; }))
+    return *this;
+
   const Iterator2D er = end();
   for (Iterator2D r = begin(); r != er; ++r) {
     const Iterator1D ec = r->end();
@@ -708,6 +781,9 @@ MatrixView& MatrixView::operator/=(Numeric x) {
 
 /** Addition of scalar. */
 MatrixView& MatrixView::operator+=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a += x; }))
+    return *this;
+
   const Iterator2D er = end();
   for (Iterator2D r = begin(); r != er; ++r) {
     const Iterator1D ec = r->end();
@@ -718,6 +794,9 @@ MatrixView& MatrixView::operator+=(Numeric x) {
 
 /** Subtraction of scalar. */
 MatrixView& MatrixView::operator-=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a -= x; }))
+    return *this;
+
   const Iterator2D er = end();
   for (Iterator2D r = begin(); r != er; ++r) {
     const Iterator1D ec = r->end();
@@ -760,6 +839,11 @@ Numeric* MatrixView::get_c_array() {
 MatrixView& MatrixView::operator*=(const ConstMatrixView& x) {
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a *= b; }))
+    return *this;
+
   ConstIterator2D sr = x.begin();
   Iterator2D r = begin();
   const Iterator2D er = end();
@@ -776,6 +860,11 @@ MatrixView& MatrixView::operator*=(const ConstMatrixView& x) {
 MatrixView& MatrixView::operator/=(const ConstMatrixView& x) {
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a /= b; }))
+    return *this;
+
   ConstIterator2D sr = x.begin();
   Iterator2D r = begin();
   const Iterator2D er = end();
@@ -792,6 +881,11 @@ MatrixView& MatrixView::operator/=(const ConstMatrixView& x) {
 MatrixView& MatrixView::operator+=(const ConstMatrixView& x) {
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a += b; }))
+    return *this;
+
   ConstIterator2D sr = x.begin();
   Iterator2D r = begin();
   const Iterator2D er = end();
@@ -808,6 +902,11 @@ MatrixView& MatrixView::operator+=(const ConstMatrixView& x) {
 MatrixView& MatrixView::operator-=(const ConstMatrixView& x) {
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a -= b; }))
+    return *this;
+
   ConstIterator2D sr = x.begin();
   Iterator2D r = begin();
   const Iterator2D er = end();
@@ -942,13 +1041,13 @@ void copy(Numeric x, Iterator2D target, const Iterator2D& end) {
 /** Constructor setting size. This constructor has to set the stride
     in the row range correctly! */
 Matrix::Matrix(Index r, Index c)
-    : MatrixView(new Numeric[r * c], Range(0, r, c), Range(0, c)) {
+    : MatrixView(matpack_alloc(r * c), Range(0, r, c), Range(0, c)) {
   // Nothing to do here.
 }
 
 /** Constructor setting size and filling with constant value. */
 Matrix::Matrix(Index r, Index c, Numeric fill)
-    : MatrixView(new Numeric[r * c], Range(0, r, c), Range(0, c)) {
+    : MatrixView(matpack_alloc(r * c), Range(0, r, c), Range(0, c)) {
   // Here we can access the raw memory directly, for slightly
   // increased efficiency:
   std::fill_n(mdata, r * c, fill);
@@ -957,7 +1056,7 @@ Matrix::Matrix(Index r, Index c, Numeric fill)
 /** Copy constructor from MatrixView. This automatically sets the size
     and copies the data. */
 Matrix::Matrix(const ConstMatrixView& m)
-    : MatrixView(new Numeric[m.nrows() * m.ncols()],
+    : MatrixView(matpack_alloc(m.nrows() * m.ncols()),
                  Range(0, m.nrows(), m.ncols()),
                  Range(0, m.ncols())) {
   copy(m.begin(), m.end(), begin());
@@ -966,7 +1065,7 @@ Matrix::Matrix(const ConstMatrixView& m)
 /** Copy constructor from Matrix. This automatically sets the size
     and copies the data. */
 Matrix::Matrix(const Matrix& m)
-    : MatrixView(new Numeric[m.nrows() * m.ncols()],
+    : MatrixView(matpack_alloc(m.nrows() * m.ncols()),
                  Range(0, m.nrows(), m.ncols()),
                  Range(0, m.ncols())) {
   // There is a catch here: If m is an empty matrix, then it will have
@@ -1012,13 +1111,21 @@ Matrix& Matrix::operator=(const Matrix& m) {
 //! Move assignment operator from another matrix.
 Matrix& Matrix::operator=(Matrix&& m) noexcept {
   if (this != &m) {
-    delete[] mdata;
+    // External data of the same size is kept, see adopt_external
+    if (mexternal && mrr.mextent == m.mrr.mextent &&
+        mcr.mextent == m.mcr.mextent) {
+      std::memcpy(mdata, m.mdata, nrows() * ncols() * sizeof(Numeric));
+      return *this;
+    }
+    if (!mexternal) matpack_free(mdata);
     mdata = m.mdata;
+    mexternal = m.mexternal;
     mrr = m.mrr;
     mcr = m.mcr;
     m.mrr = Range(0, 0);
     m.mcr = Range(0, 0);
     m.mdata = nullptr;
+    m.mexternal = false;
   }
   return *this;
 }
@@ -1058,8 +1165,9 @@ void Matrix::resize(Index r, Index c) {
   assert(0 <= c);
 
   if (mrr.mextent != r || mcr.mextent != c) {
-    delete[] mdata;
-    mdata = new Numeric[r * c];
+    if (!mexternal) matpack_free(mdata);
+    mdata = matpack_alloc(r * c);
+    mexternal = false;
 
     mrr.mstart = 0;
     mrr.mextent = r;
@@ -1071,11 +1179,33 @@ void Matrix::resize(Index r, Index c) {
   }
 }
 
+void Matrix::adopt_external(Numeric* data, Index r, Index c) {
+  assert(0 <= r);
+  assert(0 <= c);
+
+  if (!mexternal && mdata != data) matpack_free(mdata);
+  mdata = data;
+  mexternal = true;
+
+  mrr = Range(0, r, c);
+  mcr = Range(0, c);
+}
+
+void Matrix::detach_external(const Numeric* data) {
+  if (!mexternal || mdata != data) return;
+
+  const Index n = nrows() * ncols();
+  mdata = matpack_alloc(n);
+  std::memcpy(mdata, data, n * sizeof(Numeric));
+  mexternal = false;
+}
+
 /** Swaps two objects. */
 void swap(Matrix& m1, Matrix& m2) {
   std::swap(m1.mrr, m2.mrr);
   std::swap(m1.mcr, m2.mcr);
   std::swap(m1.mdata, m2.mdata);
+  std::swap(m1.mexternal, m2.mexternal);
 }
 
 /** Destructor for Matrix. This is important, since Matrix uses new to
@@ -1083,7 +1213,7 @@ void swap(Matrix& m1, Matrix& m2) {
 Matrix::~Matrix() {
   //   cout << "Destroying a Matrix:\n"
   //        << *this << "\n........................................\n";
-  delete[] mdata;
+  if (!mexternal) matpack_free(mdata);
 }
 
 // Some general Matrix Vector functions:
@@ -96,7 +96,9 @@
 #define matpackI_h
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include "array.h"
 #include "matpack.h"
 
@@ -355,6 +357,85 @@ class Range {
   Index mstride;
 };
 
+/** The elements of a view as one block of consecutive memory.
+
+    Returned by the contiguous() member of the views of all ranks, and used
+    by them to replace the iterator loops with flat loops when possible.
+    data is NULL if the elements of the view are not consecutive. */
+struct ContiguousBlock {
+  Numeric* data;
+  Index size;
+};
+
+/** Finds the memory block of a view.
+
+    \param[in] data   The data pointer of the view.
+    \param[in] ranges The ranges of the view, ordered from the outermost
+                      to the innermost dimension. Dimensions with an
+                      extent of one can have any stride.
+    \return The block, with data set to NULL if the elements are not
+            consecutive in memory. */
+inline ContiguousBlock contiguous_block(Numeric* data,
+                                        std::initializer_list<Range> ranges) {
+  Index n = 1;
+  Index start = 0;
+  for (const Range* r = ranges.end(); r != ranges.begin();) {
+    --r;
+    if (r->get_extent() > 1 && r->get_stride() != n) return {NULL, 0};
+    n *= r->get_extent();
+    start += r->get_start();
+  }
+  return {data + start, n};
+}
+
+/** Copies between two blocks of the same size.
+
+    The blocks may overlap, the result is then as if copied through a
+    temporary.
+
+    \return False, without copying, if any of the blocks is not contiguous. */
+inline bool copy_contiguous(const ContiguousBlock& to,
+                            const ContiguousBlock& from) {
+  if (!to.data || !from.data) return false;
+  assert(to.size == from.size);
+  if (to.size) std::memmove(to.data, from.data, to.size * sizeof(Numeric));
+  return true;
+}
+
+/** Sets all elements of a block to x.
+
+    \return False, doing nothing, if the block is not contiguous. */
+inline bool fill_contiguous(const ContiguousBlock& to, Numeric x) {
+  if (!to.data) return false;
+  std::fill_n(to.data, to.size, x);
+  return true;
+}
+
+/** Applies op(a) to all elements a of a block.
+
+    \return False, doing nothing, if the block is not contiguous. */
+template <typename Op>
+inline bool apply_contiguous(const ContiguousBlock& to, Op op) {
+  if (!to.data) return false;
+  for (Index i = 0; i < to.size; i++) op(to.data[i]);
+  return true;
+}
+
+/** Applies op(a, b) to all pairs of elements of two blocks of the same size.
+
+    The elements are visited in order, as the iterator loops do.
+
+    \return False, doing nothing, if any of the blocks is not contiguous. */
+template <typename Op>
+inline bool apply_contiguous(const ContiguousBlock& to,
+                             const ContiguousBlock& x,
+                             Op op) {
+  if (!to.data || !x.data) return false;
+  assert(to.size == x.size);
+  for (Index i = 0; i < to.size; i++) op(to.data[i], x.data[i]);
+  return true;
+}
+
 /** The iterator class for sub vectors. This takes into account the
     defined stride. */
 class Iterator1D {
@@ -488,6 +569,11 @@ class ConstVectorView {
   //! Returns true if variable size is zero.
   bool empty() const;
 
+  /** The elements as one block of memory, see ContiguousBlock. */
+  ContiguousBlock contiguous() const {
+    return contiguous_block(mdata, {mrange});
+  }
+
   /** Returns the number of elements.  The names `size' and `length'
     are already used by STL functions returning size_t. To avoid
     confusion we choose the name `nelem'. This is also more
@@ -890,8 +976,10 @@ class Vector : public VectorView {
   /** Copy constructor from Vector. This is important to override the
     automatically generated shallow constructor. We want deep copies!  */
   Vector(const Vector& v);
-  Vector(Vector&& v) noexcept : VectorView(std::forward<VectorView>(v)) {
+  Vector(Vector&& v) noexcept
+      : VectorView(std::forward<VectorView>(v)), mexternal(v.mexternal) {
     v.mdata = nullptr;
+    v.mexternal = false;
   }
 
   /** Converting constructor from std::vector<Numeric>. */
@@ -958,12 +1046,37 @@ class Vector : public VectorView {
     initialized, so it will contain random values.  */
   void resize(Index n);
 
+  /** Lets the Vector refer to external data, without copying.
+
+      The data is owned by the caller and must stay valid as long as it is
+      used. It is never released by matpack. The Vector keeps referring to it
+      until it is resized to other dimensions, or detached by
+      detach_external. Assignments of the same size, also by move, copy
+      to the external data.
+
+      \param[in] data  Contiguous data in row-major order.
+  */
+  void adopt_external(Numeric* data, Index n);
+
+  /** Copies external data to storage of the Vector itself.
+
+      Nothing is done if the Vector does not refer to the given external
+      data, see adopt_external.
+
+      \param[in] data  External data, as passed to adopt_external.
+  */
+  void detach_external(const Numeric* data);
+
   /** Swaps two objects. */
   friend void swap(Vector& v1, Vector& v2);
 
   /** Destructor for Vector. This is important, since Vector uses new to
     allocate storage. */
   virtual ~Vector();
+
+ private:
+  /** True if the data is external, see adopt_external. */
+  bool mexternal = false;
 };
 
 // Declare class Matrix:
@@ -991,6 +1104,12 @@ class ConstMatrixView {
 
   // Member functions:
   bool empty() const;
+
+  /** The elements as one block of memory, see ContiguousBlock. */
+  ContiguousBlock contiguous() const {
+    return contiguous_block(mdata, {mrr, mcr});
+  }
+
   Index nrows() const;
   Index ncols() const;
 
@@ -1198,8 +1317,10 @@ class Matrix : public MatrixView {
   Matrix(Index r, Index c, Numeric fill);
   Matrix(const ConstMatrixView& v);
   Matrix(const Matrix& v);
-  Matrix(Matrix&& v) noexcept : MatrixView(std::forward<MatrixView>(v)) {
+  Matrix(Matrix&& v) noexcept
+      : MatrixView(std::forward<MatrixView>(v)), mexternal(v.mexternal) {
     v.mdata = nullptr;
+    v.mexternal = false;
   }
 
   // Assignment operators:
@@ -1211,6 +1332,27 @@ class Matrix : public MatrixView {
   // Resize function:
   void resize(Index r, Index c);
 
+  /** Lets the Matrix refer to external data, without copying.
+
+      The data is owned by the caller and must stay valid as long as it is
+      used. It is never released by matpack. The Matrix keeps referring to it
+      until it is resized to other dimensions, or detached by
+      detach_external. Assignments of the same size, also by move, copy
+      to the external data.
+
+      \param[in] data  Contiguous data in row-major order.
+  */
+  void adopt_external(Numeric* data, Index r, Index c);
+
+  /** Copies external data to storage of the Matrix itself.
+
+      Nothing is done if the Matrix does not refer to the given external
+      data, see adopt_external.
+
+      \param[in] data  External data, as passed to adopt_external.
+  */
+  void detach_external(const Numeric* data);
+
   // Swap function:
   friend void swap(Matrix& m1, Matrix& m2);
 
@@ -1218,6 +1360,10 @@ class Matrix : public MatrixView {
   virtual ~Matrix();
 
   Numeric* get_raw_data() { return mdata; }
+
+ private:
+  /** True if the data is external, see adopt_external. */
+  bool mexternal = false;
 };
 
 // Function declarations:
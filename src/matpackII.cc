@@ -42,6 +42,7 @@
 
 // #include <vector>
 #include "matpackII.h"
+#include "arts_omp.h"
 #include <Eigen/Core>
 #include <algorithm>
 #include <cmath>
@@ -137,6 +138,43 @@ Numeric Sparse::ro(Index r, Index c) const {
   return matrix.coeff((int)r, (int)c);
 }
 
+//! Column of the largest element of a row.
+/*!
+  Gives the same result as looping over all columns with the read only
+  index operator and keeping the first maximum, but only visits the
+  stored elements of the row.
+
+  \param r Row index.
+
+  \return Column index of the (first) largest element in row r.
+*/
+Index Sparse::max_element_column(Index r) const {
+  assert(0 <= r);
+  assert(r < nrows());
+
+  typedef Eigen::SparseMatrix<Numeric, Eigen::RowMajor>::InnerIterator
+      RowIterator;
+
+  Index cmax = -1, cfirst_zero = -1, c_expected = 0;
+  Numeric rmax = 0;
+  for (RowIterator it(matrix, r); it; ++it) {
+    const Index c = it.index();
+    if (cfirst_zero < 0 && c > c_expected) cfirst_zero = c_expected;
+    c_expected = c + 1;
+    if (cmax < 0 || it.value() > rmax) {
+      rmax = it.value();
+      cmax = c;
+    }
+  }
+  if (cfirst_zero < 0 && c_expected < ncols()) cfirst_zero = c_expected;
+
+  // Implicit zeros win if no stored element is positive
+  if (cfirst_zero >= 0 &&
+      (cmax < 0 || rmax < 0 || (rmax == 0 && cfirst_zero < cmax)))
+    return cfirst_zero;
+  return cmax;
+}
+
 // Constructors
 // ------------
 
@@ -493,29 +531,69 @@ void mult(MatrixView A, const Sparse& B, const ConstMatrixView& C) {
   assert(A.ncols() == C.ncols());
   assert(B.ncols() == C.nrows());
 
-  // Typedefs for Eigen interface
-  typedef Eigen::
-      Matrix<Numeric, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
-          EigenMatrix;
-  typedef Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic> Stride;
-  typedef Eigen::Map<EigenMatrix, 0, Stride> MatrixMap;
-
-  Index row_stride, column_stride;
-  row_stride = C.mrr.get_stride();
-  column_stride = C.mcr.get_stride();
-
-  Numeric* data;
-  data = C.mdata + C.mrr.get_start() + C.mcr.get_start();
-  Stride c_stride(row_stride, column_stride);
-  MatrixMap C_map(data, C.nrows(), C.ncols(), c_stride);
-
-  row_stride = A.mrr.get_stride();
-  column_stride = A.mcr.get_stride();
-  data = A.mdata + A.mrr.get_start() + A.mcr.get_start();
-  Stride a_stride(row_stride, column_stride);
-  MatrixMap A_map(data, A.nrows(), A.ncols(), a_stride);
+  // The product is done row by row of B, so that each non-zero element of
+  // B is applied to a complete row of C. For the common case of row-major
+  // A and C this makes the inner loop contiguous, and rows of A can be
+  // filled independently by different threads.
+  const Index nr = A.nrows();
+  const Index nc = A.ncols();
+
+  Numeric* const a = A.mdata + A.mrr.get_start() + A.mcr.get_start();
+  const Index a_rs = A.mrr.get_stride();
+  const Index a_cs = A.mcr.get_stride();
+  const Numeric* const c = C.mdata + C.mrr.get_start() + C.mcr.get_start();
+  const Index c_rs = C.mrr.get_stride();
+  const Index c_cs = C.mcr.get_stride();
+
+  // A is zeroed and then accumulated into, which requires that C is not
+  // stored in the same memory. Otherwise the product goes via a copy.
+  if (nr > 0 && nc > 0 && C.nrows() > 0) {
+    // Memory span of a view, strides may be negative
+    const auto span = [nc](const Numeric* p,
+                           const Index n,
+                           const Index rs,
+                           const Index cs) {
+      const Numeric* const q = p + (n - 1) * rs + (nc - 1) * cs;
+      const Numeric* const r = p + (n - 1) * rs;
+      const Numeric* const t = p + (nc - 1) * cs;
+      return std::make_pair(std::min({p, q, r, t}), std::max({p, q, r, t}));
+    };
+    const auto a_span = span(a, nr, a_rs, a_cs);
+    const auto c_span = span(c, C.nrows(), c_rs, c_cs);
+    if (a_span.first <= c_span.second && c_span.first <= a_span.second) {
+      Matrix A_tmp(nr, nc);
+      mult(A_tmp, B, C);
+      A = A_tmp;
+      return;
+    }
+  }
 
-  A_map = B.matrix * C_map;
+  typedef Eigen::SparseMatrix<Numeric, Eigen::RowMajor>::InnerIterator
+      RowIterator;
+
+  // Only go parallel when there is enough work to make it worthwhile.
+  const bool do_parallel =
+      !arts_omp_in_parallel() && nr > 1 && B.nnz() * nc > 100000;
+
+#pragma omp parallel for if (do_parallel) schedule(guided)
+  for (Index i = 0; i < nr; ++i) {
+    Numeric* const ai = a + i * a_rs;
+    if (a_cs == 1 && c_cs == 1) {
+      std::fill(ai, ai + nc, 0.0);
+      for (RowIterator it(B.matrix, i); it; ++it) {
+        const Numeric v = it.value();
+        const Numeric* const cj = c + it.index() * c_rs;
+        for (Index k = 0; k < nc; ++k) ai[k] += v * cj[k];
+      }
+    } else {
+      for (Index k = 0; k < nc; ++k) ai[k * a_cs] = 0.0;
+      for (RowIterator it(B.matrix, i); it; ++it) {
+        const Numeric v = it.value();
+        const Numeric* const cj = c + it.index() * c_rs;
+        for (Index k = 0; k < nc; ++k) ai[k * a_cs] += v * cj[k * c_cs];
+      }
+    }
+  }
 }
 
 //! Matrix - SparseMatrix multiplication.
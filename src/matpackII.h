@@ -103,6 +103,8 @@ class Sparse {
   Numeric ro(Index r, Index c) const;
   Numeric operator()(Index r, Index c) const;
 
+  Index max_element_column(Index r) const;
+
   // Arithmetic operators:
   Sparse& operator+=(const Sparse& x);
   Sparse& operator-=(const Sparse& x);
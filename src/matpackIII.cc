@@ -23,6 +23,7 @@
 */
 
 #include "matpackIII.h"
+#include "matpack_alloc.h"
 #include "exceptions.h"
 
 using std::runtime_error;
@@ -350,7 +351,8 @@ Tensor3View& Tensor3View::operator=(const ConstTensor3View& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
@@ -365,7 +367,8 @@ Tensor3View& Tensor3View::operator=(const Tensor3View& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
@@ -378,14 +381,15 @@ Tensor3View& Tensor3View::operator=(const Tensor3& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
 /** Assigning a scalar to a Tensor3View will set all elements to this
     value. */
 Tensor3View& Tensor3View::operator=(Numeric x) {
-  copy(x, begin(), end());
+  if (!fill_contiguous(contiguous(), x)) copy(x, begin(), end());
   return *this;
 }
 
@@ -396,6 +400,9 @@ Numeric add(Numeric x, Numeric y) { return x + y; }
 
 /** Multiplication by scalar. */
 Tensor3View& Tensor3View::operator*=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a *= x; }))
+    return *this;
+
   const Iterator3D ep = end();
   for (Iterator3D p = begin(); p != ep; ++p) {
     *p *= x;
@@ -405,6 +412,9 @@ Tensor3View& Tensor3View::operator*=(Numeric x) {
 
 /** Division by scalar. */
 Tensor3View& Tensor3View::operator/=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a /= x; }))
+    return *this;
+
   const Iterator3D ep = end();
   for (Iterator3D p = begin(); p != ep; ++p) {
     *p /= x;
@@ -414,6 +424,9 @@ Tensor3View& Tensor3View::operator/=(Numeric x) {
 
 /** Addition of scalar. */
 Tensor3View& Tensor3View::operator+=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a += x; }))
+    return *this;
+
   const Iterator3D ep = end();
   for (Iterator3D p = begin(); p != ep; ++p) {
     *p += x;
@@ -423,6 +436,9 @@ Tensor3View& Tensor3View::operator+=(Numeric x) {
 
 /** Subtraction of scalar. */
 Tensor3View& Tensor3View::operator-=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a -= x; }))
+    return *this;
+
   const Iterator3D ep = end();
   for (Iterator3D p = begin(); p != ep; ++p) {
     *p -= x;
@@ -435,6 +451,11 @@ Tensor3View& Tensor3View::operator*=(const ConstTensor3View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a *= b; }))
+    return *this;
+
   ConstIterator3D xp = x.begin();
   Iterator3D p = begin();
   const Iterator3D ep = end();
@@ -449,6 +470,11 @@ Tensor3View& Tensor3View::operator/=(const ConstTensor3View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a /= b; }))
+    return *this;
+
   ConstIterator3D xp = x.begin();
   Iterator3D p = begin();
   const Iterator3D ep = end();
@@ -463,6 +489,11 @@ Tensor3View& Tensor3View::operator+=(const ConstTensor3View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a += b; }))
+    return *this;
+
   ConstIterator3D xp = x.begin();
   Iterator3D p = begin();
   const Iterator3D ep = end();
@@ -477,6 +508,11 @@ Tensor3View& Tensor3View::operator-=(const ConstTensor3View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a -= b; }))
+    return *this;
+
   ConstIterator3D xp = x.begin();
   Iterator3D p = begin();
   const Iterator3D ep = end();
@@ -560,7 +596,7 @@ void copy(Numeric x, Iterator3D target, const Iterator3D& end) {
 /** Constructor setting size. This constructor has to set the strides
     in the page and row ranges correctly! */
 Tensor3::Tensor3(Index p, Index r, Index c)
-    : Tensor3View(new Numeric[p * r * c],
+    : Tensor3View(matpack_alloc(p * r * c),
                   Range(0, p, r * c),
                   Range(0, r, c),
                   Range(0, c)) {
@@ -569,7 +605,7 @@ Tensor3::Tensor3(Index p, Index r, Index c)
 
 /** Constructor setting size and filling with constant value. */
 Tensor3::Tensor3(Index p, Index r, Index c, Numeric fill)
-    : Tensor3View(new Numeric[p * r * c],
+    : Tensor3View(matpack_alloc(p * r * c),
                   Range(0, p, r * c),
                   Range(0, r, c),
                   Range(0, c)) {
@@ -581,7 +617,7 @@ Tensor3::Tensor3(Index p, Index r, Index c, Numeric fill)
 /** Copy constructor from Tensor3View. This automatically sets the size
     and copies the data. */
 Tensor3::Tensor3(const ConstTensor3View& m)
-    : Tensor3View(new Numeric[m.npages() * m.nrows() * m.ncols()],
+    : Tensor3View(matpack_alloc(m.npages() * m.nrows() * m.ncols()),
                   Range(0, m.npages(), m.nrows() * m.ncols()),
                   Range(0, m.nrows(), m.ncols()),
                   Range(0, m.ncols())) {
@@ -591,7 +627,7 @@ Tensor3::Tensor3(const ConstTensor3View& m)
 /** Copy constructor from Tensor3. This automatically sets the size
     and copies the data. */
 Tensor3::Tensor3(const Tensor3& m)
-    : Tensor3View(new Numeric[m.npages() * m.nrows() * m.ncols()],
+    : Tensor3View(matpack_alloc(m.npages() * m.nrows() * m.ncols()),
                   Range(0, m.npages(), m.nrows() * m.ncols()),
                   Range(0, m.nrows(), m.ncols()),
                   Range(0, m.ncols())) {
@@ -638,8 +674,17 @@ Tensor3& Tensor3::operator=(const Tensor3& x) {
 //! Move assignment operator from another tensor.
 Tensor3& Tensor3::operator=(Tensor3&& x) noexcept {
   if (this != &x) {
-    delete[] mdata;
+    // External data of the same size is kept, see adopt_external
+    if (mexternal && mpr.mextent == x.mpr.mextent &&
+        mrr.mextent == x.mrr.mextent && mcr.mextent == x.mcr.mextent) {
+      std::memcpy(mdata,
+                  x.mdata,
+                  npages() * nrows() * ncols() * sizeof(Numeric));
+      return *this;
+    }
+    if (!mexternal) matpack_free(mdata);
     mdata = x.mdata;
+    mexternal = x.mexternal;
     mpr = x.mpr;
     mrr = x.mrr;
     mcr = x.mcr;
@@ -647,6 +692,7 @@ Tensor3& Tensor3::operator=(Tensor3&& x) noexcept {
     x.mrr = Range(0, 0);
     x.mcr = Range(0, 0);
     x.mdata = nullptr;
+    x.mexternal = false;
   }
   return *this;
 }
@@ -667,8 +713,9 @@ void Tensor3::resize(Index p, Index r, Index c) {
   assert(0 <= c);
 
   if (mpr.mextent != p || mrr.mextent != r || mcr.mextent != c) {
-    delete[] mdata;
-    mdata = new Numeric[p * r * c];
+    if (!mexternal) matpack_free(mdata);
+    mdata = matpack_alloc(p * r * c);
+    mexternal = false;
 
     mpr.mstart = 0;
     mpr.mextent = p;
@@ -684,12 +731,36 @@ void Tensor3::resize(Index p, Index r, Index c) {
   }
 }
 
+void Tensor3::adopt_external(Numeric* data, Index p, Index r, Index c) {
+  assert(0 <= p);
+  assert(0 <= r);
+  assert(0 <= c);
+
+  if (!mexternal && mdata != data) matpack_free(mdata);
+  mdata = data;
+  mexternal = true;
+
+  mpr = Range(0, p, r * c);
+  mrr = Range(0, r, c);
+  mcr = Range(0, c);
+}
+
+void Tensor3::detach_external(const Numeric* data) {
+  if (!mexternal || mdata != data) return;
+
+  const Index n = npages() * nrows() * ncols();
+  mdata = matpack_alloc(n);
+  std::memcpy(mdata, data, n * sizeof(Numeric));
+  mexternal = false;
+}
+
 /** Swaps two objects. */
 void swap(Tensor3& t1, Tensor3& t2) {
   std::swap(t1.mpr, t2.mpr);
   std::swap(t1.mrr, t2.mrr);
   std::swap(t1.mcr, t2.mcr);
   std::swap(t1.mdata, t2.mdata);
+  std::swap(t1.mexternal, t2.mexternal);
 }
 
 /** Destructor for Tensor3. This is important, since Tensor3 uses new to
@@ -697,7 +768,7 @@ void swap(Tensor3& t1, Tensor3& t2) {
 Tensor3::~Tensor3() {
   //   cout << "Destroying a Tensor3:\n"
   //        << *this << "\n........................................\n";
-  delete[] mdata;
+  if (!mexternal) matpack_free(mdata);
 }
 
 /** A generic transform function for tensors, which can be used to
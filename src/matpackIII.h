@@ -140,6 +140,11 @@ class ConstTensor3View {
 
   bool empty() const;
 
+  /** The elements as one block of memory, see ContiguousBlock. */
+  ContiguousBlock contiguous() const {
+    return contiguous_block(mdata, {mpr, mrr, mcr});
+  }
+
   /** Returns the number of pages. */
   Index npages() const { return mpr.mextent; }
 
@@ -344,8 +349,10 @@ class Tensor3 : public Tensor3View {
   Tensor3(Index p, Index r, Index c, Numeric fill);
   Tensor3(const ConstTensor3View& v);
   Tensor3(const Tensor3& v);
-  Tensor3(Tensor3&& v) noexcept : Tensor3View(std::forward<Tensor3View>(v)) {
+  Tensor3(Tensor3&& v) noexcept
+      : Tensor3View(std::forward<Tensor3View>(v)), mexternal(v.mexternal) {
     v.mdata = nullptr;
+    v.mexternal = false;
   }
 
   // Assignment operators:
@@ -356,11 +363,36 @@ class Tensor3 : public Tensor3View {
   // Resize function:
   void resize(Index p, Index r, Index c);
 
+  /** Lets the Tensor3 refer to external data, without copying.
+
+      The data is owned by the caller and must stay valid as long as it is
+      used. It is never released by matpack. The Tensor3 keeps referring to it
+      until it is resized to other dimensions, or detached by
+      detach_external. Assignments of the same size, also by move, copy
+      to the external data.
+
+      \param[in] data  Contiguous data in row-major order.
+  */
+  void adopt_external(Numeric* data, Index p, Index r, Index c);
+
+  /** Copies external data to storage of the Tensor3 itself.
+
+      Nothing is done if the Tensor3 does not refer to the given external
+      data, see adopt_external.
+
+      \param[in] data  External data, as passed to adopt_external.
+  */
+  void detach_external(const Numeric* data);
+
   // Swap function:
   friend void swap(Tensor3& t1, Tensor3& t2);
 
   // Destructor:
   virtual ~Tensor3();
+
+ private:
+  /** True if the data is external, see adopt_external. */
+  bool mexternal = false;
 };
 
 // Function declarations:
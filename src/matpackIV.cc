@@ -23,6 +23,7 @@
 */
 
 #include "matpackIV.h"
+#include "matpack_alloc.h"
 #include "exceptions.h"
 
 using std::runtime_error;
@@ -727,7 +728,8 @@ Tensor4View& Tensor4View::operator=(const ConstTensor4View& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
@@ -743,7 +745,8 @@ Tensor4View& Tensor4View::operator=(const Tensor4View& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
@@ -757,14 +760,15 @@ Tensor4View& Tensor4View::operator=(const Tensor4& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
 /** Assigning a scalar to a Tensor4View will set all elements to this
     value. */
 Tensor4View& Tensor4View::operator=(Numeric x) {
-  copy(x, begin(), end());
+  if (!fill_contiguous(contiguous(), x)) copy(x, begin(), end());
   return *this;
 }
 
@@ -773,6 +777,9 @@ Tensor4View& Tensor4View::operator=(Numeric x) {
 
 /** Multiplication by scalar. */
 Tensor4View& Tensor4View::operator*=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a *= x; }))
+    return *this;
+
   const Iterator4D eb = end();
   for (Iterator4D b = begin(); b != eb; ++b) {
     *b *= x;
@@ -782,6 +789,9 @@ Tensor4View& Tensor4View::operator*=(Numeric x) {
 
 /** Division by scalar. */
 Tensor4View& Tensor4View::operator/=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a /= x; }))
+    return *this;
+
   const Iterator4D eb = end();
   for (Iterator4D b = begin(); b != eb; ++b) {
     *b /= x;
@@ -791,6 +801,9 @@ Tensor4View& Tensor4View::operator/=(Numeric x) {
 
 /** Addition of scalar. */
 Tensor4View& Tensor4View::operator+=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a += x; }))
+    return *this;
+
   const Iterator4D eb = end();
   for (Iterator4D b = begin(); b != eb; ++b) {
     *b += x;
@@ -800,6 +813,9 @@ Tensor4View& Tensor4View::operator+=(Numeric x) {
 
 /** Subtraction of scalar. */
 Tensor4View& Tensor4View::operator-=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a -= x; }))
+    return *this;
+
   const Iterator4D eb = end();
   for (Iterator4D b = begin(); b != eb; ++b) {
     *b -= x;
@@ -813,6 +829,11 @@ Tensor4View& Tensor4View::operator*=(const ConstTensor4View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a *= b; }))
+    return *this;
+
   ConstIterator4D xb = x.begin();
   Iterator4D b = begin();
   const Iterator4D eb = end();
@@ -828,6 +849,11 @@ Tensor4View& Tensor4View::operator/=(const ConstTensor4View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a /= b; }))
+    return *this;
+
   ConstIterator4D xb = x.begin();
   Iterator4D b = begin();
   const Iterator4D eb = end();
@@ -843,6 +869,11 @@ Tensor4View& Tensor4View::operator+=(const ConstTensor4View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a += b; }))
+    return *this;
+
   ConstIterator4D xb = x.begin();
   Iterator4D b = begin();
   const Iterator4D eb = end();
@@ -858,6 +889,11 @@ Tensor4View& Tensor4View::operator-=(const ConstTensor4View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a -= b; }))
+    return *this;
+
   ConstIterator4D xb = x.begin();
   Iterator4D b = begin();
   const Iterator4D eb = end();
@@ -950,7 +986,7 @@ void copy(Numeric x, Iterator4D target, const Iterator4D& end) {
 /** Constructor setting size. This constructor has to set the strides
     in the book, page and row ranges correctly! */
 Tensor4::Tensor4(Index b, Index p, Index r, Index c)
-    : Tensor4View(new Numeric[b * p * r * c],
+    : Tensor4View(matpack_alloc(b * p * r * c),
                   Range(0, b, p * r * c),
                   Range(0, p, r * c),
                   Range(0, r, c),
@@ -960,7 +996,7 @@ Tensor4::Tensor4(Index b, Index p, Index r, Index c)
 
 /** Constructor setting size and filling with constant value. */
 Tensor4::Tensor4(Index b, Index p, Index r, Index c, Numeric fill)
-    : Tensor4View(new Numeric[b * p * r * c],
+    : Tensor4View(matpack_alloc(b * p * r * c),
                   Range(0, b, p * r * c),
                   Range(0, p, r * c),
                   Range(0, r, c),
@@ -973,22 +1009,24 @@ Tensor4::Tensor4(Index b, Index p, Index r, Index c, Numeric fill)
 /** Copy constructor from Tensor4View. This automatically sets the size
     and copies the data. */
 Tensor4::Tensor4(const ConstTensor4View& m)
-    : Tensor4View(new Numeric[m.nbooks() * m.npages() * m.nrows() * m.ncols()],
-                  Range(0, m.nbooks(), m.npages() * m.nrows() * m.ncols()),
-                  Range(0, m.npages(), m.nrows() * m.ncols()),
-                  Range(0, m.nrows(), m.ncols()),
-                  Range(0, m.ncols())) {
+    : Tensor4View(
+          matpack_alloc(m.nbooks() * m.npages() * m.nrows() * m.ncols()),
+          Range(0, m.nbooks(), m.npages() * m.nrows() * m.ncols()),
+          Range(0, m.npages(), m.nrows() * m.ncols()),
+          Range(0, m.nrows(), m.ncols()),
+          Range(0, m.ncols())) {
   copy(m.begin(), m.end(), begin());
 }
 
 /** Copy constructor from Tensor4. This automatically sets the size
     and copies the data. */
 Tensor4::Tensor4(const Tensor4& m)
-    : Tensor4View(new Numeric[m.nbooks() * m.npages() * m.nrows() * m.ncols()],
-                  Range(0, m.nbooks(), m.npages() * m.nrows() * m.ncols()),
-                  Range(0, m.npages(), m.nrows() * m.ncols()),
-                  Range(0, m.nrows(), m.ncols()),
-                  Range(0, m.ncols())) {
+    : Tensor4View(
+          matpack_alloc(m.nbooks() * m.npages() * m.nrows() * m.ncols()),
+          Range(0, m.nbooks(), m.npages() * m.nrows() * m.ncols()),
+          Range(0, m.npages(), m.nrows() * m.ncols()),
+          Range(0, m.nrows(), m.ncols()),
+          Range(0, m.ncols())) {
   // There is a catch here: If m is an empty tensor, then it will have
   // dimensions of size 0. But these are used to initialize the stride
   // for higher dimensions! Thus, this method has to be consistent
@@ -1036,8 +1074,18 @@ Tensor4& Tensor4::operator=(const Tensor4& x) {
 //! Move assignment operator from another tensor.
 Tensor4& Tensor4::operator=(Tensor4&& x) noexcept {
   if (this != &x) {
-    delete[] mdata;
+    // External data of the same size is kept, see adopt_external
+    if (mexternal && mbr.mextent == x.mbr.mextent &&
+        mpr.mextent == x.mpr.mextent && mrr.mextent == x.mrr.mextent &&
+        mcr.mextent == x.mcr.mextent) {
+      std::memcpy(mdata,
+                  x.mdata,
+                  nbooks() * npages() * nrows() * ncols() * sizeof(Numeric));
+      return *this;
+    }
+    if (!mexternal) matpack_free(mdata);
     mdata = x.mdata;
+    mexternal = x.mexternal;
     mbr = x.mbr;
     mpr = x.mpr;
     mrr = x.mrr;
@@ -1047,6 +1095,7 @@ Tensor4& Tensor4::operator=(Tensor4&& x) noexcept {
     x.mrr = Range(0, 0);
     x.mcr = Range(0, 0);
     x.mdata = nullptr;
+    x.mexternal = false;
   }
   return *this;
 }
@@ -1069,8 +1118,9 @@ void Tensor4::resize(Index b, Index p, Index r, Index c) {
 
   if (mbr.mextent != b || mpr.mextent != p || mrr.mextent != r ||
       mcr.mextent != c) {
-    delete[] mdata;
-    mdata = new Numeric[b * p * r * c];
+    if (!mexternal) matpack_free(mdata);
+    mdata = matpack_alloc(b * p * r * c);
+    mexternal = false;
 
     mbr.mstart = 0;
     mbr.mextent = b;
@@ -1090,6 +1140,35 @@ void Tensor4::resize(Index b, Index p, Index r, Index c) {
   }
 }
 
+void Tensor4::adopt_external(Numeric* data,
+                             Index b,
+                             Index p,
+                             Index r,
+                             Index c) {
+  assert(0 <= b);
+  assert(0 <= p);
+  assert(0 <= r);
+  assert(0 <= c);
+
+  if (!mexternal && mdata != data) matpack_free(mdata);
+  mdata = data;
+  mexternal = true;
+
+  mbr = Range(0, b, p * r * c);
+  mpr = Range(0, p, r * c);
+  mrr = Range(0, r, c);
+  mcr = Range(0, c);
+}
+
+void Tensor4::detach_external(const Numeric* data) {
+  if (!mexternal || mdata != data) return;
+
+  const Index n = nbooks() * npages() * nrows() * ncols();
+  mdata = matpack_alloc(n);
+  std::memcpy(mdata, data, n * sizeof(Numeric));
+  mexternal = false;
+}
+
 /** Swaps two objects. */
 void swap(Tensor4& t1, Tensor4& t2) {
   std::swap(t1.mbr, t2.mbr);
@@ -1097,6 +1176,7 @@ void swap(Tensor4& t1, Tensor4& t2) {
   std::swap(t1.mrr, t2.mrr);
   std::swap(t1.mcr, t2.mcr);
   std::swap(t1.mdata, t2.mdata);
+  std::swap(t1.mexternal, t2.mexternal);
 }
 
 /** Destructor for Tensor4. This is important, since Tensor4 uses new to
@@ -1104,7 +1184,7 @@ void swap(Tensor4& t1, Tensor4& t2) {
 Tensor4::~Tensor4() {
   //   cout << "Destroying a Tensor4:\n"
   //        << *this << "\n........................................\n";
-  delete[] mdata;
+  if (!mexternal) matpack_free(mdata);
 }
 
 /** A generic transform function for tensors, which can be used to
@@ -141,6 +141,11 @@ class ConstTensor4View {
 
   bool empty() const;
 
+  /** The elements as one block of memory, see ContiguousBlock. */
+  ContiguousBlock contiguous() const {
+    return contiguous_block(mdata, {mbr, mpr, mrr, mcr});
+  }
+
   Index nbooks() const;
   Index npages() const;
   Index nrows() const;
@@ -426,8 +431,10 @@ class Tensor4 : public Tensor4View {
   Tensor4(Index b, Index p, Index r, Index c, Numeric fill);
   Tensor4(const ConstTensor4View& v);
   Tensor4(const Tensor4& v);
-  Tensor4(Tensor4&& v) noexcept : Tensor4View(std::forward<Tensor4View>(v)) {
+  Tensor4(Tensor4&& v) noexcept
+      : Tensor4View(std::forward<Tensor4View>(v)), mexternal(v.mexternal) {
     v.mdata = nullptr;
+    v.mexternal = false;
   }
 
   // Assignment operators:
@@ -438,11 +445,36 @@ class Tensor4 : public Tensor4View {
   // Resize function:
   void resize(Index b, Index p, Index r, Index c);
 
+  /** Lets the Tensor4 refer to external data, without copying.
+
+      The data is owned by the caller and must stay valid as long as it is
+      used. It is never released by matpack. The Tensor4 keeps referring to it
+      until it is resized to other dimensions, or detached by
+      detach_external. Assignments of the same size, also by move, copy
+      to the external data.
+
+      \param[in] data  Contiguous data in row-major order.
+  */
+  void adopt_external(Numeric* data, Index b, Index p, Index r, Index c);
+
+  /** Copies external data to storage of the Tensor4 itself.
+
+      Nothing is done if the Tensor4 does not refer to the given external
+      data, see adopt_external.
+
+      \param[in] data  External data, as passed to adopt_external.
+  */
+  void detach_external(const Numeric* data);
+
   // Swap function:
   friend void swap(Tensor4& t1, Tensor4& t2);
 
   // Destructor:
   virtual ~Tensor4();
+
+ private:
+  /** True if the data is external, see adopt_external. */
+  bool mexternal = false;
 };
 
 // Function declarations:
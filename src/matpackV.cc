@@ -23,6 +23,7 @@
 */
 
 #include "matpackV.h"
+#include "matpack_alloc.h"
 #include "exceptions.h"
 
 using std::runtime_error;
@@ -1378,7 +1379,8 @@ Tensor5View& Tensor5View::operator=(const ConstTensor5View& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
@@ -1395,7 +1397,8 @@ Tensor5View& Tensor5View::operator=(const Tensor5View& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
@@ -1410,14 +1413,15 @@ Tensor5View& Tensor5View::operator=(const Tensor5& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
 /** Assigning a scalar to a Tensor5View will set all elements to this
     value. */
 Tensor5View& Tensor5View::operator=(Numeric x) {
-  copy(x, begin(), end());
+  if (!fill_contiguous(contiguous(), x)) copy(x, begin(), end());
   return *this;
 }
 
@@ -1426,6 +1430,9 @@ Tensor5View& Tensor5View::operator=(Numeric x) {
 
 /** Multiplication by scalar. */
 Tensor5View& Tensor5View::operator*=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a *= x; }))
+    return *this;
+
   const Iterator5D es = end();
   for (Iterator5D s = begin(); s != es; ++s) {
     *s *= x;
@@ -1435,6 +1442,9 @@ Tensor5View& Tensor5View::operator*=(Numeric x) {
 
 /** Division by scalar. */
 Tensor5View& Tensor5View::operator/=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a /= x; }))
+    return *this;
+
   const Iterator5D es = end();
   for (Iterator5D s = begin(); s != es; ++s) {
     *s /= x;
@@ -1444,6 +1454,9 @@ Tensor5View& Tensor5View::operator/=(Numeric x) {
 
 /** Addition of scalar. */
 Tensor5View& Tensor5View::operator+=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a += x; }))
+    return *this;
+
   const Iterator5D es = end();
   for (Iterator5D s = begin(); s != es; ++s) {
     *s += x;
@@ -1453,6 +1466,9 @@ Tensor5View& Tensor5View::operator+=(Numeric x) {
 
 /** Subtraction of scalar. */
 Tensor5View& Tensor5View::operator-=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a -= x; }))
+    return *this;
+
   const Iterator5D es = end();
   for (Iterator5D s = begin(); s != es; ++s) {
     *s -= x;
@@ -1467,6 +1483,11 @@ Tensor5View& Tensor5View::operator*=(const ConstTensor5View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a *= b; }))
+    return *this;
+
   ConstIterator5D xs = x.begin();
   Iterator5D s = begin();
   const Iterator5D es = end();
@@ -1483,6 +1504,11 @@ Tensor5View& Tensor5View::operator/=(const ConstTensor5View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a /= b; }))
+    return *this;
+
   ConstIterator5D xs = x.begin();
   Iterator5D s = begin();
   const Iterator5D es = end();
@@ -1499,6 +1525,11 @@ Tensor5View& Tensor5View::operator+=(const ConstTensor5View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a += b; }))
+    return *this;
+
   ConstIterator5D xs = x.begin();
   Iterator5D s = begin();
   const Iterator5D es = end();
@@ -1515,6 +1546,11 @@ Tensor5View& Tensor5View::operator-=(const ConstTensor5View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a -= b; }))
+    return *this;
+
   ConstIterator5D xs = x.begin();
   Iterator5D s = begin();
   const Iterator5D es = end();
@@ -1615,7 +1651,7 @@ void copy(Numeric x, Iterator5D target, const Iterator5D& end) {
 /** Constructor setting size. This constructor has to set the strides
     in the shelf, book, page and row ranges correctly! */
 Tensor5::Tensor5(Index s, Index b, Index p, Index r, Index c)
-    : Tensor5View(new Numeric[s * b * p * r * c],
+    : Tensor5View(matpack_alloc(s * b * p * r * c),
                   Range(0, s, b * p * r * c),
                   Range(0, b, p * r * c),
                   Range(0, p, r * c),
@@ -1626,7 +1662,7 @@ Tensor5::Tensor5(Index s, Index b, Index p, Index r, Index c)
 
 /** Constructor setting size and filling with constant value. */
 Tensor5::Tensor5(Index s, Index b, Index p, Index r, Index c, Numeric fill)
-    : Tensor5View(new Numeric[s * b * p * r * c],
+    : Tensor5View(matpack_alloc(s * b * p * r * c),
                   Range(0, s, b * p * r * c),
                   Range(0, b, p * r * c),
                   Range(0, p, r * c),
@@ -1641,8 +1677,8 @@ Tensor5::Tensor5(Index s, Index b, Index p, Index r, Index c, Numeric fill)
     and copies the data. */
 Tensor5::Tensor5(const ConstTensor5View& m)
     : Tensor5View(
-          new Numeric[m.nshelves() * m.nbooks() * m.npages() * m.nrows() *
-                      m.ncols()],
+          matpack_alloc(m.nshelves() * m.nbooks() * m.npages() * m.nrows() *
+                        m.ncols()),
           Range(
               0, m.nshelves(), m.nbooks() * m.npages() * m.nrows() * m.ncols()),
           Range(0, m.nbooks(), m.npages() * m.nrows() * m.ncols()),
@@ -1656,8 +1692,8 @@ Tensor5::Tensor5(const ConstTensor5View& m)
     and copies the data. */
 Tensor5::Tensor5(const Tensor5& m)
     : Tensor5View(
-          new Numeric[m.nshelves() * m.nbooks() * m.npages() * m.nrows() *
-                      m.ncols()],
+          matpack_alloc(m.nshelves() * m.nbooks() * m.npages() * m.nrows() *
+                        m.ncols()),
           Range(
               0, m.nshelves(), m.nbooks() * m.npages() * m.nrows() * m.ncols()),
           Range(0, m.nbooks(), m.npages() * m.nrows() * m.ncols()),
@@ -1713,8 +1749,19 @@ Tensor5& Tensor5::operator=(const Tensor5& x) {
 //! Move assignment operator from another tensor.
 Tensor5& Tensor5::operator=(Tensor5&& x) noexcept {
   if (this != &x) {
-    delete[] mdata;
+    // External data of the same size is kept, see adopt_external
+    if (mexternal && msr.mextent == x.msr.mextent &&
+        mbr.mextent == x.mbr.mextent && mpr.mextent == x.mpr.mextent &&
+        mrr.mextent == x.mrr.mextent && mcr.mextent == x.mcr.mextent) {
+      std::memcpy(mdata,
+                  x.mdata,
+                  nshelves() * nbooks() * npages() * nrows() * ncols() *
+                      sizeof(Numeric));
+      return *this;
+    }
+    if (!mexternal) matpack_free(mdata);
     mdata = x.mdata;
+    mexternal = x.mexternal;
     msr = x.msr;
     mbr = x.mbr;
     mpr = x.mpr;
@@ -1726,6 +1773,7 @@ Tensor5& Tensor5::operator=(Tensor5&& x) noexcept {
     x.mrr = Range(0, 0);
     x.mcr = Range(0, 0);
     x.mdata = nullptr;
+    x.mexternal = false;
   }
   return *this;
 }
@@ -1749,8 +1797,9 @@ void Tensor5::resize(Index s, Index b, Index p, Index r, Index c) {
 
   if (msr.mextent != s || mbr.mextent != b || mpr.mextent != p ||
       mrr.mextent != r || mcr.mextent != c) {
-    delete[] mdata;
-    mdata = new Numeric[s * b * p * r * c];
+    if (!mexternal) matpack_free(mdata);
+    mdata = matpack_alloc(s * b * p * r * c);
+    mexternal = false;
 
     msr.mstart = 0;
     msr.mextent = s;
@@ -1774,6 +1823,38 @@ void Tensor5::resize(Index s, Index b, Index p, Index r, Index c) {
   }
 }
 
+void Tensor5::adopt_external(Numeric* data,
+                             Index s,
+                             Index b,
+                             Index p,
+                             Index r,
+                             Index c) {
+  assert(0 <= s);
+  assert(0 <= b);
+  assert(0 <= p);
+  assert(0 <= r);
+  assert(0 <= c);
+
+  if (!mexternal && mdata != data) matpack_free(mdata);
+  mdata = data;
+  mexternal = true;
+
+  msr = Range(0, s, b * p * r * c);
+  mbr = Range(0, b, p * r * c);
+  mpr = Range(0, p, r * c);
+  mrr = Range(0, r, c);
+  mcr = Range(0, c);
+}
+
+void Tensor5::detach_external(const Numeric* data) {
+  if (!mexternal || mdata != data) return;
+
+  const Index n = nshelves() * nbooks() * npages() * nrows() * ncols();
+  mdata = matpack_alloc(n);
+  std::memcpy(mdata, data, n * sizeof(Numeric));
+  mexternal = false;
+}
+
 /** Swaps two objects. */
 void swap(Tensor5& t1, Tensor5& t2) {
   std::swap(t1.msr, t2.msr);
@@ -1782,6 +1863,7 @@ void swap(Tensor5& t1, Tensor5& t2) {
   std::swap(t1.mrr, t2.mrr);
   std::swap(t1.mcr, t2.mcr);
   std::swap(t1.mdata, t2.mdata);
+  std::swap(t1.mexternal, t2.mexternal);
 }
 
 /** Destructor for Tensor5. This is important, since Tensor5 uses new to
@@ -1789,7 +1871,7 @@ void swap(Tensor5& t1, Tensor5& t2) {
 Tensor5::~Tensor5() {
   //   cout << "Destroying a Tensor5:\n"
   //        << *this << "\n........................................\n";
-  delete[] mdata;
+  if (!mexternal) matpack_free(mdata);
 }
 
 /** A generic transform function for tensors, which can be used to
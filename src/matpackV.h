@@ -149,6 +149,12 @@ class ConstTensor5View {
 
   // Member functions:
   bool empty() const;
+
+  /** The elements as one block of memory, see ContiguousBlock. */
+  ContiguousBlock contiguous() const {
+    return contiguous_block(mdata, {msr, mbr, mpr, mrr, mcr});
+  }
+
   Index nshelves() const;
   Index nbooks() const;
   Index npages() const;
@@ -511,8 +517,10 @@ class Tensor5 : public Tensor5View {
   Tensor5(Index s, Index b, Index p, Index r, Index c, Numeric fill);
   Tensor5(const ConstTensor5View& v);
   Tensor5(const Tensor5& v);
-  Tensor5(Tensor5&& v) noexcept : Tensor5View(std::forward<Tensor5View>(v)) {
+  Tensor5(Tensor5&& v) noexcept
+      : Tensor5View(std::forward<Tensor5View>(v)), mexternal(v.mexternal) {
     v.mdata = nullptr;
+    v.mexternal = false;
   }
 
   // Assignment operators:
@@ -523,11 +531,41 @@ class Tensor5 : public Tensor5View {
   // Resize function:
   void resize(Index s, Index b, Index p, Index r, Index c);
 
+  /** Lets the Tensor5 refer to external data, without copying.
+
+      The data is owned by the caller and must stay valid as long as it is
+      used. It is never released by matpack. The Tensor5 keeps referring to it
+      until it is resized to other dimensions, or detached by
+      detach_external. Assignments of the same size, also by move, copy
+      to the external data.
+
+      \param[in] data  Contiguous data in row-major order.
+  */
+  void adopt_external(Numeric* data,
+                      Index s,
+                      Index b,
+                      Index p,
+                      Index r,
+                      Index c);
+
+  /** Copies external data to storage of the Tensor5 itself.
+
+      Nothing is done if the Tensor5 does not refer to the given external
+      data, see adopt_external.
+
+      \param[in] data  External data, as passed to adopt_external.
+  */
+  void detach_external(const Numeric* data);
+
   // Swap function:
   friend void swap(Tensor5& t1, Tensor5& t2);
 
   // Destructor:
   virtual ~Tensor5();
+
+ private:
+  /** True if the data is external, see adopt_external. */
+  bool mexternal = false;
 };
 
 // Function declarations:
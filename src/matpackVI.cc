@@ -23,6 +23,7 @@
 */
 
 #include "matpackVI.h"
+#include "matpack_alloc.h"
 #include "exceptions.h"
 
 // Functions for ConstTensor6View:
@@ -1779,7 +1780,8 @@ Tensor6View& Tensor6View::operator=(const ConstTensor6View& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
@@ -1797,7 +1799,8 @@ Tensor6View& Tensor6View::operator=(const Tensor6View& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
@@ -1813,14 +1816,15 @@ Tensor6View& Tensor6View::operator=(const Tensor6& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
 /** Assigning a scalar to a Tensor6View will set all elements to this
     value. */
 Tensor6View& Tensor6View::operator=(Numeric x) {
-  copy(x, begin(), end());
+  if (!fill_contiguous(contiguous(), x)) copy(x, begin(), end());
   return *this;
 }
 
@@ -1829,6 +1833,9 @@ Tensor6View& Tensor6View::operator=(Numeric x) {
 
 /** Multiplication by scalar. */
 Tensor6View& Tensor6View::operator*=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a *= x; }))
+    return *this;
+
   const Iterator6D ep = end();
   for (Iterator6D p = begin(); p != ep; ++p) {
     *p *= x;
@@ -1838,6 +1845,9 @@ Tensor6View& Tensor6View::operator*=(Numeric x) {
 
 /** Division by scalar. */
 Tensor6View& Tensor6View::operator/=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a /= x; }))
+    return *this;
+
   const Iterator6D ep = end();
   for (Iterator6D p = begin(); p != ep; ++p) {
     *p /= x;
@@ -1847,6 +1857,9 @@ Tensor6View& Tensor6View::operator/=(Numeric x) {
 
 /** Addition of scalar. */
 Tensor6View& Tensor6View::operator+=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a += x; }))
+    return *this;
+
   const Iterator6D ep = end();
   for (Iterator6D p = begin(); p != ep; ++p) {
     *p += x;
@@ -1856,6 +1869,9 @@ Tensor6View& Tensor6View::operator+=(Numeric x) {
 
 /** Subtraction of scalar. */
 Tensor6View& Tensor6View::operator-=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a -= x; }))
+    return *this;
+
   const Iterator6D ep = end();
   for (Iterator6D p = begin(); p != ep; ++p) {
     *p -= x;
@@ -1871,6 +1887,11 @@ Tensor6View& Tensor6View::operator*=(const ConstTensor6View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a *= b; }))
+    return *this;
+
   ConstIterator6D xp = x.begin();
   Iterator6D p = begin();
   const Iterator6D ep = end();
@@ -1888,6 +1909,11 @@ Tensor6View& Tensor6View::operator/=(const ConstTensor6View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a /= b; }))
+    return *this;
+
   ConstIterator6D xp = x.begin();
   Iterator6D p = begin();
   const Iterator6D ep = end();
@@ -1905,6 +1931,11 @@ Tensor6View& Tensor6View::operator+=(const ConstTensor6View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a += b; }))
+    return *this;
+
   ConstIterator6D xp = x.begin();
   Iterator6D p = begin();
   const Iterator6D ep = end();
@@ -1922,6 +1953,11 @@ Tensor6View& Tensor6View::operator-=(const ConstTensor6View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a -= b; }))
+    return *this;
+
   ConstIterator6D xp = x.begin();
   Iterator6D p = begin();
   const Iterator6D ep = end();
@@ -2028,7 +2064,7 @@ void copy(Numeric x, Iterator6D target, const Iterator6D& end) {
 /** Constructor setting size. This constructor has to set the strides
     in the page and row ranges correctly! */
 Tensor6::Tensor6(Index v, Index s, Index b, Index p, Index r, Index c)
-    : Tensor6View(new Numeric[v * s * b * p * r * c],
+    : Tensor6View(matpack_alloc(v * s * b * p * r * c),
                   Range(0, v, s * b * p * r * c),
                   Range(0, s, b * p * r * c),
                   Range(0, b, p * r * c),
@@ -2041,7 +2077,7 @@ Tensor6::Tensor6(Index v, Index s, Index b, Index p, Index r, Index c)
 /** Constructor setting size and filling with constant value. */
 Tensor6::Tensor6(
     Index v, Index s, Index b, Index p, Index r, Index c, Numeric fill)
-    : Tensor6View(new Numeric[v * s * b * p * r * c],
+    : Tensor6View(matpack_alloc(v * s * b * p * r * c),
                   Range(0, v, s * b * p * r * c),
                   Range(0, s, b * p * r * c),
                   Range(0, b, p * r * c),
@@ -2057,8 +2093,8 @@ Tensor6::Tensor6(
     and copies the data. */
 Tensor6::Tensor6(const ConstTensor6View& m)
     : Tensor6View(
-          new Numeric[m.nvitrines() * m.nshelves() * m.nbooks() * m.npages() *
-                      m.nrows() * m.ncols()],
+          matpack_alloc(m.nvitrines() * m.nshelves() * m.nbooks() * m.npages() *
+                        m.nrows() * m.ncols()),
           Range(0,
                 m.nvitrines(),
                 m.nshelves() * m.nbooks() * m.npages() * m.nrows() * m.ncols()),
@@ -2075,8 +2111,8 @@ Tensor6::Tensor6(const ConstTensor6View& m)
     and copies the data. */
 Tensor6::Tensor6(const Tensor6& m)
     : Tensor6View(
-          new Numeric[m.nvitrines() * m.nshelves() * m.nbooks() * m.npages() *
-                      m.nrows() * m.ncols()],
+          matpack_alloc(m.nvitrines() * m.nshelves() * m.nbooks() * m.npages() *
+                        m.nrows() * m.ncols()),
           Range(0,
                 m.nvitrines(),
                 m.nshelves() * m.nbooks() * m.npages() * m.nrows() * m.ncols()),
@@ -2140,8 +2176,20 @@ Tensor6& Tensor6::operator=(const Tensor6& x) {
 //! Move assignment operator from another tensor.
 Tensor6& Tensor6::operator=(Tensor6&& x) noexcept {
   if (this != &x) {
-    delete[] mdata;
+    // External data of the same size is kept, see adopt_external
+    if (mexternal && mvr.mextent == x.mvr.mextent &&
+        msr.mextent == x.msr.mextent && mbr.mextent == x.mbr.mextent &&
+        mpr.mextent == x.mpr.mextent && mrr.mextent == x.mrr.mextent &&
+        mcr.mextent == x.mcr.mextent) {
+      std::memcpy(mdata,
+                  x.mdata,
+                  nvitrines() * nshelves() * nbooks() * npages() * nrows() *
+                      ncols() * sizeof(Numeric));
+      return *this;
+    }
+    if (!mexternal) matpack_free(mdata);
     mdata = x.mdata;
+    mexternal = x.mexternal;
     mvr = x.mvr;
     msr = x.msr;
     mbr = x.mbr;
@@ -2155,6 +2203,7 @@ Tensor6& Tensor6::operator=(Tensor6&& x) noexcept {
     x.mrr = Range(0, 0);
     x.mcr = Range(0, 0);
     x.mdata = nullptr;
+    x.mexternal = false;
   }
   return *this;
 }
@@ -2182,8 +2231,9 @@ void Tensor6::resize(Index v, Index s, Index b, Index p, Index r, Index c) {
 
   if (mvr.mextent != v || msr.mextent != s || mbr.mextent != b ||
       mpr.mextent != p || mrr.mextent != r || mcr.mextent != c) {
-    delete[] mdata;
-    mdata = new Numeric[v * s * b * p * r * c];
+    if (!mexternal) matpack_free(mdata);
+    mdata = matpack_alloc(v * s * b * p * r * c);
+    mexternal = false;
 
     mvr.mstart = 0;
     mvr.mextent = v;
@@ -2211,6 +2261,42 @@ void Tensor6::resize(Index v, Index s, Index b, Index p, Index r, Index c) {
   }
 }
 
+void Tensor6::adopt_external(Numeric* data,
+                             Index v,
+                             Index s,
+                             Index b,
+                             Index p,
+                             Index r,
+                             Index c) {
+  assert(0 <= v);
+  assert(0 <= s);
+  assert(0 <= b);
+  assert(0 <= p);
+  assert(0 <= r);
+  assert(0 <= c);
+
+  if (!mexternal && mdata != data) matpack_free(mdata);
+  mdata = data;
+  mexternal = true;
+
+  mvr = Range(0, v, s * b * p * r * c);
+  msr = Range(0, s, b * p * r * c);
+  mbr = Range(0, b, p * r * c);
+  mpr = Range(0, p, r * c);
+  mrr = Range(0, r, c);
+  mcr = Range(0, c);
+}
+
+void Tensor6::detach_external(const Numeric* data) {
+  if (!mexternal || mdata != data) return;
+
+  const Index n = nvitrines() * nshelves() * nbooks() * npages() * nrows() *
+                  ncols();
+  mdata = matpack_alloc(n);
+  std::memcpy(mdata, data, n * sizeof(Numeric));
+  mexternal = false;
+}
+
 /** Swaps two objects. */
 void swap(Tensor6& t1, Tensor6& t2) {
   std::swap(t1.mvr, t2.mvr);
@@ -2220,6 +2306,7 @@ void swap(Tensor6& t1, Tensor6& t2) {
   std::swap(t1.mrr, t2.mrr);
   std::swap(t1.mcr, t2.mcr);
   std::swap(t1.mdata, t2.mdata);
+  std::swap(t1.mexternal, t2.mexternal);
 }
 
 /** Destructor for Tensor6. This is important, since Tensor6 uses new to
@@ -2227,7 +2314,7 @@ void swap(Tensor6& t1, Tensor6& t2) {
 Tensor6::~Tensor6() {
   //   cout << "Destroying a Tensor6:\n"
   //        << *this << "\n........................................\n";
-  delete[] mdata;
+  if (!mexternal) matpack_free(mdata);
 }
 
 /** A generic transform function for tensors, which can be used to
@@ -155,6 +155,12 @@ class ConstTensor6View {
 
   // Member functions:
   bool empty() const;
+
+  /** The elements as one block of memory, see ContiguousBlock. */
+  ContiguousBlock contiguous() const {
+    return contiguous_block(mdata, {mvr, msr, mbr, mpr, mrr, mcr});
+  }
+
   Index nvitrines() const;
   Index nshelves() const;
   Index nbooks() const;
@@ -1093,8 +1099,10 @@ class Tensor6 : public Tensor6View {
   Tensor6(Index v, Index s, Index b, Index p, Index r, Index c, Numeric fill);
   Tensor6(const ConstTensor6View& v);
   Tensor6(const Tensor6& v);
-  Tensor6(Tensor6&& v) noexcept : Tensor6View(std::forward<Tensor6View>(v)) {
+  Tensor6(Tensor6&& v) noexcept
+      : Tensor6View(std::forward<Tensor6View>(v)), mexternal(v.mexternal) {
     v.mdata = nullptr;
+    v.mexternal = false;
   }
 
   // Assignment operators:
@@ -1105,11 +1113,42 @@ class Tensor6 : public Tensor6View {
   // Resize function:
   void resize(Index v, Index s, Index b, Index p, Index r, Index c);
 
+  /** Lets the Tensor6 refer to external data, without copying.
+
+      The data is owned by the caller and must stay valid as long as it is
+      used. It is never released by matpack. The Tensor6 keeps referring to it
+      until it is resized to other dimensions, or detached by
+      detach_external. Assignments of the same size, also by move, copy
+      to the external data.
+
+      \param[in] data  Contiguous data in row-major order.
+  */
+  void adopt_external(Numeric* data,
+                      Index v,
+                      Index s,
+                      Index b,
+                      Index p,
+                      Index r,
+                      Index c);
+
+  /** Copies external data to storage of the Tensor6 itself.
+
+      Nothing is done if the Tensor6 does not refer to the given external
+      data, see adopt_external.
+
+      \param[in] data  External data, as passed to adopt_external.
+  */
+  void detach_external(const Numeric* data);
+
   // Swap function:
   friend void swap(Tensor6& t1, Tensor6& t2);
 
   // Destructor:
   virtual ~Tensor6();
+
+ private:
+  /** True if the data is external, see adopt_external. */
+  bool mexternal = false;
 };
 
 // Function declarations:
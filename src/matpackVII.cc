@@ -23,6 +23,7 @@
 */
 
 #include "matpackVII.h"
+#include "matpack_alloc.h"
 #include "exceptions.h"
 
 // Functions for ConstTensor7View:
@@ -5063,7 +5064,8 @@ Tensor7View& Tensor7View::operator=(const ConstTensor7View& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
@@ -5082,7 +5084,8 @@ Tensor7View& Tensor7View::operator=(const Tensor7View& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
@@ -5099,14 +5102,15 @@ Tensor7View& Tensor7View::operator=(const Tensor7& m) {
   assert(mrr.mextent == m.mrr.mextent);
   assert(mcr.mextent == m.mcr.mextent);
 
-  copy(m.begin(), m.end(), begin());
+  if (!copy_contiguous(contiguous(), m.contiguous()))
+    copy(m.begin(), m.end(), begin());
   return *this;
 }
 
 /** Assigning a scalar to a Tensor7View will set all elements to this
     value. */
 Tensor7View& Tensor7View::operator=(Numeric x) {
-  copy(x, begin(), end());
+  if (!fill_contiguous(contiguous(), x)) copy(x, begin(), end());
   return *this;
 }
 
@@ -5115,6 +5119,9 @@ Tensor7View& Tensor7View::operator=(Numeric x) {
 
 /** Multiplication by scalar. */
 Tensor7View& Tensor7View::operator*=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a *= x; }))
+    return *this;
+
   const Iterator7D ep = end();
   for (Iterator7D p = begin(); p != ep; ++p) {
     *p *= x;
@@ -5124,6 +5131,9 @@ Tensor7View& Tensor7View::operator*=(Numeric x) {
 
 /** Division by scalar. */
 Tensor7View& Tensor7View::operator/=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a /= x; }))
+    return *this;
+
   const Iterator7D ep = end();
   for (Iterator7D p = begin(); p != ep; ++p) {
     *p /= x;
@@ -5133,6 +5143,9 @@ Tensor7View& Tensor7View::operator/=(Numeric x) {
 
 /** Addition of scalar. */
 Tensor7View& Tensor7View::operator+=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a += x; }))
+    return *this;
+
   const Iterator7D ep = end();
   for (Iterator7D p = begin(); p != ep; ++p) {
     *p += x;
@@ -5142,6 +5155,9 @@ Tensor7View& Tensor7View::operator+=(Numeric x) {
 
 /** Subtraction of scalar. */
 Tensor7View& Tensor7View::operator-=(Numeric x) {
+  if (apply_contiguous(contiguous(), [x](Numeric& a) { a -= x; }))
+    return *this;
+
   const Iterator7D ep = end();
   for (Iterator7D p = begin(); p != ep; ++p) {
     *p -= x;
@@ -5158,6 +5174,11 @@ Tensor7View& Tensor7View::operator*=(const ConstTensor7View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a *= b; }))
+    return *this;
+
   ConstIterator7D xp = x.begin();
   Iterator7D p = begin();
   const Iterator7D ep = end();
@@ -5176,6 +5197,11 @@ Tensor7View& Tensor7View::operator/=(const ConstTensor7View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a /= b; }))
+    return *this;
+
   ConstIterator7D xp = x.begin();
   Iterator7D p = begin();
   const Iterator7D ep = end();
@@ -5194,6 +5220,11 @@ Tensor7View& Tensor7View::operator+=(const ConstTensor7View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a += b; }))
+    return *this;
+
   ConstIterator7D xp = x.begin();
   Iterator7D p = begin();
   const Iterator7D ep = end();
@@ -5212,6 +5243,11 @@ Tensor7View& Tensor7View::operator-=(const ConstTensor7View& x) {
   assert(npages() == x.npages());
   assert(nrows() == x.nrows());
   assert(ncols() == x.ncols());
+  if (apply_contiguous(contiguous(),
+                       x.contiguous(),
+                       [](Numeric& a, Numeric b) { a -= b; }))
+    return *this;
+
   ConstIterator7D xp = x.begin();
   Iterator7D p = begin();
   const Iterator7D ep = end();
@@ -5324,7 +5360,7 @@ void copy(Numeric x, Iterator7D target, const Iterator7D& end) {
 /** Constructor setting size. This constructor has to set the strides
     in the page and row ranges correctly! */
 Tensor7::Tensor7(Index l, Index v, Index s, Index b, Index p, Index r, Index c)
-    : Tensor7View(new Numeric[l * v * s * b * p * r * c],
+    : Tensor7View(matpack_alloc(l * v * s * b * p * r * c),
                   Range(0, l, v * s * b * p * r * c),
                   Range(0, v, s * b * p * r * c),
                   Range(0, s, b * p * r * c),
@@ -5338,7 +5374,7 @@ Tensor7::Tensor7(Index l, Index v, Index s, Index b, Index p, Index r, Index c)
 /** Constructor setting size and filling with constant value. */
 Tensor7::Tensor7(
     Index l, Index v, Index s, Index b, Index p, Index r, Index c, Numeric fill)
-    : Tensor7View(new Numeric[l * v * s * b * p * r * c],
+    : Tensor7View(matpack_alloc(l * v * s * b * p * r * c),
                   Range(0, l, v * s * b * p * r * c),
                   Range(0, v, s * b * p * r * c),
                   Range(0, s, b * p * r * c),
@@ -5355,8 +5391,8 @@ Tensor7::Tensor7(
     and copies the data. */
 Tensor7::Tensor7(const ConstTensor7View& m)
     : Tensor7View(
-          new Numeric[m.nlibraries() * m.nvitrines() * m.nshelves() *
-                      m.nbooks() * m.npages() * m.nrows() * m.ncols()],
+          matpack_alloc(m.nlibraries() * m.nvitrines() * m.nshelves() *
+                        m.nbooks() * m.npages() * m.nrows() * m.ncols()),
           Range(0,
                 m.nlibraries(),
                 m.nvitrines() * m.nshelves() * m.nbooks() * m.npages() *
@@ -5377,8 +5413,8 @@ Tensor7::Tensor7(const ConstTensor7View& m)
     and copies the data. */
 Tensor7::Tensor7(const Tensor7& m)
     : Tensor7View(
-          new Numeric[m.nlibraries() * m.nvitrines() * m.nshelves() *
-                      m.nbooks() * m.npages() * m.nrows() * m.ncols()],
+          matpack_alloc(m.nlibraries() * m.nvitrines() * m.nshelves() *
+                        m.nbooks() * m.npages() * m.nrows() * m.ncols()),
           Range(0,
                 m.nlibraries(),
                 m.nvitrines() * m.nshelves() * m.nbooks() * m.npages() *
@@ -5447,8 +5483,20 @@ Tensor7& Tensor7::operator=(const Tensor7& x) {
 //! Copy assignment operator from another tensor.
 Tensor7& Tensor7::operator=(Tensor7&& x) noexcept {
   if (this != &x) {
-    delete[] mdata;
+    // External data of the same size is kept, see adopt_external
+    if (mexternal && mlr.mextent == x.mlr.mextent &&
+        mvr.mextent == x.mvr.mextent && msr.mextent == x.msr.mextent &&
+        mbr.mextent == x.mbr.mextent && mpr.mextent == x.mpr.mextent &&
+        mrr.mextent == x.mrr.mextent && mcr.mextent == x.mcr.mextent) {
+      std::memcpy(mdata,
+                  x.mdata,
+                  nlibraries() * nvitrines() * nshelves() * nbooks() *
+                      npages() * nrows() * ncols() * sizeof(Numeric));
+      return *this;
+    }
+    if (!mexternal) matpack_free(mdata);
     mdata = x.mdata;
+    mexternal = x.mexternal;
     mlr = x.mlr;
     mvr = x.mvr;
     msr = x.msr;
@@ -5464,6 +5512,7 @@ Tensor7& Tensor7::operator=(Tensor7&& x) noexcept {
     x.mrr = Range(0, 0);
     x.mcr = Range(0, 0);
     x.mdata = nullptr;
+    x.mexternal = false;
   }
   return *this;
 }
@@ -5494,8 +5543,9 @@ void Tensor7::resize(
   if (mlr.mextent != l || mvr.mextent != v || msr.mextent != s ||
       mbr.mextent != b || mpr.mextent != p || mrr.mextent != r ||
       mcr.mextent != c) {
-    delete[] mdata;
-    mdata = new Numeric[l * v * s * b * p * r * c];
+    if (!mexternal) matpack_free(mdata);
+    mdata = matpack_alloc(l * v * s * b * p * r * c);
+    mexternal = false;
 
     mlr.mstart = 0;
     mlr.mextent = l;
@@ -5527,6 +5577,45 @@ void Tensor7::resize(
   }
 }
 
+void Tensor7::adopt_external(Numeric* data,
+                             Index l,
+                             Index v,
+                             Index s,
+                             Index b,
+                             Index p,
+                             Index r,
+                             Index c) {
+  assert(0 <= l);
+  assert(0 <= v);
+  assert(0 <= s);
+  assert(0 <= b);
+  assert(0 <= p);
+  assert(0 <= r);
+  assert(0 <= c);
+
+  if (!mexternal && mdata != data) matpack_free(mdata);
+  mdata = data;
+  mexternal = true;
+
+  mlr = Range(0, l, v * s * b * p * r * c);
+  mvr = Range(0, v, s * b * p * r * c);
+  msr = Range(0, s, b * p * r * c);
+  mbr = Range(0, b, p * r * c);
+  mpr = Range(0, p, r * c);
+  mrr = Range(0, r, c);
+  mcr = Range(0, c);
+}
+
+void Tensor7::detach_external(const Numeric* data) {
+  if (!mexternal || mdata != data) return;
+
+  const Index n = nlibraries() * nvitrines() * nshelves() * nbooks() *
+                  npages() * nrows() * ncols();
+  mdata = matpack_alloc(n);
+  std::memcpy(mdata, data, n * sizeof(Numeric));
+  mexternal = false;
+}
+
 /** Swaps two objects. */
 void swap(Tensor7& t1, Tensor7& t2) {
   std::swap(t1.mlr, t2.mlr);
@@ -5537,6 +5626,7 @@ void swap(Tensor7& t1, Tensor7& t2) {
   std::swap(t1.mrr, t2.mrr);
   std::swap(t1.mcr, t2.mcr);
   std::swap(t1.mdata, t2.mdata);
+  std::swap(t1.mexternal, t2.mexternal);
 }
 
 /** Destructor for Tensor7. This is important, since Tensor7 uses new to
@@ -5544,7 +5634,7 @@ void swap(Tensor7& t1, Tensor7& t2) {
 Tensor7::~Tensor7() {
   //   cout << "Destroying a Tensor7:\n"
   //        << *this << "\n........................................\n";
-  delete[] mdata;
+  if (!mexternal) matpack_free(mdata);
 }
 
 /** A generic transform function for tensors, which can be used to
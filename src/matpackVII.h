@@ -153,6 +153,12 @@ class ConstTensor7View {
 
   // Member functions:
   bool empty() const;
+
+  /** The elements as one block of memory, see ContiguousBlock. */
+  ContiguousBlock contiguous() const {
+    return contiguous_block(mdata, {mlr, mvr, msr, mbr, mpr, mrr, mcr});
+  }
+
   Index nlibraries() const;
   Index nvitrines() const;
   Index nshelves() const;
@@ -2394,8 +2400,10 @@ class Tensor7 : public Tensor7View {
           Numeric fill);
   Tensor7(const ConstTensor7View& v);
   Tensor7(const Tensor7& v);
-  Tensor7(Tensor7&& v) noexcept : Tensor7View(std::forward<Tensor7View>(v)) {
+  Tensor7(Tensor7&& v) noexcept
+      : Tensor7View(std::forward<Tensor7View>(v)), mexternal(v.mexternal) {
     v.mdata = nullptr;
+    v.mexternal = false;
   }
 
   // Assignment operators:
@@ -2406,11 +2414,43 @@ class Tensor7 : public Tensor7View {
   // Resize function:
   void resize(Index l, Index v, Index s, Index b, Index p, Index r, Index c);
 
+  /** Lets the Tensor7 refer to external data, without copying.
+
+      The data is owned by the caller and must stay valid as long as it is
+      used. It is never released by matpack. The Tensor7 keeps referring to it
+      until it is resized to other dimensions, or detached by
+      detach_external. Assignments of the same size, also by move, copy
+      to the external data.
+
+      \param[in] data  Contiguous data in row-major order.
+  */
+  void adopt_external(Numeric* data,
+                      Index l,
+                      Index v,
+                      Index s,
+                      Index b,
+                      Index p,
+                      Index r,
+                      Index c);
+
+  /** Copies external data to storage of the Tensor7 itself.
+
+      Nothing is done if the Tensor7 does not refer to the given external
+      data, see adopt_external.
+
+      \param[in] data  External data, as passed to adopt_external.
+  */
+  void detach_external(const Numeric* data);
+
   // Swap function:
   friend void swap(Tensor7& t1, Tensor7& t2);
 
   // Destructor:
   virtual ~Tensor7();
+
+ private:
+  /** True if the data is external, see adopt_external. */
+  bool mexternal = false;
 };
 
 // Function declarations:
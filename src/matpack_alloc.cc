@@ -0,0 +1,267 @@
+/* Copyright (C) 2026 The ARTS developers
+
+   This program is free software; you can redistribute it and/or modify it
+   under the terms of the GNU General Public License as published by the
+   Free Software Foundation; either version 2, or (at your option) any
+   later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+   USA. */
+
+/*!
+  \file   matpack_alloc.cc
+  \brief  Implementation of matpack_alloc.h.
+
+  Each allocation is preceded by a header of 16 bytes. The header tells
+  matpack_free whether the data belongs to an arena block, and where in
+  the heap memory or in the block it is placed. Small data directly
+  follows the header, and data of at least MATPACK_ALIGNED_BYTES is moved
+  forward to the next multiple of MATPACK_ALIGNMENT.
+
+  An arena block is reference counted. The arena itself holds one
+  reference and each live allocation one more. The block is reused by the
+  owning thread when the arena ends with no live allocations, and deleted
+  by whoever releases the last reference otherwise.
+*/
+
+#include "matpack_alloc.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/** An arena block. Only the owning thread allocates from it. */
+struct MatpackArena::Block {
+  char* data;
+  std::size_t capacity;
+  std::size_t top;
+  std::atomic<Index> refs;
+};
+
+namespace {
+
+/** Placed directly before the data of each allocation. */
+struct AllocHeader {
+  //! The arena block of the data, or nullptr for data on the heap
+  MatpackArena::Block* block;
+  //! Heap data: offset of the data from the start of the memory. Arena
+  //! data: offset of the allocation in the block.
+  std::uint32_t start;
+  //! Arena data: offset of the end of the allocation in the block
+  std::uint32_t end;
+};
+
+constexpr std::size_t HEADER_BYTES = sizeof(AllocHeader);
+
+static_assert(HEADER_BYTES == 16, "The allocation header must be 16 bytes.");
+
+//! Allocation counters of a thread. Only the owning thread updates them,
+//! with plain loads and stores, while any thread may read them.
+struct ThreadStats {
+  std::atomic<Index> heap_allocs{0};
+  std::atomic<Index> heap_bytes{0};
+  std::atomic<Index> arena_allocs{0};
+  std::atomic<Index> arena_bytes{0};
+  ThreadStats();
+  ~ThreadStats();
+};
+
+//! Counters of all threads
+struct StatsRegistry {
+  std::mutex mutex;
+  //! Counters of the running threads
+  std::vector<const ThreadStats*> threads;
+  //! Sum of the counters of finished threads
+  MatpackAllocStats finished;
+};
+
+//! The registry is never deleted, threads may finish after static
+//! destruction has started
+StatsRegistry& stats_registry() {
+  static auto* registry = new StatsRegistry;
+  return *registry;
+}
+
+ThreadStats::ThreadStats() {
+  StatsRegistry& registry = stats_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.threads.push_back(this);
+}
+
+ThreadStats::~ThreadStats() {
+  StatsRegistry& registry = stats_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.finished.heap_allocs += heap_allocs;
+  registry.finished.heap_bytes += heap_bytes;
+  registry.finished.arena_allocs += arena_allocs;
+  registry.finished.arena_bytes += arena_bytes;
+  registry.threads.erase(
+      std::find(registry.threads.begin(), registry.threads.end(), this));
+}
+
+//! Adds to a counter of the calling thread
+void count(std::atomic<Index>& counter, Index n) {
+  counter.store(counter.load(std::memory_order_relaxed) + n,
+                std::memory_order_relaxed);
+}
+
+//! Allocation counters of the thread
+thread_local ThreadStats stats;
+
+//! Innermost active arena of the thread
+thread_local MatpackArena* active_arena = nullptr;
+
+//! Block left by the last arena of the thread, deleted at thread exit
+struct SpareBlock {
+  MatpackArena::Block* block = nullptr;
+  ~SpareBlock();
+};
+thread_local SpareBlock spare;
+
+std::size_t round_up(std::size_t bytes, std::size_t alignment) {
+  return (bytes + alignment - 1) / alignment * alignment;
+}
+
+//! Offset of the data from an allocation starting at a multiple of
+//! MATPACK_ALIGNMENT
+std::size_t data_offset(std::size_t bytes) {
+  return bytes < MATPACK_ALIGNED_BYTES ? HEADER_BYTES : MATPACK_ALIGNMENT;
+}
+
+MatpackArena::Block* new_block(std::size_t capacity) {
+  auto* block = new MatpackArena::Block;
+  void* data = nullptr;
+  if (posix_memalign(&data, MATPACK_ALIGNMENT, capacity))
+    throw std::bad_alloc();
+  block->data = static_cast<char*>(data);
+  block->capacity = capacity;
+  block->top = 0;
+  block->refs = 0;
+  return block;
+}
+
+void delete_block(MatpackArena::Block* block) {
+  std::free(block->data);
+  delete block;
+}
+
+SpareBlock::~SpareBlock() {
+  if (block) delete_block(block);
+}
+
+}  // namespace
+
+MatpackArena::MatpackArena(std::size_t capacity)
+    : mblock(nullptr), mprevious(active_arena) {
+  // Offsets in the block are stored as 32 bit numbers
+  capacity = std::min(round_up(capacity, MATPACK_ALIGNMENT),
+                      std::size_t(std::numeric_limits<std::uint32_t>::max()) /
+                          MATPACK_ALIGNMENT * MATPACK_ALIGNMENT);
+  if (spare.block && spare.block->capacity >= capacity) {
+    mblock = spare.block;
+    spare.block = nullptr;
+  } else {
+    mblock = new_block(capacity);
+  }
+  mblock->top = 0;
+  mblock->refs = 1;
+  active_arena = this;
+}
+
+MatpackArena::~MatpackArena() {
+  active_arena = mprevious;
+  if (mblock->refs.fetch_sub(1) == 1) {
+    // No live allocations, keep the block for the next arena
+    if (spare.block) delete_block(spare.block);
+    spare.block = mblock;
+  }
+}
+
+Numeric* matpack_alloc(Index n) {
+  const std::size_t bytes =
+      round_up(std::size_t(n) * sizeof(Numeric), HEADER_BYTES);
+  const std::size_t offset = data_offset(bytes);
+
+  if (active_arena) {
+    MatpackArena::Block* block = active_arena->mblock;
+    // Only the arena itself refers to the block, start from the beginning
+    if (block->refs == 1) block->top = 0;
+    // The block starts at a multiple of MATPACK_ALIGNMENT, and top is kept
+    // at a multiple of HEADER_BYTES
+    const std::size_t start = block->top;
+    const std::size_t data = round_up(start + HEADER_BYTES, offset);
+    if (data + bytes <= block->capacity) {
+      auto* header =
+          reinterpret_cast<AllocHeader*>(block->data + data - HEADER_BYTES);
+      header->block = block;
+      header->start = std::uint32_t(start);
+      header->end = std::uint32_t(data + bytes);
+      block->top = data + bytes;
+      block->refs++;
+      count(stats.arena_allocs, 1);
+      count(stats.arena_bytes, Index(bytes));
+      return reinterpret_cast<Numeric*>(block->data + data);
+    }
+  }
+
+  // malloc aligns to 16 bytes, enough for small data
+  void* memory = nullptr;
+  if (offset == HEADER_BYTES)
+    memory = std::malloc(offset + bytes);
+  else if (posix_memalign(&memory, MATPACK_ALIGNMENT, offset + bytes))
+    memory = nullptr;
+  if (!memory) throw std::bad_alloc();
+
+  char* data = static_cast<char*>(memory) + offset;
+  auto* header = reinterpret_cast<AllocHeader*>(data - HEADER_BYTES);
+  header->block = nullptr;
+  header->start = std::uint32_t(offset);
+  header->end = 0;
+  count(stats.heap_allocs, 1);
+  count(stats.heap_bytes, Index(bytes));
+  return reinterpret_cast<Numeric*>(data);
+}
+
+void matpack_free(Numeric* p) {
+  if (!p) return;
+
+  char* data = reinterpret_cast<char*>(p);
+  auto* header = reinterpret_cast<AllocHeader*>(data - HEADER_BYTES);
+  MatpackArena::Block* block = header->block;
+  if (!block) {
+    std::free(data - header->start);
+    return;
+  }
+
+  // Memory released last-in-first-out can be reused directly, but the top
+  // of the block may only be touched by the owning thread
+  if (active_arena && active_arena->mblock == block &&
+      header->end == block->top)
+    block->top = header->start;
+
+  if (block->refs.fetch_sub(1) == 1) delete_block(block);
+}
+
+MatpackAllocStats matpack_alloc_stats() {
+  StatsRegistry& registry = stats_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  MatpackAllocStats total = registry.finished;
+  for (const ThreadStats* thread : registry.threads) {
+    total.heap_allocs += thread->heap_allocs.load(std::memory_order_relaxed);
+    total.heap_bytes += thread->heap_bytes.load(std::memory_order_relaxed);
+    total.arena_allocs += thread->arena_allocs.load(std::memory_order_relaxed);
+    total.arena_bytes += thread->arena_bytes.load(std::memory_order_relaxed);
+  }
+  return total;
+}
@@ -0,0 +1,127 @@
+/* Copyright (C) 2026 The ARTS developers
+
+   This program is free software; you can redistribute it and/or modify it
+   under the terms of the GNU General Public License as published by the
+   Free Software Foundation; either version 2, or (at your option) any
+   later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+   USA. */
+
+/*!
+  \file   matpack_alloc.h
+  \brief  Memory allocation for the matpack containers.
+
+  All data of Vector, Matrix and Tensor3 to Tensor7 is allocated by
+  matpack_alloc and released by matpack_free. Data of at least
+  MATPACK_ALIGNED_BYTES bytes is aligned to MATPACK_ALIGNMENT bytes, enough
+  for the widest SIMD registers. Smaller data is aligned to 16 bytes, to
+  keep the overhead of small containers low.
+
+  A MatpackArena can be created at the start of a scope with many
+  short-lived temporaries. While it exists, matpack containers created by
+  the same thread take their data from a preallocated block instead of
+  the global heap. Memory released in last-in-first-out order is reused
+  directly, and the whole block is reused by the next arena of the
+  thread. Containers that outlive the arena remain valid; they just keep
+  the block alive until they are destructed.
+
+  The number of heap and arena allocations is counted for each thread and
+  summed over all threads by matpack_alloc_stats.
+
+  Containers can also refer to data owned by someone else, e.g. buffers
+  passed through the C API, see Vector::adopt_external. Such data is not
+  allocated by matpack_alloc and never passed to matpack_free.
+*/
+
+#ifndef matpack_alloc_h
+#define matpack_alloc_h
+
+#include <cstddef>
+#include "matpack.h"
+
+/** Alignment in bytes of large data allocated for matpack containers. */
+constexpr std::size_t MATPACK_ALIGNMENT = 64;
+
+/** Size in bytes from which data is aligned to MATPACK_ALIGNMENT. */
+constexpr std::size_t MATPACK_ALIGNED_BYTES = 16 * MATPACK_ALIGNMENT;
+
+/** Allocates data for n Numerics.
+
+    The data is taken from the active MatpackArena of the thread, if any
+    and if it has room left, and otherwise from the heap.
+
+    @param[in] n  Number of elements.
+    @return       Pointer to uninitialized data, aligned to
+                  MATPACK_ALIGNMENT if at least MATPACK_ALIGNED_BYTES
+                  bytes, and to 16 bytes otherwise.
+*/
+Numeric* matpack_alloc(Index n);
+
+/** Releases data allocated by matpack_alloc.
+
+    @param[in] p  Pointer returned by matpack_alloc, or nullptr.
+*/
+void matpack_free(Numeric* p);
+
+/** Counters of matpack allocations. */
+struct MatpackAllocStats {
+  /** Number of allocations from the heap. */
+  Index heap_allocs{0};
+  /** Bytes allocated from the heap. */
+  Index heap_bytes{0};
+  /** Number of allocations served by an arena. */
+  Index arena_allocs{0};
+  /** Bytes allocated from arenas. */
+  Index arena_bytes{0};
+};
+
+/** Returns the allocation counters summed over all threads.
+
+    The counters are accumulated since the start of the program, including
+    allocations by threads that have finished, e.g. OpenMP workers. Take
+    the difference of two calls to measure a piece of code. Counts of
+    threads running during the call may be slightly behind.
+*/
+MatpackAllocStats matpack_alloc_stats();
+
+/** Scoped scratch memory for matpack containers.
+
+    Create the arena as a local variable. Matpack containers allocated by
+    the same thread during its lifetime use the arena, nested arenas take
+    precedence over outer ones. Allocations that do not fit fall back to
+    the heap.
+*/
+class MatpackArena {
+ public:
+  /** Constructor.
+
+      @param[in] capacity  Size of the arena in bytes, at most 4 GiB. A
+                           block left by an earlier arena of the same
+                           thread is reused if large enough.
+  */
+  explicit MatpackArena(std::size_t capacity = 1 << 16);
+
+  MatpackArena(const MatpackArena&) = delete;
+  MatpackArena& operator=(const MatpackArena&) = delete;
+
+  ~MatpackArena();
+
+  struct Block;
+
+ private:
+  Block* mblock;
+  MatpackArena* mprevious;
+
+  friend Numeric* matpack_alloc(Index n);
+  friend void matpack_free(Numeric* p);
+};
+
+#endif  // matpack_alloc_h
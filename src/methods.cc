@@ -4783,7 +4783,11 @@ void define_md_data_raw() {
           "\n"
           "The main application of this method is to be part of the test\n"
           "control files, and then used to check that a calculated value\n"
-          "is consistent with an old, reference, value.\n"),
+          "is consistent with an old, reference, value.\n"
+          "\n"
+          "Propagation paths (*Ppath*) must have the same dimensionality,\n"
+          "number of points and radiative background, and their positions,\n"
+          "line-of-sights, step lengths and refractive indices are compared.\n"),
       AUTHORS("Oliver Lemke"),
       OUT(),
       GOUT(),
@@ -4794,11 +4798,11 @@ void define_md_data_raw() {
       GIN_TYPE(  // INPUT 1
           "Numeric, Vector, Matrix, Tensor3, Tensor4, Tensor5, Tensor7,"
           "ArrayOfVector, ArrayOfMatrix, ArrayOfTensor7, GriddedField3,"
-          "Sparse, SingleScatteringData",
+          "Sparse, SingleScatteringData, Ppath",
           // INPUT 2
           "Numeric, Vector, Matrix, Tensor3, Tensor4, Tensor5, Tensor7,"
           "ArrayOfVector, ArrayOfMatrix, ArrayOfTensor7, GriddedField3,"
-          "Sparse, SingleScatteringData",
+          "Sparse, SingleScatteringData, Ppath",
           // OTHER INPUT
           "Numeric",
           "String"),
@@ -5828,7 +5832,11 @@ void define_md_data_raw() {
           "BEFORE other WSMs that provide input to *DoitCalc*, e.g. before\n"
           "*DoitGetIncoming*.\n"),
       AUTHORS("Claudia Emde"),
-      OUT("doit_scat_field", "cloudbox_field", "doit_is_initialized"),
+      OUT("doit_scat_field",
+          "cloudbox_field",
+          "doit_is_initialized",
+          "doit_scat_operator",
+          "doit_scat_operator_info"),
       GOUT(),
       GOUT_TYPE(),
       GOUT_DESC(),
@@ -6066,7 +6074,12 @@ void define_md_data_raw() {
           "\n"
           "The scattering integral field is generated by integrating\n"
           "the product of phase matrix and Stokes vector over all incident\n"
-          "angles. For more information please refer to AUG.\n"),
+          "angles. For more information please refer to AUG.\n"
+          "\n"
+          "For 1D atmospheres, the integral is obtained from the precomputed\n"
+          "*doit_scat_operator* if not empty, see *doit_scat_operatorCalc*.\n"
+          "An error is issued if the operator was computed for another\n"
+          "frequency or other grids, as given by *doit_scat_operator_info*.\n"),
       AUTHORS("Sreerekha T.R.", "Claudia Emde"),
       OUT("doit_scat_field"),
       GOUT(),
@@ -6082,7 +6095,10 @@ void define_md_data_raw() {
          "za_grid",
          "aa_grid",
          "doit_za_grid_size",
-         "pha_mat_doit"),
+         "pha_mat_doit",
+         "doit_scat_operator",
+         "doit_scat_operator_info",
+         "f_index"),
       GIN(),
       GIN_TYPE(),
       GIN_DEFAULT(),
@@ -6129,6 +6145,42 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("doit_scat_operatorCalc"),
+      DESCRIPTION(
+          "Assembles the scattering operator of each cloudbox level (1D).\n"
+          "\n"
+          "The phase matrix *pha_mat_doit* does not change during the DOIT\n"
+          "iterations of one frequency. This method combines it with the\n"
+          "quadrature weights of the angular integration into one matrix per\n"
+          "level, *doit_scat_operator*. *doit_scat_fieldCalc* then obtains the\n"
+          "scattering integral with one matrix-vector product per level\n"
+          "instead of summing over incoming directions in each iteration.\n"
+          "\n"
+          "The operator takes (N_za * stokes_dim)^2 values per level, which\n"
+          "is less than *pha_mat_doit* if *aa_grid* had more than one element\n"
+          "before *DoitScatteringDataPrepare*. Skip this method, leaving\n"
+          "*doit_scat_operator* empty as set by *DoitInit*, to compute the\n"
+          "integral directly from *pha_mat_doit*.\n"
+          "\n"
+          "The method must be called after *DoitScatteringDataPrepare* in\n"
+          "*doit_mono_agenda*.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("doit_scat_operator", "doit_scat_operator_info"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("pha_mat_doit",
+         "f_index",
+         "atmosphere_dim",
+         "za_grid",
+         "aa_grid",
+         "doit_za_grid_size"),
+      GIN(),
+      GIN_TYPE(),
+      GIN_DEFAULT(),
+      GIN_DESC()));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("doit_za_grid_optCalc"),
       DESCRIPTION(
@@ -6266,7 +6318,7 @@ void define_md_data_raw() {
                 "GriddedField4, String,"
                 "SingleScatteringData, ArrayOfSingleScatteringData,"
                 "TelsemAtlas,"
-                "QuantumIdentifier"),
+                "QuantumIdentifier, Ppath"),
       GOUT_DESC("Extracted element."),
       IN(),
       GIN("haystack", "index"),
@@ -6278,7 +6330,7 @@ void define_md_data_raw() {
                "ArrayOfSingleScatteringData,"
                "ArrayOfArrayOfSingleScatteringData,"
                "ArrayOfTelsemAtlas,"
-               "ArrayOfQuantumIdentifier",
+               "ArrayOfQuantumIdentifier, ArrayOfPpath",
                "Index"),
       GIN_DEFAULT(NODEF, NODEF),
       GIN_DESC("Variable to extract from.",
@@ -6374,6 +6426,47 @@ void define_md_data_raw() {
                "path of the downwelling radiation. One value per frequency.",
                "The version of FASTEM to use.")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("FastemStandAloneBatch"),
+      DESCRIPTION(
+          "Stand-alone usage of FASTEM, for many surface points.\n"
+          "\n"
+          "As *FastemStandAlone*, but for all combinations of a set of\n"
+          "surface points and a set of zenith angles, e.g. the pixels and\n"
+          "viewing angles of a swath. A point is given by the i:th elements\n"
+          "of *surface_skin_t*, *salinity*, *wind_speed* and *rel_aa*. The\n"
+          "evaluations are done in parallel.\n"
+          "\n"
+          "The output has dimensions [point, zenith angle, frequency, 4].\n"
+          "The same checks and adjustments as in *FastemStandAlone* are\n"
+          "applied.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT("emissivity", "reflectivity"),
+      GOUT_TYPE("Tensor4", "Tensor4"),
+      GOUT_DESC("Emission values. See above.", "Reflectivity values. See above."),
+      IN("f_grid"),
+      GIN("surface_skin_t",
+          "za",
+          "salinity",
+          "wind_speed",
+          "rel_aa",
+          "transmittance",
+          "fastem_version"),
+      GIN_TYPE(
+          "Vector", "Vector", "Vector", "Vector", "Vector", "Tensor3", "Index"),
+      GIN_DEFAULT(NODEF, NODEF, NODEF, NODEF, NODEF, NODEF, "6"),
+      GIN_DESC("Surface skin temperature of each point.",
+               "Zenith angles of line-of-sight, 90 to 180 deg.",
+               "Salinity of each point, 0-1.",
+               "Wind speed of each point.",
+               "Azimuth angle between wind direction and line-of-sight, for "
+               "each point.",
+               "The transmission of the atmosphere, along the propagation "
+               "path of the downwelling radiation. Dimensions are [point, "
+               "zenith angle, frequency].",
+               "The version of FASTEM to use.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("FieldFromGriddedField"),
       DESCRIPTION("Extract the data from a GriddedField.\n"
@@ -9582,6 +9675,71 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("jacobianFromPerturbations"),
+      DESCRIPTION(
+          "Calculates a Jacobian for an atmospheric field by perturbations.\n"
+          "\n"
+          "The method replaces a *ybatchCalc* over *AtmFieldPerturb* or\n"
+          "*vmr_fieldPerturb*, followed by *jacobianFromYbatch*. One\n"
+          "perturbation is made for each point of the retrieval grids.\n"
+          "For each perturbation, *ybatch_calc_agenda* is executed with\n"
+          "*t_field* or *vmr_field* replaced by the perturbed version, and\n"
+          "*ybatch_index* set to the index of the perturbation. The agenda\n"
+          "shall accordingly just calculate the spectrum, typically by a\n"
+          "call of *yCalc*. The perturbations are treated in parallel.\n"
+          "\n"
+          "The mapping from the retrieval grids to the atmospheric grids is\n"
+          "only calculated once. *y* must be calculated for the unperturbed\n"
+          "atmosphere before calling the method.\n"
+          "\n"
+          "The perturbations leave the geometry unchanged, and the cache of\n"
+          "*ppathStepByStep* is activated during the calculations (also if\n"
+          "*cache_size* is 0 in *ppath_agenda*). Geometrical propagation\n"
+          "paths are then only calculated for the first perturbations and\n"
+          "are reused by the others. Absorption is not reused, it is\n"
+          "recalculated for all species for each perturbation.\n"
+          "\n"
+          "Column i of *jacobian* equals: (y_i-y)/pert_size, where y_i is\n"
+          "the spectrum for perturbation i. The order of the perturbations\n"
+          "follows the GIN pert_index of *AtmFieldPerturb*.\n"
+          "\n"
+          "Set *quantity* to \"Temperature\" to perturb *t_field*. Otherwise\n"
+          "*quantity* is taken as a species name, and the matching part of\n"
+          "*vmr_field* is perturbed.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("jacobian"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("y",
+         "atmosphere_dim",
+         "p_grid",
+         "lat_grid",
+         "lon_grid",
+         "t_field",
+         "vmr_field",
+         "abs_species",
+         "ybatch_calc_agenda"),
+      GIN("quantity",
+          "p_ret_grid",
+          "lat_ret_grid",
+          "lon_ret_grid",
+          "pert_size",
+          "pert_mode"),
+      GIN_TYPE("String", "Vector", "Vector", "Vector", "Numeric", "String"),
+      GIN_DEFAULT(NODEF, NODEF, NODEF, NODEF, NODEF, "absolute"),
+      GIN_DESC("\"Temperature\" or name of species to perturb.",
+               "Pressure retrieval grid.",
+               "Latitude retrieval grid.",
+               "Longitude retrieval grid.",
+               "Size of perturbation.",
+               "Type of perturbation, "
+               "absolute"
+               " or "
+               "relative"
+               ".")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("jacobianFromTwoY"),
       DESCRIPTION(
@@ -11163,6 +11321,9 @@ void define_md_data_raw() {
           "  \"gn_cg\": Non-linear, with Gauss-Newton and conjugate gradient solver.\n"
           "  \"lm\": Non-linear, with Levenberg-Marquardt (LM) iteration scheme.\n"
           "  \"lm_cg\": Non-linear, with Levenberg-Marquardt (LM) iteration scheme and conjugate gradient solver.\n"
+          "  \"gn_broyden\": As \"gn\", but the Jacobian is mostly obtained by\n"
+          "     Broyden (rank-one secant) updates, see *broyden_settings*.\n"
+          "  \"lm_broyden\": As \"lm\", but with Broyden updates of the Jacobian.\n"
           "*max_start_cost*\n"
           "  No inversion is done if the cost matching the a priori state is above\n"
           "  this value. If set to a negative value, all values are accepted.\n"
@@ -11201,7 +11362,20 @@ void define_md_data_raw() {
           "   matrices.\n"
           "*display_progress*\n"
           "   Controls if there is any screen output. The overall report level\n"
-          "   is ignored by this WSM.\n"),
+          "   is ignored by this WSM.\n"
+          "*broyden_settings*\n"
+          "  Settings of the Broyden updates of \"gn_broyden\" and \"lm_broyden\".\n"
+          "  Instead of calculating the Jacobian by *inversion_iterate_agenda*\n"
+          "  at each new state, the previous Jacobian is corrected by the change\n"
+          "  of *yf* along the last step. This is a vector of length 2:\n"
+          "    0: Maximum number of consecutive updates. A full Jacobian is\n"
+          "       calculated when the number is reached.\n"
+          "    1: Minimum relative reduction of the cost by the last step. A\n"
+          "       full Jacobian is calculated if the reduction is smaller.\n"
+          "  The number of full Jacobians and of updates is reported together\n"
+          "  with the timing information when *display_progress* is set.\n"
+          "  If the last Jacobian is an updated one, a full Jacobian is\n"
+          "  calculated at the final state, for *jacobian* and *dxdy*.\n"),
       AUTHORS("Patrick Eriksson"),
       OUT("x",
           "yf",
@@ -11229,7 +11403,8 @@ void define_md_data_raw() {
           "stop_dx",
           "lm_ga_settings",
           "clear_matrices",
-          "display_progress"),
+          "display_progress",
+          "broyden_settings"),
       GIN_TYPE("String",
                "Numeric",
                "Vector",
@@ -11237,8 +11412,9 @@ void define_md_data_raw() {
                "Numeric",
                "Vector",
                "Index",
-               "Index"),
-      GIN_DEFAULT(NODEF, "Inf", "[]", "10", "0.01", "[]", "0", "0"),
+               "Index",
+               "Vector"),
+      GIN_DEFAULT(NODEF, "Inf", "[]", "10", "0.01", "[]", "0", "0", "[5, 0.1]"),
       GIN_DESC("Iteration method. For this and all options below, see "
                "further above.",
                "Maximum allowed value of cost function at start.",
@@ -11248,7 +11424,89 @@ void define_md_data_raw() {
                "Settings associated with the ga factor of the LM method.",
                "An option to save memory.",
                "Flag to control if inversion diagnostics shall be printed "
-               "on the screen.")));
+               "on the screen.",
+               "Settings of the Broyden updates of the Jacobian.")));
+
+  md_data_raw.push_back(create_mdrecord(
+      NAME("OEMBatch"),
+      DESCRIPTION(
+          "Runs *OEM* for a batch of independent profiles.\n"
+          "\n"
+          "Each row of *y_batch* is a measurement vector, inverted with the\n"
+          "a priori state of the same row of *xa_batch*. All profiles share\n"
+          "*covmat_sx*, *covmat_se* and *inversion_iterate_agenda*. The\n"
+          "input is checked, and the inverses of the covariance matrices are\n"
+          "computed, once before the profiles are inverted in parallel, each\n"
+          "thread with its own copy of the workspace. The remaining arguments\n"
+          "are as for *OEM*, except that the progress of the iterations is\n"
+          "never displayed.\n"
+          "\n"
+          "The results are stacked, with the profile as first dimension:\n"
+          "*x_batch* and *yf_batch* hold the retrieved state and the fitted\n"
+          "spectrum, *jacobian_batch* and *dxdy_batch* the Jacobian and gain\n"
+          "matrix (empty if *clear_matrices* is set), and each row of\n"
+          "*oem_diagnostics_batch* the *oem_diagnostics* of the profile.\n"
+          "\n"
+          "A failing profile does not stop the batch. Its rows are left as NaN,\n"
+          "apart from the diagnostics, and the error messages are returned in\n"
+          "*oem_errors*, prefixed by the profile index.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("oem_errors"),
+      GOUT("x_batch",
+           "yf_batch",
+           "jacobian_batch",
+           "dxdy_batch",
+           "oem_diagnostics_batch"),
+      GOUT_TYPE("Matrix", "Matrix", "Tensor3", "Tensor3", "Matrix"),
+      GOUT_DESC("Retrieved states, one row per profile.",
+                "Fitted measurement vectors, one row per profile.",
+                "Jacobians, one page per profile.",
+                "Gain matrices, one page per profile.",
+                "OEM diagnostics, one row per profile."),
+      IN("covmat_sx",
+         "covmat_se",
+         "jacobian_quantities",
+         "inversion_iterate_agenda"),
+      GIN("y_batch",
+          "xa_batch",
+          "method",
+          "max_start_cost",
+          "x_norm",
+          "max_iter",
+          "stop_dx",
+          "lm_ga_settings",
+          "clear_matrices",
+          "broyden_settings"),
+      GIN_TYPE("Matrix",
+               "Matrix",
+               "String",
+               "Numeric",
+               "Vector",
+               "Index",
+               "Numeric",
+               "Vector",
+               "Index",
+               "Vector"),
+      GIN_DEFAULT(NODEF,
+                  NODEF,
+                  NODEF,
+                  "Inf",
+                  "[]",
+                  "10",
+                  "0.01",
+                  "[]",
+                  "0",
+                  "[5, 0.1]"),
+      GIN_DESC("Measurement vectors, one row per profile.",
+               "A priori states, one row per profile.",
+               "Iteration method, see *OEM*.",
+               "Maximum allowed value of cost function at start.",
+               "Normalisation of Sx.",
+               "Maximum number of iterations.",
+               "Stop criterion for iterative inversions.",
+               "Settings associated with the ga factor of the LM method.",
+               "Flag to not return Jacobians and gain matrices.",
+               "Settings of the Broyden updates of the Jacobian.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("avkCalc"),
@@ -12083,6 +12341,24 @@ void define_md_data_raw() {
       GIN_DEFAULT("3"),
       GIN_DESC("Number of zenith angles per position")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ppathCacheClear"),
+      DESCRIPTION(
+          "Empties the cache of *ppathStepByStep*.\n"
+          "\n"
+          "The number of cached paths and the number of cache hits and misses\n"
+          "since the last clearing are reported at verbosity level 2.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN(),
+      GIN(),
+      GIN_TYPE(),
+      GIN_DEFAULT(),
+      GIN_DESC()));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("ppathCalc"),
       DESCRIPTION(
@@ -12144,6 +12420,49 @@ void define_md_data_raw() {
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ppathCalcBatch"),
+      DESCRIPTION(
+          "Propagation paths for many rays through the same atmosphere.\n"
+          "\n"
+          "Calculates one propagation path for each row of *sensor_pos* and\n"
+          "*sensor_los*, in the same way as *ppathStepByStep*. The rays are\n"
+          "handled in parallel. If *ppath_step_agenda* contains\n"
+          "*ppath_stepGeometric*, and not *ppath_stepRefractionBasic*, the\n"
+          "path steps are taken without executing the agenda, which removes\n"
+          "most of the overhead for large sets of directions (e.g. antenna\n"
+          "patterns and limb scans).\n"
+          "\n"
+          "The paths do not account for *mblock_dlos_grid*. Expand the\n"
+          "sensor line-of-sights before calling the method if that is wanted.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT("ppaths"),
+      GOUT_TYPE("ArrayOfPpath"),
+      GOUT_DESC("Propagation paths, one for each row of *sensor_pos*."),
+      IN("ppath_step_agenda",
+         "ppath_inside_cloudbox_do",
+         "atmosphere_dim",
+         "p_grid",
+         "lat_grid",
+         "lon_grid",
+         "z_field",
+         "f_grid",
+         "refellipsoid",
+         "z_surface",
+         "atmgeom_checked",
+         "cloudbox_on",
+         "cloudbox_limits",
+         "cloudbox_checked",
+         "sensor_pos",
+         "sensor_los",
+         "ppath_lmax",
+         "ppath_lraytrace"),
+      GIN(),
+      GIN_TYPE(),
+      GIN_DEFAULT(),
+      GIN_DESC()));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("ppathCalcFromAltitude"),
       DESCRIPTION(
@@ -12281,7 +12600,22 @@ void define_md_data_raw() {
           "ARTS user guide.\n"
           "\n"
           "This method should never be called directly. Use *ppathCalc* instead\n"
-          "if you want to extract propagation paths.\n"),
+          "if you want to extract propagation paths.\n"
+          "\n"
+          "Geometrical paths can be cached by setting *cache_size* to a\n"
+          "positive value. The cache is keyed on all geometry-relevant input\n"
+          "(the atmospheric grids, *z_field*, *refellipsoid*, *z_surface*,\n"
+          "the cloud box settings, *rte_pos*, *rte_los*, *ppath_lmax* and\n"
+          "*ppath_lraytrace*), compared exactly. Inside *yCalc* the\n"
+          "atmospheric part of the key is matched once per call, and not\n"
+          "for each pencil beam. A path is then reused for repeated\n"
+          "calculations with the same geometry, e.g. between frequency\n"
+          "batches, iterations of a retrieval and batch cases. A change of\n"
+          "any of these variables gives a new key, and old paths are simply\n"
+          "not used. Paths involving refraction are never cached, as they\n"
+          "depend also on the atmospheric state and the frequencies.\n"
+          "The cache is emptied when *cache_size* paths are stored, and can\n"
+          "be emptied explicitly by *ppathCacheClear*.\n"),
       AUTHORS("Patrick Eriksson"),
       OUT("ppath"),
       GOUT(),
@@ -12303,10 +12637,10 @@ void define_md_data_raw() {
          "rte_los",
          "ppath_lmax",
          "ppath_lraytrace"),
-      GIN(),
-      GIN_TYPE(),
-      GIN_DEFAULT(),
-      GIN_DESC()));
+      GIN("cache_size"),
+      GIN_TYPE("Index"),
+      GIN_DEFAULT("0"),
+      GIN_DESC("Maximum number of cached paths. 0 deactivates the cache.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("ppathWriteXMLPartial"),
@@ -15609,7 +15943,8 @@ void define_md_data_raw() {
           "robust",
           "za_interp_order",
           "cos_za_interp",
-          "max_delta_tau"),
+          "max_delta_tau",
+          "nprocesses"),
       GIN_TYPE("Index",
                "String",
                "String",
@@ -15619,8 +15954,10 @@ void define_md_data_raw() {
                "Index",
                "Index",
                "Index",
-               "Numeric"),
-      GIN_DEFAULT("16", "median", "D", "1", "19", "0", "0", "1", "0", "1e-6"),
+               "Numeric",
+               "Index"),
+      GIN_DEFAULT(
+          "16", "median", "D", "1", "19", "0", "0", "1", "0", "1e-6", "1"),
       GIN_DESC("Number of polar angle directions (streams) in RT4"
                " solution (must be an even number).",
                "Flag which method to apply to derive phase function (for"
@@ -15650,7 +15987,12 @@ void define_md_data_raw() {
                "For *auto_inc_nstreams*>0, flag whether to do polar angle"
                " interpolation in cosine (='mu') space.",
                "Maximum optical depth of infinitesimal layer (where single"
-               " scattering approximation is assumed to apply).")));
+               " scattering approximation is assumed to apply).",
+               "Number of worker processes running RT4. With 1, RT4 is run"
+               " within the ARTS process, one frequency at a time. With a"
+               " larger value, frequencies are solved in parallel by forked"
+               " worker processes (where supported by the system, and if"
+               " not called inside a parallel region).")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("RT4CalcWithRT4Surface"),
@@ -15703,7 +16045,8 @@ void define_md_data_raw() {
           "robust",
           "za_interp_order",
           "cos_za_interp",
-          "max_delta_tau"),
+          "max_delta_tau",
+          "nprocesses"),
       GIN_TYPE("Index",
                "String",
                "String",
@@ -15714,9 +16057,20 @@ void define_md_data_raw() {
                "Index",
                "Index",
                "Index",
-               "Numeric"),
-      GIN_DEFAULT(
-          "16", "median", "A", "D", "1", "19", "0", "0", "1", "0", "1e-6"),
+               "Numeric",
+               "Index"),
+      GIN_DEFAULT("16",
+                  "median",
+                  "A",
+                  "D",
+                  "1",
+                  "19",
+                  "0",
+                  "0",
+                  "1",
+                  "0",
+                  "1e-6",
+                  "1"),
       GIN_DESC("Number of polar angle directions (streams) in RT4"
                " solution (must be an even number).",
                "Flag which method to apply to derive phase function (for"
@@ -15745,7 +16099,12 @@ void define_md_data_raw() {
                "For *auto_inc_nstreams*>0, flag whether to do polar angle"
                " interpolation in cosine (='mu') space.",
                "Maximum optical depth of infinitesimal layer (where single"
-               " scattering approximation is assumed to apply).")));
+               " scattering approximation is assumed to apply).",
+               "Number of worker processes running RT4. With 1, RT4 is run"
+               " within the ARTS process, one frequency at a time. With a"
+               " larger value, frequencies are solved in parallel by forked"
+               " worker processes (where supported by the system, and if"
+               " not called inside a parallel region).")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("RT4Test"),
@@ -15866,6 +16225,35 @@ void define_md_data_raw() {
       GIN_DEFAULT(NODEF),
       GIN_DESC("Vibrational data [nlevels]")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ScatElementsDatabaseWrite"),
+      DESCRIPTION(
+          "Converts single scattering data files to scattering database files.\n"
+          "\n"
+          "Each scattering element, i.e. the single scattering data and the\n"
+          "scattering meta data, is written to one database file. The location\n"
+          "of the meta data is derived from *scat_data_files* following the\n"
+          "naming conventions of *ScatSpeciesScatAndMetaRead*.\n"
+          "\n"
+          "The database files store the optical properties as one record per\n"
+          "frequency and temperature, so that *ScatSpeciesScatAndMetaReadDatabase*\n"
+          "can read only the part of the data needed for a calculation. The\n"
+          "files are binary, in the byte order of the machine writing them.\n"
+          "\n"
+          "The elements are converted one at a time, so the memory needed is\n"
+          "that of the largest element.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN(),
+      GIN("scat_data_files", "database_files"),
+      GIN_TYPE("ArrayOfString", "ArrayOfString"),
+      GIN_DEFAULT(NODEF, NODEF),
+      GIN_DESC("Array of single scattering data file names.",
+               "Array of database file names, one per scattering data file.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("ScatElementsPndAndScatAdd"),
       DESCRIPTION(
@@ -16156,6 +16544,41 @@ void define_md_data_raw() {
       GIN_DEFAULT(NODEF),
       GIN_DESC("Array of single scattering data file names.")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ScatSpeciesScatAndMetaReadDatabase"),
+      DESCRIPTION(
+          "As *ScatSpeciesScatAndMetaRead*, but reads scattering database files\n"
+          "and only the frequencies and temperatures needed.\n"
+          "\n"
+          "The database files are created by *ScatElementsDatabaseWrite*. Only\n"
+          "the frequencies of the data covering the range of *f_grid* are read,\n"
+          "and the temperatures covering the range of *t_field*. On each side of\n"
+          "the ranges, *interp_order* extra grid points are included, so that\n"
+          "the later interpolation of the data, e.g. by *scat_dataCalc*, gives\n"
+          "the same result as with the complete data. *f_grid* and *t_field*\n"
+          "must hence be set before calling this method.\n"
+          "\n"
+          "With *cache_size* above 0, the data read are kept in a cache in\n"
+          "memory, shared by all calls of the method. Repeated calls, e.g. in the\n"
+          "cases of a batch calculation, read data from file only when not found\n"
+          "in the cache. The least recently used data are dropped to keep the\n"
+          "cache within *cache_size* of the call. A file changed on disk is\n"
+          "read again. With the default of 0 the data are always read from file,\n"
+          "unless cached by an earlier call.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("scat_data_raw", "scat_meta"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("scat_data_raw", "scat_meta", "f_grid", "t_field"),
+      GIN("database_files", "interp_order", "cache_size"),
+      GIN_TYPE("ArrayOfString", "Index", "Numeric"),
+      GIN_DEFAULT(NODEF, "1", "0"),
+      GIN_DESC("Array of scattering database file names.",
+               "Interpolation order the data will be used with.",
+               "Maximum size of the cache of scattering data after the call, "
+               "in bytes.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("scat_data_singleTmatrix"),
       DESCRIPTION(
@@ -18640,6 +19063,39 @@ void define_md_data_raw() {
                "The maximum allowed distance for nearest neighbor"
                " interpolation in meters.")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("telsemStandaloneBatch"),
+      DESCRIPTION(
+          "Stand-alone evaluation of the Telsem model for many locations.\n"
+          "\n"
+          "As *telsemStandalone*, but for a set of locations, e.g. the\n"
+          "pixels of a satellite swath. The i:th location is given by the\n"
+          "i:th elements of *lat*, *lon* and *theta*. The emissivities are\n"
+          "returned as a tensor with dimensions [location, frequency, 2],\n"
+          "where the last dimension holds the v and h emissivities.\n"
+          "\n"
+          "Locations not contained in the atlas are taken from the nearest\n"
+          "cell of the atlas, if that cell is within *d_max*. Otherwise,\n"
+          "the emissivities of the location are set to NaN. The nearest\n"
+          "cells are found once per atlas and reused by later calls.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT("emissivities"),
+      GOUT_TYPE("Tensor3"),
+      GOUT_DESC("The computed v and h emissivites"),
+      IN(),
+      GIN("lat", "lon", "theta", "f", "ta", "d_max"),
+      GIN_TYPE(
+          "Vector", "Vector", "Vector", "Vector", "TelsemAtlas", "Numeric"),
+      GIN_DEFAULT(NODEF, NODEF, NODEF, NODEF, NODEF, "-1"),
+      GIN_DESC("The latitudes for which to compute the emissivities.",
+               "The longitudes for which to compute the emissivities.",
+               "The incidence angles.",
+               "The frequencies for which to compute the emissivities.",
+               "The Telsem atlas to use.",
+               "The maximum allowed distance for nearest neighbor"
+               " interpolation in meters.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("telsemAtlasLookup"),
       DESCRIPTION(
@@ -19041,15 +19497,19 @@ void define_md_data_raw() {
           "   - Windspeed (0-25) at 10m (m/s)\n"
           "     Higher wind speed can be used, but without garantee.\n"
           "   - Surface skin temperature (270-310) in K.\n"
-          "   - Salinity (0-0.04) in kg/kg\n"),
+          "   - Salinity (0-0.04) in kg/kg\n"
+          "\n"
+          "With a Matrix, each row holds one input Vector, and the row of\n"
+          "the output is the output of that input. All rows are evaluated\n"
+          "together, as done by *surfaceTessem* for the frequencies.\n"),
       AUTHORS("Oliver Lemke"),
       OUT(),
       GOUT("outvalues"),
-      GOUT_TYPE("Vector"),
+      GOUT_TYPE("Vector, Matrix"),
       GOUT_DESC("Tessem output emissivity."),
       IN(),
       GIN("net", "invalues"),
-      GIN_TYPE("TessemNN", "Vector"),
+      GIN_TYPE("TessemNN", "Vector, Matrix"),
       GIN_DEFAULT(NODEF, NODEF),
       GIN_DESC("Tessem NeuralNet parameters.", "Input data.")));
 
@@ -19139,6 +19599,116 @@ void define_md_data_raw() {
       GIN_DEFAULT(NODEF),
       GIN_DESC("Array to sort of same size as *time_stamps*")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("TMatrixDatabaseCalc"),
+      DESCRIPTION(
+          "Creates a single scattering database with the T-matrix code.\n"
+          "\n"
+          "The method performs *scat_data_singleTmatrix* for a set of\n"
+          "particles, defined by the elements of *diameter_volume_equ* and\n"
+          "*aspect_ratio*. The other settings are common for all particles,\n"
+          "see *scat_data_singleTmatrix* for their meaning. *aspect_ratio* can\n"
+          "have length 1, then all particles have the same aspect ratio.\n"
+          "*mass* is either empty (giving NaN in the meta data) or has the same\n"
+          "length as *diameter_volume_equ*.\n"
+          "\n"
+          "The calculation is split into work units, where each unit is one\n"
+          "particle at one frequency. If *nprocesses* is larger than 1, the\n"
+          "units are distributed to a pool of forked worker processes (as the\n"
+          "T-matrix code has global state, it can not run in several threads).\n"
+          "\n"
+          "If *checkpoint_dir* is set, the result of each unit is stored in\n"
+          "this directory. Units found there, matching the present settings,\n"
+          "are not calculated again. An interrupted or failed run can thus be\n"
+          "resumed by calling the method again with the same settings.\n"
+          "\n"
+          "The result is written to *filename_scat_data*, as an\n"
+          "ArrayOfSingleScatteringData, and *filename_scat_meta*, as an\n"
+          "ArrayOfScatteringMetaData. The scattering data file is written one\n"
+          "particle at a time, and the complete database is never kept in\n"
+          "memory.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("complex_refr_index"),
+      GIN("shape",
+          "diameter_volume_equ",
+          "aspect_ratio",
+          "mass",
+          "ptype",
+          "data_f_grid",
+          "data_t_grid",
+          "data_za_grid",
+          "data_aa_grid",
+          "precision",
+          "cri_source",
+          "ndgs",
+          "robust",
+          "quiet",
+          "filename_scat_data",
+          "filename_scat_meta",
+          "checkpoint_dir",
+          "nprocesses"),
+      GIN_TYPE("String",
+               "Vector",
+               "Vector",
+               "Vector",
+               "String",
+               "Vector",
+               "Vector",
+               "Vector",
+               "Vector",
+               "Numeric",
+               "String",
+               "Index",
+               "Index",
+               "Index",
+               "String",
+               "String",
+               "String",
+               "Index"),
+      GIN_DEFAULT(NODEF,
+                  NODEF,
+                  NODEF,
+                  "[]",
+                  NODEF,
+                  NODEF,
+                  NODEF,
+                  NODEF,
+                  "[]",
+                  "0.001",
+                  "Set by user, unknown source.",
+                  "2",
+                  "0",
+                  "1",
+                  NODEF,
+                  NODEF,
+                  "",
+                  "1"),
+      GIN_DESC("Particle shape. See *scat_data_singleTmatrix*.",
+               "Particle volume equivalent diameters [m].",
+               "Particle aspect ratios.",
+               "Particle masses. Only included in the meta data.",
+               "Particle type/orientation. See *scat_data_singleTmatrix*.",
+               "Frequency grid of the scattering data to be calculated.",
+               "Temperature grid of the scattering data to be calculated.",
+               "Zenith angle grid of the scattering data to be calculated.",
+               "Azimuth angle grid of the scattering data to be calculated.",
+               "Accuracy of the computations.",
+               "String describing the source of *complex_refr_index*, for"
+               " inclusion in meta data.",
+               "See *scat_data_singleTmatrix*.",
+               "Continue even if individual T-matrix calculations fail. "
+               "Respective scattering element data will be NAN.",
+               "Suppress print output from tmatrix fortran code.",
+               "Name of output file for the scattering data.",
+               "Name of output file for the meta data.",
+               "Directory for storing completed work units. If empty, no"
+               " checkpointing is done.",
+               "Number of worker processes.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("TMatrixTest"),
       DESCRIPTION(
@@ -12,6 +12,7 @@
 #ifndef _ARTS_OEM_H_
 #define _ARTS_OEM_H_
 
+#include <functional>
 #include <type_traits>
 
 #include "invlib/algebra.h"
@@ -233,6 +234,21 @@ struct OptimizerLog<invlib::GaussNewton<RealType, Solver>> {
   }
 };
 
+class AgendaWrapper;
+
+/** Counters of the Jacobian calculations of an OEM run.
+ *
+ * Filled by AgendaWrapper and reported by ArtsLog, so that the savings
+ * of Broyden updates can be compared to a full Gauss-Newton or
+ * Levenberg-Marquardt iteration.
+ */
+struct JacobianStatistics {
+  /** Number of Jacobians calculated by inversion_iterate_agenda. */
+  Index full = 0;
+  /** Number of Jacobians obtained by a Broyden update. */
+  Index updates = 0;
+};
+
 /** OEM log output
  *
  * This class takes care of formatting the OEM iteration information
@@ -249,9 +265,19 @@ class ArtsLog {
    * @param gamma_history Reference to vector in which to store gamma
    * values of LM iteration
    * @param linear Flag indicating whether forward model is linear.
+   * @param broyden_model Forward model using Broyden updates, if any. Its
+   * Jacobian is recalculated at the final state when the iteration is
+   * finalized, and its Jacobian counters are reported.
    */
-  ArtsLog(unsigned int v, ::Vector &g, bool l = false)
-      : verbosity_(v), gamma_history_(g), linear_(l), finalized_(false) {}
+  ArtsLog(unsigned int v,
+          ::Vector &g,
+          bool l = false,
+          AgendaWrapper *broyden_model = nullptr)
+      : verbosity_(v),
+        gamma_history_(g),
+        linear_(l),
+        finalized_(false),
+        broyden_model_(broyden_model) {}
 
   /** Finalizes log output if necessary.*/
   ~ArtsLog() {
@@ -349,6 +375,8 @@ class ArtsLog {
    */
   template <typename... Params>
   void finalize(const Params &... params) {
+    if (broyden_model_) final_jacobian();
+
     if (verbosity_ >= 1) {
       std::cout << invlib::separator() << std::endl;
 
@@ -385,6 +413,13 @@ class ArtsLog {
       std::cout << std::get<1>(tuple) << std::endl;
       std::cout << "Time in inversion_iterate Agenda (With Jacobian): ";
       std::cout << std::get<2>(tuple) << std::endl;
+      if (broyden_model_) {
+        const JacobianStatistics &s = jacobian_statistics();
+        std::cout << "Full Jacobian calculations:                       ";
+        std::cout << s.full << std::endl;
+        std::cout << "Broyden Jacobian updates:                         ";
+        std::cout << s.updates << std::endl;
+      }
 
       std::cout << std::endl;
       std::cout << invlib::center("----") << std::endl;
@@ -393,6 +428,11 @@ class ArtsLog {
   }
 
  private:
+  /** Recalculate the Jacobian of the Broyden forward model. */
+  void final_jacobian();
+  /** Jacobian counters of the Broyden forward model. */
+  const JacobianStatistics &jacobian_statistics() const;
+
   /** Verbosity level of logger */
   int verbosity_;
   /** Reference to ARTS vector holding the LM gamma history*/
@@ -405,6 +445,8 @@ class ArtsLog {
   bool linear_ = false;
   /** Flag indicating whether output has been finalized.*/
   bool finalized_ = false;
+  /** Forward model using Broyden updates, or nullptr.*/
+  AgendaWrapper *broyden_model_ = nullptr;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -491,11 +533,60 @@ class AgendaWrapper {
         inversion_iterate_agenda_(inversion_iterate_agenda),
         iteration_counter_(0),
         jacobian_(arts_jacobian),
+        arts_jacobian_(arts_jacobian),
         reuse_jacobian_((arts_jacobian.nrows() != 0) &&
                         (arts_jacobian.ncols() != 0) && (arts_y.nelem() != 0)),
         ws_(ws),
         yi_(arts_y) {}
 
+  /** Enable Broyden updates of the Jacobian.
+   *
+   * Instead of calculating the Jacobian with the agenda at each new
+   * state, the previous Jacobian K is corrected by the rank-one (secant)
+   * update
+   *
+   *   K += (dy - K dx) dx^T / (dx^T dx),
+   *
+   * where dx and dy are the changes of the state and the simulated
+   * measurement since the previous Jacobian. A full Jacobian is calculated
+   * again after max_updates consecutive updates, or as soon as the last
+   * step reduced the cost by less than the fraction min_reduction.
+   *
+   * @param[in] max_updates Maximum number of consecutive updates. Updates
+   *   are disabled if <= 0.
+   * @param[in] min_reduction Minimum relative cost reduction of a step
+   *   for the Jacobian to be updated.
+   * @param[in] cost Cost function of state and simulated measurement.
+   */
+  void set_broyden_updates(
+      Index max_updates,
+      Numeric min_reduction,
+      std::function<Numeric(ConstVectorView, ConstVectorView)> cost) {
+    broyden_max_updates_ = max_updates;
+    broyden_min_reduction_ = min_reduction;
+    cost_ = cost;
+  }
+
+  /** Counters of the Jacobian calculations done so far. */
+  const JacobianStatistics &statistics() const { return statistics_; }
+
+  /** Recalculate the Jacobian at the final state.
+   *
+   * If the current Jacobian was obtained by Broyden updates, it is
+   * replaced by a full Jacobian at the last evaluated state, which is
+   * the final state of the iteration. The jacobian WSV, and the dxdy
+   * derived from it, are then the same as without updates.
+   */
+  void final_jacobian() {
+    if (n_updates_ == 0 || x_evaluated_.nelem() == 0) return;
+    Vector xi(x_evaluated_);
+    inversion_iterate_agendaExecute(
+        *ws_, yi_, jacobian_, xi, 1, 0, *inversion_iterate_agenda_);
+    iteration_counter_ += 1;
+    statistics_.full += 1;
+    n_updates_ = 0;
+  }
+
   /** Return most recently simulated measurement vector.
    *
    * @return The simulated observation vector.
@@ -519,6 +610,18 @@ class AgendaWrapper {
    * \param[in] x The current state vector x.
    */
   MatrixReference Jacobian(const Vector &xi, Vector &yi) {
+    if (broyden_max_updates_ > 0 && x_previous_.nelem() == xi.nelem() &&
+        n_updates_ < broyden_max_updates_) {
+      if (!is_evaluated(xi)) evaluate(xi);
+      const Numeric cost = cost_(xi, yi_);
+      if (cost_previous_ - cost >= broyden_min_reduction_ * cost_previous_) {
+        broyden_update(xi);
+        cost_previous_ = cost;
+        yi = yi_;
+        return jacobian_;
+      }
+    }
+
     if (!reuse_jacobian_) {
       inversion_iterate_agendaExecute(
           *ws_, yi_, jacobian_, xi, 1, 0, *inversion_iterate_agenda_);
@@ -528,6 +631,14 @@ class AgendaWrapper {
       reuse_jacobian_ = false;
       yi = yi_;
     }
+    statistics_.full += 1;
+
+    if (broyden_max_updates_ > 0) {
+      x_previous_ = xi;
+      y_previous_ = yi_;
+      cost_previous_ = cost_(xi, yi_);
+      n_updates_ = 0;
+    }
     return jacobian_;
   }
 
@@ -553,22 +664,86 @@ class AgendaWrapper {
     } else {
       reuse_jacobian_ = false;
     }
+    if (broyden_max_updates_ > 0) x_evaluated_ = xi;
     return yi_;
   }
 
  private:
+  /** Whether yi_ was simulated for state xi. */
+  bool is_evaluated(ConstVectorView xi) const {
+    if (x_evaluated_.nelem() != xi.nelem()) return false;
+    for (Index i = 0; i < xi.nelem(); i++) {
+      if (x_evaluated_[i] != xi[i]) return false;
+    }
+    return true;
+  }
+
+  /** Broyden update of the Jacobian for the step to xi. */
+  void broyden_update(ConstVectorView xi) {
+    ::Vector dx(xi);
+    dx -= x_previous_;
+    const Numeric dx2 = dx * dx;
+
+    if (dx2 > 0) {
+      ::Vector r(yi_);
+      r -= y_previous_;
+      ::Vector kdx(r.nelem());
+      mult(kdx, arts_jacobian_, dx);
+      r -= kdx;
+      for (Index i = 0; i < arts_jacobian_.nrows(); i++) {
+        const Numeric ri = r[i] / dx2;
+        for (Index j = 0; j < arts_jacobian_.ncols(); j++) {
+          arts_jacobian_(i, j) += ri * dx[j];
+        }
+      }
+    }
+
+    x_previous_ = xi;
+    y_previous_ = yi_;
+    n_updates_ += 1;
+    statistics_.updates += 1;
+  }
+
   /** Pointer to the inversion_iterate_agenda of the workspace. */
   const Agenda *inversion_iterate_agenda_;
   unsigned int iteration_counter_;
   /** Reference to the jacobian WSV.*/
   MatrixReference jacobian_;
+  /** Reference to the jacobian WSV, for Broyden updates.*/
+  ::Matrix &arts_jacobian_;
   /** Flag whether to reuse Jacobian from previous calculation. */
   bool reuse_jacobian_;
   /** Pointer to current ARTS workspace */
   Workspace *ws_;
   /** Cached simulation result. */
   Vector yi_;
+
+  /** Maximum number of consecutive Broyden updates, 0 if disabled. */
+  Index broyden_max_updates_ = 0;
+  /** Minimum relative cost reduction for a Broyden update. */
+  Numeric broyden_min_reduction_ = 0.0;
+  /** Cost function used to decide on Broyden updates. */
+  std::function<Numeric(ConstVectorView, ConstVectorView)> cost_;
+  /** State, simulation and cost of the last Jacobian. */
+  ::Vector x_previous_;
+  ::Vector y_previous_;
+  Numeric cost_previous_ = 0.0;
+  /** State at which yi_ was simulated. */
+  ::Vector x_evaluated_;
+  /** Number of Broyden updates since the last full Jacobian. */
+  Index n_updates_ = 0;
+  JacobianStatistics statistics_;
 };
+
+template <invlib::LogType type>
+void ArtsLog<type>::final_jacobian() {
+  broyden_model_->final_jacobian();
+}
+
+template <invlib::LogType type>
+const JacobianStatistics &ArtsLog<type>::jacobian_statistics() const {
+  return broyden_model_->statistics();
+}
 }  // namespace oem
 
 
@@ -633,14 +808,10 @@ void Tensor4Clip(Tensor4& x,
 
 /** Error checking for OEM method.
  *
- * @param[in, out] x Checked to have size consistent with xa or zero.
- * Set to xa if empty.
- * @param[in, out] yf Checked to have size consistent with y or zero.
- * Computed by execution inversion_iterate_agenda if necessary.
- * @param[in, out] jacobian Checked to be consistent with xa and covmat_se
- * or empty. Computed by executin inversion_iterate_agenda if necessary.
- * @param[in] inversion_iterate_agenda The inversion_iterate_agenda to execute
- * to compute yf.
+ * @param[in] x Checked to have size consistent with xa or zero.
+ * @param[in] yf Checked to have size consistent with y or zero.
+ * @param[in] jacobian Checked to be consistent with xa and covmat_se
+ * or empty.
  * @param[in] xa The a priori vector
  * @param[in] covmat_sx The state-space covariance matrix. Checked to be 
  * square and consistent with xa.
@@ -662,12 +833,12 @@ void Tensor4Clip(Tensor4& x,
  * Checked to be 1 or 0.
  * @param display_progress Whether or not to display iteration progress. Checked
  * to be 1 or 0.
+ * @param broyden_settings Settings of the Broyden updates. Checked to contain
+ * 2 valid elements, if Broyden updates are used.
  */
-void OEM_checks(Workspace& ws,
-                Vector& x,
-                Vector& yf,
-                Matrix& jacobian,
-                const Agenda& inversion_iterate_agenda,
+void OEM_checks(const Vector& x,
+                const Vector& yf,
+                const Matrix& jacobian,
                 const Vector& xa,
                 const CovarianceMatrix& covmat_sx,
                 const Vector& y,
@@ -679,7 +850,8 @@ void OEM_checks(Workspace& ws,
                 const Numeric& stop_dx,
                 const Vector& lm_ga_settings,
                 const Index& clear_matrices,
-                const Index& display_progress) {
+                const Index& display_progress,
+                const Vector& broyden_settings) {
   const Index nq = jacobian_quantities.nelem();
   const Index n = xa.nelem();
   const Index m = y.nelem();
@@ -721,10 +893,12 @@ void OEM_checks(Workspace& ws,
   if (!(method == "li" || method == "gn" || method == "li_m" ||
         method == "gn_m" || method == "ml" || method == "lm" ||
         method == "li_cg" || method == "gn_cg" || method == "li_cg_m" ||
-        method == "gn_cg_m" || method == "lm_cg" || method == "ml_cg")) {
+        method == "gn_cg_m" || method == "lm_cg" || method == "ml_cg" ||
+        method == "gn_broyden" || method == "lm_broyden")) {
     throw runtime_error(
         "Valid options for *method* are \"nl\", \"gn\" and "
-        "\"ml\" or \"lm\".");
+        "\"ml\" or \"lm\", see the documentation of *OEM* for "
+        "all variants.");
   }
 
   if (!(x_norm.nelem() == 0 || x_norm.nelem() == n)) {
@@ -746,7 +920,7 @@ void OEM_checks(Workspace& ws,
   }
 
   if ((method == "ml") || (method == "lm") || (method == "lm_cg") ||
-      (method == "ml_cg")) {
+      (method == "ml_cg") || (method == "lm_broyden")) {
     if (lm_ga_settings.nelem() != 6) {
       throw runtime_error(
           "When using \"ml\", *lm_ga_setings* must be a "
@@ -764,15 +938,17 @@ void OEM_checks(Workspace& ws,
   if (display_progress < 0 || display_progress > 1)
     throw runtime_error("Valid options for *display_progress* are 0 and 1.");
 
-  // If necessary compute yf and jacobian.
-  if (x.nelem() == 0) {
-    x = xa;
-    inversion_iterate_agendaExecute(
-        ws, yf, jacobian, xa, 1, 0, inversion_iterate_agenda);
-  }
-  if ((yf.nelem() == 0) || (jacobian.empty())) {
-    inversion_iterate_agendaExecute(
-        ws, yf, jacobian, x, 1, 0, inversion_iterate_agenda);
+  if ((method == "gn_broyden") || (method == "lm_broyden")) {
+    if (broyden_settings.nelem() != 2) {
+      throw runtime_error(
+          "When using \"gn_broyden\" or \"lm_broyden\", "
+          "*broyden_settings* must be a vector of length 2.");
+    }
+    if (broyden_settings[0] < 1 || broyden_settings[1] < 0) {
+      throw runtime_error(
+          "The maximum number of Broyden updates must be >= 1, and "
+          "the minimum cost reduction >= 0.");
+    }
   }
 }
 
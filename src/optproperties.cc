@@ -37,6 +37,7 @@
 #include "optproperties.h"
 #include <cfloat>
 #include <cmath>
+#include <cstring>
 #include <stdexcept>
 #include "array.h"
 #include "arts.h"
@@ -119,6 +120,62 @@ void opt_prop_Bulk(    //Output
   ptype = max(ptypes_ss);
 }
 
+//! Weighted sum over scattering elements for one temperature.
+/*!
+  The data of each scattering element is a contiguous tensor with frequency
+  as first and temperature as second dimension, i.e. for each frequency and
+  temperature a contiguous block of the remaining dimensions.
+
+  The blocks of all frequencies at temperature Tind are gathered into one
+  row of a matrix per scattering element. The bulk data for all frequencies
+  is then obtained by a single matrix-vector product with the pnd values,
+  done by BLAS, and scattered into the bulk tensor of the same layout.
+
+  \param[in,out] bulk     Start of the bulk data (nf, nT, block_size).
+  \param[in,out] buffer   Work matrix, resized as needed.
+  \param[in,out] result   Work vector, resized as needed.
+  \param[in]     se_data  Start of the data of each scattering element.
+  \param[in]     pnds     pnd of each scattering element.
+  \param[in]     nf       Number of frequencies.
+  \param[in]     nT       Number of temperatures.
+  \param[in]     Tind     Temperature index.
+  \param[in]     block_size  Number of elements per frequency and temperature.
+*/
+static void sum_scat_elems(Numeric* bulk,
+                           Matrix& buffer,
+                           Vector& result,
+                           const Array<const Numeric*>& se_data,
+                           ConstVectorView pnds,
+                           const Index nf,
+                           const Index nT,
+                           const Index Tind,
+                           const Index block_size) {
+  const Index nse = se_data.nelem();
+  const Index ncols = nf * block_size;
+  if (nse == 0 || ncols == 0) return;
+
+  if (buffer.nrows() < nse || buffer.ncols() != ncols)
+    buffer.resize(nse, ncols);
+  if (result.nelem() != ncols) result.resize(ncols);
+
+  for (Index i_se = 0; i_se < nse; i_se++) {
+    Numeric* row = &buffer(i_se, 0);
+    for (Index f = 0; f < nf; f++) {
+      std::memcpy(row + f * block_size,
+                  se_data[i_se] + (f * nT + Tind) * block_size,
+                  block_size * sizeof(Numeric));
+    }
+  }
+
+  mult(result, transpose(buffer(Range(0, nse), joker)), pnds);
+
+  for (Index f = 0; f < nf; f++) {
+    std::memcpy(bulk + (f * nT + Tind) * block_size,
+                &result[f * block_size],
+                block_size * sizeof(Numeric));
+  }
+}
+
 //! Scattering species bulk extinction and absorption.
 /*! 
   Derives bulk properties separately per scattering species from (input)
@@ -170,13 +227,17 @@ void opt_prop_ScatSpecBulk(   //Output
   ext_mat.resize(nss);
   abs_vec.resize(nss);
   ptype.resize(nss);
-  Tensor4 ext_tmp;
-  Tensor3 abs_tmp;
+
+  // Work space for the weighted sums, see sum_scat_elems
+  Matrix ext_buffer, abs_buffer;
+  Vector ext_result, abs_result, pnd_active;
+  Array<const Numeric*> ext_active, abs_active;
 
   Index i_se_flat = 0;
 
   for (Index i_ss = 0; i_ss < nss; i_ss++) {
-    assert(ext_mat_se[i_ss].nelem() == abs_vec_se[i_ss].nelem());
+    const Index nse = ext_mat_se[i_ss].nelem();
+    assert(abs_vec_se[i_ss].nelem() == nse);
     assert(nT == ext_mat_se[i_ss][0].nbooks());
     assert(nT == abs_vec_se[i_ss][0].npages());
 
@@ -185,31 +246,54 @@ void opt_prop_ScatSpecBulk(   //Output
     abs_vec[i_ss].resize(nf, nT, nDir, stokes_dim);
     abs_vec[i_ss] = 0.;
 
-    for (Index i_se = 0; i_se < ext_mat_se[i_ss].nelem(); i_se++) {
-      assert(nT == ext_mat_se[i_ss][i_se].nbooks());
-      assert(nT == abs_vec_se[i_ss][i_se].npages());
-
-      for (Index Tind = 0; Tind < nT; Tind++) {
-        if (pnds(i_se_flat, Tind) != 0.) {
-          if (t_ok(i_se_flat, Tind) > 0.) {
-            ext_tmp = ext_mat_se[i_ss][i_se](joker, Tind, joker, joker, joker);
-            ext_tmp *= pnds(i_se_flat, Tind);
-            ext_mat[i_ss](joker, Tind, joker, joker, joker) += ext_tmp;
-
-            abs_tmp = abs_vec_se[i_ss][i_se](joker, Tind, joker, joker);
-            abs_tmp *= pnds(i_se_flat, Tind);
-            abs_vec[i_ss](joker, Tind, joker, joker) += abs_tmp;
+    for (Index Tind = 0; Tind < nT; Tind++) {
+      // Collect the scattering elements present at this temperature
+      ext_active.resize(0);
+      abs_active.resize(0);
+      pnd_active.resize(nse);
+      for (Index i_se = 0; i_se < nse; i_se++) {
+        assert(nT == ext_mat_se[i_ss][i_se].nbooks());
+        assert(nT == abs_vec_se[i_ss][i_se].npages());
+
+        const Index i_flat = i_se_flat + i_se;
+        if (pnds(i_flat, Tind) != 0.) {
+          if (t_ok(i_flat, Tind) > 0.) {
+            pnd_active[ext_active.nelem()] = pnds(i_flat, Tind);
+            ext_active.push_back(ext_mat_se[i_ss][i_se].get_c_array());
+            abs_active.push_back(abs_vec_se[i_ss][i_se].get_c_array());
           } else {
             ostringstream os;
             os << "Interpolation error for (flat-array) scattering element #"
-               << i_se_flat << "\n"
+               << i_flat << "\n"
                << "at location/temperature point #" << Tind << "\n";
             throw runtime_error(os.str());
           }
         }
       }
-      i_se_flat++;
+
+      if (ext_active.nelem() == 0) continue;
+
+      const Range active(0, ext_active.nelem());
+      sum_scat_elems(ext_mat[i_ss].get_c_array(),
+                     ext_buffer,
+                     ext_result,
+                     ext_active,
+                     pnd_active[active],
+                     nf,
+                     nT,
+                     Tind,
+                     nDir * stokes_dim * stokes_dim);
+      sum_scat_elems(abs_vec[i_ss].get_c_array(),
+                     abs_buffer,
+                     abs_result,
+                     abs_active,
+                     pnd_active[active],
+                     nf,
+                     nT,
+                     Tind,
+                     nDir * stokes_dim);
     }
+    i_se_flat += nse;
     ptype[i_ss] = max(ptypes_se[i_ss]);
   }
 }
@@ -727,37 +811,56 @@ void pha_mat_ScatSpecBulk(    //Output
   const Index nss = pha_mat_se.nelem();
   pha_mat.resize(nss);
   ptype.resize(nss);
-  Tensor5 pha_tmp;
+
+  // Work space for the weighted sums, see sum_scat_elems
+  Matrix buffer;
+  Vector result, pnd_active;
+  Array<const Numeric*> pha_active;
 
   Index i_se_flat = 0;
 
   for (Index i_ss = 0; i_ss < nss; i_ss++) {
+    const Index nse = pha_mat_se[i_ss].nelem();
     assert(nT == pha_mat_se[i_ss][0].nshelves());
 
     pha_mat[i_ss].resize(nf, nT, npDir, niDir, stokes_dim, stokes_dim);
     pha_mat[i_ss] = 0.;
 
-    for (Index i_se = 0; i_se < pha_mat_se[i_ss].nelem(); i_se++) {
-      assert(nT == pha_mat_se[i_ss][i_se].nshelves());
-
-      for (Index Tind = 0; Tind < nT; Tind++) {
-        if (pnds(i_se_flat, Tind) != 0.) {
-          if (t_ok(i_se_flat, Tind) > 0.) {
-            pha_tmp =
-                pha_mat_se[i_ss][i_se](joker, Tind, joker, joker, joker, joker);
-            pha_tmp *= pnds(i_se_flat, Tind);
-            pha_mat[i_ss](joker, Tind, joker, joker, joker, joker) += pha_tmp;
+    for (Index Tind = 0; Tind < nT; Tind++) {
+      // Collect the scattering elements present at this temperature
+      pha_active.resize(0);
+      pnd_active.resize(nse);
+      for (Index i_se = 0; i_se < nse; i_se++) {
+        assert(nT == pha_mat_se[i_ss][i_se].nshelves());
+
+        const Index i_flat = i_se_flat + i_se;
+        if (pnds(i_flat, Tind) != 0.) {
+          if (t_ok(i_flat, Tind) > 0.) {
+            pnd_active[pha_active.nelem()] = pnds(i_flat, Tind);
+            pha_active.push_back(pha_mat_se[i_ss][i_se].get_c_array());
           } else {
             ostringstream os;
             os << "Interpolation error for (flat-array) scattering element #"
-               << i_se_flat << "\n"
+               << i_flat << "\n"
                << "at location/temperature point #" << Tind << "\n";
             throw runtime_error(os.str());
           }
         }
       }
-      i_se_flat++;
+
+      if (pha_active.nelem() == 0) continue;
+
+      sum_scat_elems(pha_mat[i_ss].get_c_array(),
+                     buffer,
+                     result,
+                     pha_active,
+                     pnd_active[Range(0, pha_active.nelem())],
+                     nf,
+                     nT,
+                     Tind,
+                     npDir * niDir * stokes_dim * stokes_dim);
     }
+    i_se_flat += nse;
     ptype[i_ss] = max(ptypes_se[i_ss]);
   }
 }
@@ -1661,6 +1764,195 @@ void ext_matTransform(  //Output and Input
   }
 }
 
+//! Phase matrix of azimuthally randomly oriented particles.
+/*!
+  Interpolates the phase matrix data of a PTYPE_AZIMUTH_RND scattering
+  element to one pair of scattered and incident directions, as done by
+  pha_matTransform.
+
+  \param[out] pha_mat_lab   Phase matrix in laboratory frame.
+  \param[in]  pha_mat_data  Phase matrix in database.
+  \param[in]  itw           Interpolation weights.
+  \param[in]  za_sca_gp     Position of the scattered zenith angle in the
+                              zenith angle grid of the database.
+  \param[in]  delta_aa_gp   Position of the absolute azimuth difference in
+                              the azimuth angle grid of the database.
+  \param[in]  za_inc_gp     Position of the incident zenith angle in the
+                              zenith angle grid of the database.
+  \param[in]  delta_aa      Azimuth difference between the directions.
+*/
+static void pha_mat_labAzimuthRnd(  //Output
+    MatrixView pha_mat_lab,
+    //Input
+    ConstTensor5View pha_mat_data,
+    ConstVectorView itw,
+    const GridPos& za_sca_gp,
+    const GridPos& delta_aa_gp,
+    const GridPos& za_inc_gp,
+    const Numeric& delta_aa) {
+  const Index stokes_dim = pha_mat_lab.ncols();
+
+  pha_mat_lab(0, 0) =
+      interp(itw,
+             pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 0),
+             za_sca_gp,
+             delta_aa_gp,
+             za_inc_gp);
+  if (stokes_dim == 1) {
+    return;
+  }
+  pha_mat_lab(0, 1) =
+      interp(itw,
+             pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 1),
+             za_sca_gp,
+             delta_aa_gp,
+             za_inc_gp);
+  pha_mat_lab(1, 0) =
+      interp(itw,
+             pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 4),
+             za_sca_gp,
+             delta_aa_gp,
+             za_inc_gp);
+  pha_mat_lab(1, 1) =
+      interp(itw,
+             pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 5),
+             za_sca_gp,
+             delta_aa_gp,
+             za_inc_gp);
+  if (stokes_dim == 2) {
+    return;
+  }
+  if (delta_aa >= 0) {
+    pha_mat_lab(0, 2) = interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 2),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+    pha_mat_lab(1, 2) = interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 6),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+    pha_mat_lab(2, 0) = interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 8),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+    pha_mat_lab(2, 1) = interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 9),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+  } else {
+    pha_mat_lab(0, 2) = -interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 2),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+    pha_mat_lab(1, 2) = -interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 6),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+    pha_mat_lab(2, 0) = -interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 8),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+    pha_mat_lab(2, 1) = -interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 9),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+  }
+  pha_mat_lab(2, 2) = interp(
+      itw,
+      pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 10),
+      za_sca_gp,
+      delta_aa_gp,
+      za_inc_gp);
+  if (stokes_dim == 3) {
+    return;
+  }
+  if (delta_aa >= 0) {
+    pha_mat_lab(0, 3) = interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 3),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+    pha_mat_lab(1, 3) = interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 7),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+    pha_mat_lab(3, 0) = interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 12),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+    pha_mat_lab(3, 1) = interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 13),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+  } else {
+    pha_mat_lab(0, 3) = -interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 3),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+    pha_mat_lab(1, 3) = -interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 7),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+    pha_mat_lab(3, 0) = -interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 12),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+    pha_mat_lab(3, 1) = -interp(
+        itw,
+        pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 13),
+        za_sca_gp,
+        delta_aa_gp,
+        za_inc_gp);
+  }
+  pha_mat_lab(2, 3) = interp(
+      itw,
+      pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 11),
+      za_sca_gp,
+      delta_aa_gp,
+      za_inc_gp);
+  pha_mat_lab(3, 2) = interp(
+      itw,
+      pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 14),
+      za_sca_gp,
+      delta_aa_gp,
+      za_inc_gp);
+  pha_mat_lab(3, 3) = interp(
+      itw,
+      pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 15),
+      za_sca_gp,
+      delta_aa_gp,
+      za_inc_gp);
+}
+
 //! Transformation of phase matrix.
 /*! 
   In the single scattering database the data of the phase matrix is 
@@ -1768,165 +2060,13 @@ void pha_matTransform(  //Output
 
         interpweights(itw, za_sca_gp, delta_aa_gp, za_inc_gp);
 
-        pha_mat_lab(0, 0) =
-            interp(itw,
-                   pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 0),
-                   za_sca_gp,
-                   delta_aa_gp,
-                   za_inc_gp);
-        if (stokes_dim == 1) {
-          break;
-        }
-        pha_mat_lab(0, 1) =
-            interp(itw,
-                   pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 1),
-                   za_sca_gp,
-                   delta_aa_gp,
-                   za_inc_gp);
-        pha_mat_lab(1, 0) =
-            interp(itw,
-                   pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 4),
-                   za_sca_gp,
-                   delta_aa_gp,
-                   za_inc_gp);
-        pha_mat_lab(1, 1) =
-            interp(itw,
-                   pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 5),
-                   za_sca_gp,
-                   delta_aa_gp,
-                   za_inc_gp);
-        if (stokes_dim == 2) {
-          break;
-        }
-        if (delta_aa >= 0) {
-          pha_mat_lab(0, 2) = interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 2),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-          pha_mat_lab(1, 2) = interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 6),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-          pha_mat_lab(2, 0) = interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 8),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-          pha_mat_lab(2, 1) = interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 9),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-        } else {
-          pha_mat_lab(0, 2) = -interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 2),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-          pha_mat_lab(1, 2) = -interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 6),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-          pha_mat_lab(2, 0) = -interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 8),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-          pha_mat_lab(2, 1) = -interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 9),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-        }
-        pha_mat_lab(2, 2) = interp(
-            itw,
-            pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 10),
-            za_sca_gp,
-            delta_aa_gp,
-            za_inc_gp);
-        if (stokes_dim == 3) {
-          break;
-        }
-        if (delta_aa >= 0) {
-          pha_mat_lab(0, 3) = interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 3),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-          pha_mat_lab(1, 3) = interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 7),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-          pha_mat_lab(3, 0) = interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 12),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-          pha_mat_lab(3, 1) = interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 13),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-        } else {
-          pha_mat_lab(0, 3) = -interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 3),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-          pha_mat_lab(1, 3) = -interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 7),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-          pha_mat_lab(3, 0) = -interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 12),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-          pha_mat_lab(3, 1) = -interp(
-              itw,
-              pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 13),
-              za_sca_gp,
-              delta_aa_gp,
-              za_inc_gp);
-        }
-        pha_mat_lab(2, 3) = interp(
-            itw,
-            pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 11),
-            za_sca_gp,
-            delta_aa_gp,
-            za_inc_gp);
-        pha_mat_lab(3, 2) = interp(
-            itw,
-            pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 14),
-            za_sca_gp,
-            delta_aa_gp,
-            za_inc_gp);
-        pha_mat_lab(3, 3) = interp(
-            itw,
-            pha_mat_data(Range(joker), Range(joker), Range(joker), 0, 15),
-            za_sca_gp,
-            delta_aa_gp,
-            za_inc_gp);
+        pha_mat_labAzimuthRnd(pha_mat_lab,
+                              pha_mat_data,
+                              itw,
+                              za_sca_gp,
+                              delta_aa_gp,
+                              za_inc_gp,
+                              delta_aa);
         break;
       }
 
@@ -2169,41 +2309,130 @@ void interpolate_scat_angle(  //Output:
   }
 }
 
-//! Calculate phase matrix in laboratory coordinate system.
-/*! 
-  Transformation function for the phase matrix for the case of
+//! Rotation of the Stokes frames in pha_mat_labCalc.
+/*!
+  Derives the angles sigma1 and sigma2 between the scattering plane and
+  the meridian planes of the incident and scattered directions, for
   randomly oriented particles (case PTYPE_TOTAL_RND).
-  
-  Some of the formulas can be found in 
 
-  Mishchenkho: "Scattering, Absorption and Emission of Light 
-  by Small Particles", Cambridge University Press, 2002
-  Capter 4
-
-  The full set of formulas will be documented in AUG.
-
-  Output and Input:
-  \param pha_mat_lab Phase matrix in laboratory frame.
-  Input: 
-  \param pha_mat_int Interpolated phase matrix.
-  \param za_sca Zenith angle of scattered direction.
-  \param aa_sca Azimuth angle of scattered direction.
-  \param za_inc Zenith angle of incoming direction.
-  \param aa_inc Azimuth angle of incoming direction.
-  \param theta_rad Scattering angle [rad].
-  
-  \author Claudia Emde
-  \date   2003-05-13 
+  \param[out] C1  cos(2 * sigma1).
+  \param[out] C2  cos(2 * sigma2).
+  \param[out] S1  sin(2 * sigma1).
+  \param[out] S2  sin(2 * sigma2).
+  \param[in]  za_sca  Zenith angle of scattered direction.
+  \param[in]  aa_sca  Azimuth angle of scattered direction.
+  \param[in]  za_inc  Zenith angle of incoming direction.
+  \param[in]  aa_inc  Azimuth angle of incoming direction.
+  \param[in]  theta_rad  Scattering angle [rad].
+  \return     False if no rotation is needed, i.e. for forward and
+                backward scattering and directions on one meridian. The
+                angles are not set in this case.
 */
-void pha_mat_labCalc(  //Output:
-    MatrixView pha_mat_lab,
+static bool pha_mat_labRotation(  //Output:
+    Numeric& C1,
+    Numeric& C2,
+    Numeric& S1,
+    Numeric& S2,
     //Input:
-    ConstVectorView pha_mat_int,
     const Numeric& za_sca,
     const Numeric& aa_sca,
     const Numeric& za_inc,
     const Numeric& aa_inc,
     const Numeric& theta_rad) {
+  Numeric za_sca_rad = za_sca * DEG2RAD;
+  Numeric za_inc_rad = za_inc * DEG2RAD;
+  Numeric aa_sca_rad = aa_sca * DEG2RAD;
+  Numeric aa_inc_rad = aa_inc * DEG2RAD;
+
+  const Numeric ANGTOL_RAD = 1e-6;  //CPD: this constant is used to adjust
+      //zenith angles close to 0 and PI.  This is
+      //also used to avoid float == float statements.
+
+  //
+  // Several cases have to be considered:
+  //
+
+  if ((abs(theta_rad) < ANGTOL_RAD)          // forward scattering
+      || (abs(theta_rad - PI) < ANGTOL_RAD)  // backward scattering
+      ||
+      (abs(aa_inc_rad - aa_sca_rad) < ANGTOL_RAD)  // inc and sca on meridian
+      || (abs(abs(aa_inc_rad - aa_sca_rad) - 360.) < ANGTOL_RAD)  //   "
+      || (abs(abs(aa_inc_rad - aa_sca_rad) - 180.) < ANGTOL_RAD)  //   "
+  ) {
+    return false;
+  }
+
+  Numeric sigma1;
+  Numeric sigma2;
+
+  Numeric s1, s2;
+
+  // In these cases we have to take limiting values.
+
+  if (za_inc_rad < ANGTOL_RAD) {
+    sigma1 = PI + aa_sca_rad - aa_inc_rad;
+    sigma2 = 0;
+  } else if (za_inc_rad > PI - ANGTOL_RAD) {
+    sigma1 = aa_sca_rad - aa_inc_rad;
+    sigma2 = PI;
+  } else if (za_sca_rad < ANGTOL_RAD) {
+    sigma1 = 0;
+    sigma2 = PI + aa_sca_rad - aa_inc_rad;
+  } else if (za_sca_rad > PI - ANGTOL_RAD) {
+    sigma1 = PI;
+    sigma2 = aa_sca_rad - aa_inc_rad;
+  } else {
+    s1 = (cos(za_sca_rad) - cos(za_inc_rad) * cos(theta_rad)) /
+         (sin(za_inc_rad) * sin(theta_rad));
+    s2 = (cos(za_inc_rad) - cos(za_sca_rad) * cos(theta_rad)) /
+         (sin(za_sca_rad) * sin(theta_rad));
+
+    sigma1 = acos(s1);
+    sigma2 = acos(s2);
+
+    // Arccos is only defined in the range from -1 ... 1
+    // Numerical problems can appear for values close to 1 or -1
+    // this (also) catches the case when inc and sca are on one meridian
+    if (std::isnan(sigma1) || std::isnan(sigma2)) {
+      if (abs(s1 - 1) < ANGTOL_RAD) sigma1 = 0;
+      if (abs(s1 + 1) < ANGTOL_RAD) sigma1 = PI;
+      if (abs(s2 - 1) < ANGTOL_RAD) sigma2 = 0;
+      if (abs(s2 + 1) < ANGTOL_RAD) sigma2 = PI;
+    }
+  }
+
+  C1 = cos(2 * sigma1);
+  C2 = cos(2 * sigma2);
+
+  S1 = sin(2 * sigma1);
+  S2 = sin(2 * sigma2);
+
+  return true;
+}
+
+//! Phase matrix in laboratory frame from rotation of the Stokes frames.
+/*!
+  The part of pha_mat_labCalc that follows pha_mat_labRotation.
+
+  \param[out] pha_mat_lab  Phase matrix in laboratory frame.
+  \param[in]  pha_mat_int  Interpolated phase matrix.
+  \param[in]  C1  cos(2 * sigma1).
+  \param[in]  C2  cos(2 * sigma2).
+  \param[in]  S1  sin(2 * sigma1).
+  \param[in]  S2  sin(2 * sigma2).
+  \param[in]  rotate  Return value of pha_mat_labRotation.
+  \param[in]  delta_aa  Azimuth difference between the directions.
+*/
+static void pha_mat_labRotate(  //Output:
+    MatrixView pha_mat_lab,
+    //Input:
+    ConstVectorView pha_mat_int,
+    const Numeric& C1,
+    const Numeric& C2,
+    const Numeric& S1,
+    const Numeric& S2,
+    const bool rotate,
+    const Numeric& delta_aa) {
   const Index stokes_dim = pha_mat_lab.ncols();
 
   if (std::isnan(F11)) {
@@ -2222,26 +2451,7 @@ void pha_mat_labCalc(  //Output:
   pha_mat_lab(0, 0) = F11;
 
   if (stokes_dim > 1) {
-    Numeric za_sca_rad = za_sca * DEG2RAD;
-    Numeric za_inc_rad = za_inc * DEG2RAD;
-    Numeric aa_sca_rad = aa_sca * DEG2RAD;
-    Numeric aa_inc_rad = aa_inc * DEG2RAD;
-
-    const Numeric ANGTOL_RAD = 1e-6;  //CPD: this constant is used to adjust
-        //zenith angles close to 0 and PI.  This is
-        //also used to avoid float == float statements.
-
-    //
-    // Several cases have to be considered:
-    //
-
-    if ((abs(theta_rad) < ANGTOL_RAD)          // forward scattering
-        || (abs(theta_rad - PI) < ANGTOL_RAD)  // backward scattering
-        ||
-        (abs(aa_inc_rad - aa_sca_rad) < ANGTOL_RAD)  // inc and sca on meridian
-        || (abs(abs(aa_inc_rad - aa_sca_rad) - 360.) < ANGTOL_RAD)  //   "
-        || (abs(abs(aa_inc_rad - aa_sca_rad) - 180.) < ANGTOL_RAD)  //   "
-    ) {
+    if (!rotate) {
       pha_mat_lab(0, 1) = F12;
       pha_mat_lab(1, 0) = F12;
       pha_mat_lab(1, 1) = F22;
@@ -2266,51 +2476,6 @@ void pha_mat_labCalc(  //Output:
     }
 
     else {
-      Numeric sigma1;
-      Numeric sigma2;
-
-      Numeric s1, s2;
-
-      // In these cases we have to take limiting values.
-
-      if (za_inc_rad < ANGTOL_RAD) {
-        sigma1 = PI + aa_sca_rad - aa_inc_rad;
-        sigma2 = 0;
-      } else if (za_inc_rad > PI - ANGTOL_RAD) {
-        sigma1 = aa_sca_rad - aa_inc_rad;
-        sigma2 = PI;
-      } else if (za_sca_rad < ANGTOL_RAD) {
-        sigma1 = 0;
-        sigma2 = PI + aa_sca_rad - aa_inc_rad;
-      } else if (za_sca_rad > PI - ANGTOL_RAD) {
-        sigma1 = PI;
-        sigma2 = aa_sca_rad - aa_inc_rad;
-      } else {
-        s1 = (cos(za_sca_rad) - cos(za_inc_rad) * cos(theta_rad)) /
-             (sin(za_inc_rad) * sin(theta_rad));
-        s2 = (cos(za_inc_rad) - cos(za_sca_rad) * cos(theta_rad)) /
-             (sin(za_sca_rad) * sin(theta_rad));
-
-        sigma1 = acos(s1);
-        sigma2 = acos(s2);
-
-        // Arccos is only defined in the range from -1 ... 1
-        // Numerical problems can appear for values close to 1 or -1
-        // this (also) catches the case when inc and sca are on one meridian
-        if (std::isnan(sigma1) || std::isnan(sigma2)) {
-          if (abs(s1 - 1) < ANGTOL_RAD) sigma1 = 0;
-          if (abs(s1 + 1) < ANGTOL_RAD) sigma1 = PI;
-          if (abs(s2 - 1) < ANGTOL_RAD) sigma2 = 0;
-          if (abs(s2 + 1) < ANGTOL_RAD) sigma2 = PI;
-        }
-      }
-
-      const Numeric C1 = cos(2 * sigma1);
-      const Numeric C2 = cos(2 * sigma2);
-
-      const Numeric S1 = sin(2 * sigma1);
-      const Numeric S2 = sin(2 * sigma2);
-
       pha_mat_lab(0, 1) = C1 * F12;
       pha_mat_lab(1, 0) = C2 * F12;
       pha_mat_lab(1, 1) = C1 * C2 * F22 - S1 * S2 * F33;
@@ -2341,8 +2506,6 @@ void pha_mat_labCalc(  //Output:
             by Remote Sensing Techniques (R. Guzzi, Ed.), Springer-Verlag, 
             Berlin, pp. 77-127. 
             This is available at http://www.giss.nasa.gov/~crmim/publications/ */
-        Numeric delta_aa = aa_sca - aa_inc + (aa_sca - aa_inc < -180) * 360 -
-                           (aa_sca - aa_inc > 180) * 360;
         if (delta_aa >= 0) {
           pha_mat_lab(0, 2) = S1 * F12;
           pha_mat_lab(1, 2) = S1 * C2 * F22 + C1 * S2 * F33;
@@ -2375,6 +2538,266 @@ void pha_mat_labCalc(  //Output:
   }
 }
 
+//! Calculate phase matrix in laboratory coordinate system.
+/*! 
+  Transformation function for the phase matrix for the case of
+  randomly oriented particles (case PTYPE_TOTAL_RND).
+  
+  Some of the formulas can be found in 
+
+  Mishchenkho: "Scattering, Absorption and Emission of Light 
+  by Small Particles", Cambridge University Press, 2002
+  Capter 4
+
+  The full set of formulas will be documented in AUG.
+
+  Output and Input:
+  \param pha_mat_lab Phase matrix in laboratory frame.
+  Input: 
+  \param pha_mat_int Interpolated phase matrix.
+  \param za_sca Zenith angle of scattered direction.
+  \param aa_sca Azimuth angle of scattered direction.
+  \param za_inc Zenith angle of incoming direction.
+  \param aa_inc Azimuth angle of incoming direction.
+  \param theta_rad Scattering angle [rad].
+  
+  \author Claudia Emde
+  \date   2003-05-13 
+*/
+void pha_mat_labCalc(  //Output:
+    MatrixView pha_mat_lab,
+    //Input:
+    ConstVectorView pha_mat_int,
+    const Numeric& za_sca,
+    const Numeric& aa_sca,
+    const Numeric& za_inc,
+    const Numeric& aa_inc,
+    const Numeric& theta_rad) {
+  Numeric C1 = 1, C2 = 1, S1 = 0, S2 = 0;
+  bool rotate = false;
+  if (pha_mat_lab.ncols() > 1) {
+    rotate = pha_mat_labRotation(
+        C1, C2, S1, S2, za_sca, aa_sca, za_inc, aa_inc, theta_rad);
+  }
+  const Numeric delta_aa = aa_sca - aa_inc + (aa_sca - aa_inc < -180) * 360 -
+                           (aa_sca - aa_inc > 180) * 360;
+
+  pha_mat_labRotate(pha_mat_lab, pha_mat_int, C1, C2, S1, S2, rotate, delta_aa);
+}
+
+//! Sets up the direction dependent part of pha_matTransform.
+/*!
+  See PhaMatTransformTable. Nothing is done if the table already holds
+  the given ptype, data grids and directions. Tables of ptypes other than
+  PTYPE_TOTAL_RND and PTYPE_AZIMUTH_RND hold no data.
+
+  \param[in,out] table        Transformation table.
+  \param[in]     za_datagrid  Zenith angle grid in the database.
+  \param[in]     aa_datagrid  Azimuth angle grid in the database.
+  \param[in]     ptype        Type of scattering element.
+  \param[in]     za_sca       Zenith angles of scattered directions.
+  \param[in]     aa_sca       Azimuth angles of scattered directions.
+  \param[in]     za_inc       Zenith angles of incoming directions.
+  \param[in]     aa_inc       Azimuth angles of incoming directions.
+*/
+void pha_mat_transform_tableCalc(  //Output and Input
+    PhaMatTransformTable& table,
+    //Input
+    ConstVectorView za_datagrid,
+    ConstVectorView aa_datagrid,
+    const PType& ptype,
+    ConstVectorView za_sca,
+    ConstVectorView aa_sca,
+    ConstVectorView za_inc,
+    ConstVectorView aa_inc) {
+  auto same = [](ConstVectorView a, ConstVectorView b) {
+    if (a.nelem() != b.nelem()) return false;
+    for (Index i = 0; i < a.nelem(); i++)
+      if (a[i] != b[i]) return false;
+    return true;
+  };
+  if (table.ptype == ptype && same(table.za_datagrid, za_datagrid) &&
+      same(table.aa_datagrid, aa_datagrid) && same(table.za_sca, za_sca) &&
+      same(table.aa_sca, aa_sca) && same(table.za_inc, za_inc) &&
+      same(table.aa_inc, aa_inc)) {
+    return;
+  }
+
+  table.ptype = ptype;
+  table.za_datagrid = za_datagrid;
+  table.aa_datagrid = aa_datagrid;
+  table.za_sca = za_sca;
+  table.aa_sca = aa_sca;
+  table.za_inc = za_inc;
+  table.aa_inc = aa_inc;
+
+  const Index nza_sca = za_sca.nelem();
+  const Index naa_sca = aa_sca.nelem();
+  const Index nza_inc = za_inc.nelem();
+  const Index naa_inc = aa_inc.nelem();
+  const Index npairs = nza_sca * naa_sca * nza_inc * naa_inc;
+
+  table.delta_aa.resize(naa_sca, naa_inc);
+  for (Index j = 0; j < naa_sca; j++)
+    for (Index l = 0; l < naa_inc; l++)
+      table.delta_aa(j, l) = aa_sca[j] - aa_inc[l] +
+                             (aa_sca[j] - aa_inc[l] < -180) * 360 -
+                             (aa_sca[j] - aa_inc[l] > 180) * 360;
+
+  switch (ptype) {
+    case PTYPE_TOTAL_RND: {
+      Vector theta(npairs);
+      table.rotation.resize(npairs, 4);
+      table.rotate.resize(npairs);
+
+      Index p = 0;
+      for (Index i = 0; i < nza_sca; i++)
+        for (Index j = 0; j < naa_sca; j++)
+          for (Index k = 0; k < nza_inc; k++)
+            for (Index l = 0; l < naa_inc; l++, p++) {
+              const Numeric theta_rad =
+                  scat_angle(za_sca[i], aa_sca[j], za_inc[k], aa_inc[l]);
+              theta[p] = RAD2DEG * theta_rad;
+              table.rotate[p] = pha_mat_labRotation(table.rotation(p, 0),
+                                                    table.rotation(p, 1),
+                                                    table.rotation(p, 2),
+                                                    table.rotation(p, 3),
+                                                    za_sca[i],
+                                                    aa_sca[j],
+                                                    za_inc[k],
+                                                    aa_inc[l],
+                                                    theta_rad);
+            }
+
+      table.gp.resize(npairs);
+      gridpos(table.gp, za_datagrid, theta);
+      table.itw.resize(npairs, 2);
+      for (p = 0; p < npairs; p++)
+        interpweights(table.itw(p, joker), table.gp[p]);
+      break;
+    }
+
+    case PTYPE_AZIMUTH_RND: {
+      table.gp_za_sca.resize(nza_sca);
+      gridpos(table.gp_za_sca, za_datagrid, za_sca);
+      table.gp_za_inc.resize(nza_inc);
+      gridpos(table.gp_za_inc, za_datagrid, za_inc);
+
+      Vector abs_delta_aa(naa_sca * naa_inc);
+      for (Index j = 0; j < naa_sca; j++)
+        for (Index l = 0; l < naa_inc; l++)
+          abs_delta_aa[j * naa_inc + l] = abs(table.delta_aa(j, l));
+      table.gp.resize(naa_sca * naa_inc);
+      gridpos(table.gp, aa_datagrid, abs_delta_aa);
+
+      table.itw.resize(npairs, 8);
+      Index p = 0;
+      for (Index i = 0; i < nza_sca; i++)
+        for (Index j = 0; j < naa_sca; j++)
+          for (Index k = 0; k < nza_inc; k++)
+            for (Index l = 0; l < naa_inc; l++, p++)
+              interpweights(table.itw(p, joker),
+                            table.gp_za_sca[i],
+                            table.gp[j * naa_inc + l],
+                            table.gp_za_inc[k]);
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+//! Transformation of phase matrix, using a transformation table.
+/*!
+  As pha_matTransform, for one scattered direction and all incoming
+  directions of the table. The table must be set up by
+  pha_mat_transform_tableCalc for the grids and the ptype of the
+  scattering element.
+
+  \param[out] pha_mat_lab   Phase matrix in laboratory frame, for all
+                              incoming directions [za_inc, aa_inc, stokes_dim,
+                              stokes_dim].
+  \param[in]  pha_mat_data  Phase matrix in database.
+  \param[in]  table         Transformation table.
+  \param[in]  za_sca_idx    Index of scattered direction within the
+                              scattered zenith angles of the table.
+  \param[in]  aa_sca_idx    Index of scattered direction within the
+                              scattered azimuth angles of the table.
+*/
+void pha_matTransformTabulated(  //Output
+    Tensor4View pha_mat_lab,
+    //Input
+    ConstTensor5View pha_mat_data,
+    const PhaMatTransformTable& table,
+    const Index& za_sca_idx,
+    const Index& aa_sca_idx,
+    const Verbosity& verbosity) {
+  const Index stokes_dim = pha_mat_lab.ncols();
+  const Index naa_sca = table.aa_sca.nelem();
+  const Index nza_inc = table.za_inc.nelem();
+  const Index naa_inc = table.aa_inc.nelem();
+
+  assert(pha_mat_lab.nbooks() == nza_inc);
+  assert(pha_mat_lab.npages() == naa_inc);
+
+  if (stokes_dim > 4 || stokes_dim < 1) {
+    throw runtime_error(
+        "The dimension of the stokes vector \n"
+        "must be 1,2,3 or 4");
+  }
+
+  // First pair of the scattered direction
+  const Index p0 = (za_sca_idx * naa_sca + aa_sca_idx) * nza_inc * naa_inc;
+
+  switch (table.ptype) {
+    case PTYPE_TOTAL_RND: {
+      Vector pha_mat_int(6);
+      assert(pha_mat_data.ncols() == 6);
+
+      for (Index k = 0; k < nza_inc; k++)
+        for (Index l = 0; l < naa_inc; l++) {
+          const Index p = p0 + k * naa_inc + l;
+          for (Index i = 0; i < 6; i++)
+            pha_mat_int[i] = interp(table.itw(p, joker),
+                                    pha_mat_data(joker, 0, 0, 0, i),
+                                    table.gp[p]);
+
+          pha_mat_labRotate(pha_mat_lab(k, l, joker, joker),
+                            pha_mat_int,
+                            table.rotation(p, 0),
+                            table.rotation(p, 1),
+                            table.rotation(p, 2),
+                            table.rotation(p, 3),
+                            table.rotate[p],
+                            table.delta_aa(aa_sca_idx, l));
+        }
+      break;
+    }
+
+    case PTYPE_AZIMUTH_RND: {
+      assert(pha_mat_data.ncols() == 16);
+      assert(pha_mat_data.npages() == table.za_datagrid.nelem());
+
+      for (Index k = 0; k < nza_inc; k++)
+        for (Index l = 0; l < naa_inc; l++)
+          pha_mat_labAzimuthRnd(pha_mat_lab(k, l, joker, joker),
+                                pha_mat_data,
+                                table.itw(p0 + k * naa_inc + l, joker),
+                                table.gp_za_sca[za_sca_idx],
+                                table.gp[aa_sca_idx * naa_inc + l],
+                                table.gp_za_inc[k],
+                                table.delta_aa(aa_sca_idx, l));
+      break;
+    }
+
+    default: {
+      CREATE_OUT0;
+      out0 << "Not all ptype cases are implemented\n";
+    }
+  }
+}
+
 ostream& operator<<(ostream& os, const SingleScatteringData& /*ssd*/) {
   os << "SingleScatteringData: Output operator not implemented";
   return os;
@@ -275,6 +275,67 @@ void pha_matTransform(  //Output
     ConstVectorView aa_grid,
     const Verbosity& verbosity);
 
+//! Direction dependent part of pha_matTransform.
+/*!
+  pha_matTransform derives the scattering angle, the interpolation weights
+  and the rotation of the Stokes frames from the scattered and incoming
+  directions on every call. This table holds them for all combinations of
+  a set of scattered directions and a set of incoming directions, for one
+  ptype and one set of data grids. Direction pairs are ordered as
+  [za_sca, aa_sca, za_inc, aa_inc].
+
+  The table is set up by pha_mat_transform_tableCalc and applied to the
+  phase matrix data of any scattering element with the same ptype and data
+  grids by pha_matTransformTabulated.
+*/
+struct PhaMatTransformTable {
+  PType ptype{PTYPE_GENERAL};
+  Vector za_datagrid;
+  Vector aa_datagrid;
+  Vector za_sca;
+  Vector aa_sca;
+  Vector za_inc;
+  Vector aa_inc;
+  //! Positions of the scattering angles in za_datagrid, per direction pair
+  //! (PTYPE_TOTAL_RND), or of the absolute azimuth differences in
+  //! aa_datagrid, per [aa_sca, aa_inc] (PTYPE_AZIMUTH_RND).
+  ArrayOfGridPos gp;
+  //! Positions of za_sca in za_datagrid (PTYPE_AZIMUTH_RND).
+  ArrayOfGridPos gp_za_sca;
+  //! Positions of za_inc in za_datagrid (PTYPE_AZIMUTH_RND).
+  ArrayOfGridPos gp_za_inc;
+  //! Interpolation weights, per direction pair.
+  Matrix itw;
+  //! cos(2 sigma1), cos(2 sigma2), sin(2 sigma1), sin(2 sigma2) of
+  //! pha_mat_labCalc, per direction pair (PTYPE_TOTAL_RND).
+  Matrix rotation;
+  //! Whether the Stokes frames are rotated, per direction pair
+  //! (PTYPE_TOTAL_RND).
+  ArrayOfIndex rotate;
+  //! Azimuth difference, per [aa_sca, aa_inc].
+  Matrix delta_aa;
+};
+
+void pha_mat_transform_tableCalc(  //Output and Input
+    PhaMatTransformTable& table,
+    //Input
+    ConstVectorView za_datagrid,
+    ConstVectorView aa_datagrid,
+    const PType& ptype,
+    ConstVectorView za_sca,
+    ConstVectorView aa_sca,
+    ConstVectorView za_inc,
+    ConstVectorView aa_inc);
+
+void pha_matTransformTabulated(  //Output
+    Tensor4View pha_mat_lab,
+    //Input
+    ConstTensor5View pha_mat_data,
+    const PhaMatTransformTable& table,
+    const Index& za_sca_idx,
+    const Index& aa_sca_idx,
+    const Verbosity& verbosity);
+
 void ext_matFromabs_vec(  //Output
     MatrixView ext_mat,
     //Input
@@ -134,13 +134,15 @@ bool get_parameters(int argc, char **argv) {
       {"docserver", optional_argument, NULL, 's'},
       {"docdaemon", optional_argument, NULL, 'S'},
       {"baseurl", required_argument, NULL, 'U'},
+      {"server", optional_argument, NULL, 'Z'},
+      {"workers", required_argument, NULL, 'W'},
 #endif
       {"workspacevariables", required_argument, NULL, 'w'},
       {"version", no_argument, NULL, 'v'},
       {NULL, no_argument, NULL, 0}};
 
   parameters.usage =
-      "Usage: arts [-bBdghimnrsSvw]\n"
+      "Usage: arts [-bBdghimnrsSvwWZ]\n"
       "       [--basename <name>]\n"
       "       [--describe <method or variable>]\n"
       "       [--groups]\n"
@@ -156,6 +158,7 @@ bool get_parameters(int argc, char **argv) {
 #ifdef ENABLE_DOCSERVER
       "       [--docserver[=<port>] --baseurl=BASEURL]\n"
       "       [--docdaemon[=<port>] --baseurl=BASEURL]\n"
+      "       [--server[=<port>] --workers=<#>] [resident1.arts ...]\n"
 #endif
       "       [--workspacevariables all|<method>]\n"
       "       file1.arts file2.arts ...";
@@ -213,6 +216,17 @@ bool get_parameters(int argc, char **argv) {
       "                    Default is 9000.\n"
       "-S, --docdaemon     Start documentation server in the background.\n"
       "-U, --baseurl       Base URL for the documentation server.\n"
+      "-Z, --server        Start job server. Control files given on the\n"
+      "                    command line are executed once at start-up, the\n"
+      "                    variables they set stay in memory for all jobs.\n"
+      "                    Jobs are submitted by HTTP, see jobserver.h.\n"
+      "                    Optionally, specify the port number the server\n"
+      "                    should listen on, e.g. arts --server=9999.\n"
+      "                    Default is 9001.\n"
+      "-W, --workers       Number of jobs the job server handles in\n"
+      "                    parallel. The control files are executed one at\n"
+      "                    a time, the workers overlap the preparation of\n"
+      "                    jobs and the sending of results. Default is 1.\n"
 #endif
       "-v, --version       Show version information.\n"
       "-w, --workspacevariables  If this is given the argument 'all',\n"
@@ -354,6 +368,27 @@ bool get_parameters(int argc, char **argv) {
       case 'U':
         parameters.baseurl = optarg;
         break;
+      case 'Z': {
+        if (optarg) {
+          istringstream iss(optarg);
+          iss >> std::dec >> parameters.server;
+          if (iss.bad() || !iss.eof()) {
+            cerr << "Argument to --server (-Z) must be an integer!\n";
+            arts_exit();
+          }
+        } else
+          parameters.server = -1;
+        break;
+      }
+      case 'W': {
+        istringstream iss(optarg);
+        iss >> std::dec >> parameters.workers;
+        if (iss.bad() || !iss.eof()) {
+          cerr << "Argument to --workers (-W) must be an integer!\n";
+          arts_exit();
+        }
+        break;
+      }
       case 'v':
         parameters.version = true;
         break;
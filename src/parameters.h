@@ -64,6 +64,8 @@ class Parameters {
         docserver(0),
         baseurl(""),
         daemon(false),
+        server(0),
+        workers(1),
         gui(false),
         check_docs(false) { /* Nothing to be done here */
     }
@@ -127,6 +129,10 @@ class Parameters {
   String baseurl;
   /** Flag to run the docserver in the background. */
   bool daemon;
+  /** Port to use for the job server. */
+  Index server;
+  /** Number of jobs the job server handles in parallel. */
+  Index workers;
   /** Flag to run with graphical user interface. */
   bool gui;
   /** Flag to check built-in documentation */
@@ -34,7 +34,12 @@
 
 #include "ppath.h"
 #include <cmath>
+#include <list>
+#include <map>
+#include <memory>
+#include <set>
 #include <stdexcept>
+#include <vector>
 #include "agenda_class.h"
 #include "array.h"
 #include "arts_omp.h"
@@ -5203,30 +5208,31 @@ void ppath_start_stepping(Ppath& ppath,
   }      // End 3D
 }
 
-void ppath_calc(Workspace& ws,
-                Ppath& ppath,
-                const Agenda& ppath_step_agenda,
-                const Index& atmosphere_dim,
-                const Vector& p_grid,
-                const Vector& lat_grid,
-                const Vector& lon_grid,
-                const Tensor3& z_field,
-                const Vector& f_grid,
-                const Vector& refellipsoid,
-                const Matrix& z_surface,
-                const Index& cloudbox_on,
-                const ArrayOfIndex& cloudbox_limits,
-                const Vector& rte_pos,
-                const Vector& rte_los,
-                const Numeric& ppath_lmax,
-                const Numeric& ppath_lraytrace,
-                const bool& ppath_inside_cloudbox_do,
-                const Verbosity& verbosity) {
-  // This function is a WSM but it is normally only called from yCalc.
-  // For that reason, this function does not repeat input checks that are
-  // performed in yCalc, it only performs checks regarding the sensor
-  // position and LOS.
-
+namespace {
+
+/** The core of ppath_calc.
+
+    Performs the stepping, where each path step is obtained by calling
+    *take_step*, and merges the steps to a complete path. This allows the
+    same code to be used with ppath_step_agenda and with direct calls of
+    the geometrical step functions.
+*/
+template <typename StepFunc>
+void ppath_calc_stepping(Ppath& ppath,
+                         StepFunc&& take_step,
+                         const Index& atmosphere_dim,
+                         const Vector& p_grid,
+                         const Vector& lat_grid,
+                         const Vector& lon_grid,
+                         const Tensor3& z_field,
+                         const Vector& refellipsoid,
+                         const Matrix& z_surface,
+                         const Index& cloudbox_on,
+                         const ArrayOfIndex& cloudbox_limits,
+                         const Vector& rte_pos,
+                         const Vector& rte_los,
+                         const bool& ppath_inside_cloudbox_do,
+                         const Verbosity& verbosity) {
   //--- Check input -----------------------------------------------------------
   chk_rte_pos(atmosphere_dim, rte_pos);
   chk_rte_los(atmosphere_dim, rte_los);
@@ -5292,12 +5298,7 @@ void ppath_calc(Workspace& ws,
     //
     istep++;
     //
-    ppath_step_agendaExecute(ws,
-                             ppath_step,
-                             ppath_lmax,
-                             ppath_lraytrace,
-                             f_grid,
-                             ppath_step_agenda);
+    take_step(ppath_step);
     // For debugging:
     //Print( ppath_step, 0, verbosity );
 
@@ -5508,12 +5509,7 @@ void ppath_calc(Workspace& ws,
     // those cases:
     if (ppath_what_background(ppath_step) > 1) {
       //Print( ppath_step, 0, verbosity );
-      ppath_step_agendaExecute(ws,
-                               ppath_step,
-                               ppath_lmax,
-                               ppath_lraytrace,
-                               f_grid,
-                               ppath_step_agenda);
+      take_step(ppath_step);
       ppath.nreal[0] = ppath_step.nreal[0];
       ppath.ngroup[0] = ppath_step.ngroup[0];
     }
@@ -5580,4 +5576,547 @@ void ppath_calc(Workspace& ws,
   }
 }
 
+}  // namespace
+
+void ppath_calc(Workspace& ws,
+                Ppath& ppath,
+                const Agenda& ppath_step_agenda,
+                const Index& atmosphere_dim,
+                const Vector& p_grid,
+                const Vector& lat_grid,
+                const Vector& lon_grid,
+                const Tensor3& z_field,
+                const Vector& f_grid,
+                const Vector& refellipsoid,
+                const Matrix& z_surface,
+                const Index& cloudbox_on,
+                const ArrayOfIndex& cloudbox_limits,
+                const Vector& rte_pos,
+                const Vector& rte_los,
+                const Numeric& ppath_lmax,
+                const Numeric& ppath_lraytrace,
+                const bool& ppath_inside_cloudbox_do,
+                const Verbosity& verbosity) {
+  // This function is a WSM but it is normally only called from yCalc.
+  // For that reason, this function does not repeat input checks that are
+  // performed in yCalc, it only performs checks regarding the sensor
+  // position and LOS.
+  ppath_calc_stepping(
+      ppath,
+      [&](Ppath& ppath_step) {
+        ppath_step_agendaExecute(ws,
+                                 ppath_step,
+                                 ppath_lmax,
+                                 ppath_lraytrace,
+                                 f_grid,
+                                 ppath_step_agenda);
+      },
+      atmosphere_dim,
+      p_grid,
+      lat_grid,
+      lon_grid,
+      z_field,
+      refellipsoid,
+      z_surface,
+      cloudbox_on,
+      cloudbox_limits,
+      rte_pos,
+      rte_los,
+      ppath_inside_cloudbox_do,
+      verbosity);
+}
+
+
+void ppath_calc_batch(Workspace& ws,
+                      ArrayOfPpath& ppaths,
+                      const Agenda& ppath_step_agenda,
+                      const Index& atmosphere_dim,
+                      const Vector& p_grid,
+                      const Vector& lat_grid,
+                      const Vector& lon_grid,
+                      const Tensor3& z_field,
+                      const Vector& f_grid,
+                      const Vector& refellipsoid,
+                      const Matrix& z_surface,
+                      const Index& cloudbox_on,
+                      const ArrayOfIndex& cloudbox_limits,
+                      ConstMatrixView rte_pos,
+                      ConstMatrixView rte_los,
+                      const Numeric& ppath_lmax,
+                      const Numeric& ppath_lraytrace,
+                      const bool& ppath_inside_cloudbox_do,
+                      const Verbosity& verbosity) {
+  const Index nrays = rte_pos.nrows();
+  if (rte_los.nrows() != nrays) {
+    ostringstream os;
+    os << "The number of positions (" << nrays << ") and line-of-sights ("
+       << rte_los.nrows() << ") differ.";
+    throw runtime_error(os.str());
+  }
+
+  ppaths.resize(nrays);
+
+  // Geometrical paths, identified as for ppath_calc_cached, are taken by
+  // direct calls of ppath_stepGeometric. This avoids the agenda overhead
+  // at each step and leaves the workspace untouched. Other methods of such
+  // agendas, e.g. Ignore(f_grid), are then not executed.
+  const bool geometric =
+      ppath_step_agenda.has_method("ppath_stepGeometric") &&
+      !ppath_step_agenda.has_method("ppath_stepRefractionBasic");
+
+  String fail_msg;
+  bool failed = false;
+
+  // We have to make a local copy of the Workspace and the agendas because
+  // only non-reference types can be declared firstprivate in OpenMP
+  Workspace l_ws(ws);
+  Agenda l_ppath_step_agenda(ppath_step_agenda);
+
+#pragma omp parallel for schedule(dynamic) if (!arts_omp_in_parallel() && \
+                                               nrays > 1)                 \
+    firstprivate(l_ws, l_ppath_step_agenda)
+  for (Index i = 0; i < nrays; i++) {
+    if (failed) continue;
+
+    try {
+      const Vector pos = rte_pos(i, joker);
+      const Vector los = rte_los(i, joker);
+
+      if (geometric) {
+        ppath_calc_stepping(
+            ppaths[i],
+            [&](Ppath& ppath_step) {
+              ppath_stepGeometric(ppath_step,
+                                  atmosphere_dim,
+                                  lat_grid,
+                                  lon_grid,
+                                  z_field,
+                                  refellipsoid,
+                                  z_surface,
+                                  ppath_lmax,
+                                  verbosity);
+            },
+            atmosphere_dim,
+            p_grid,
+            lat_grid,
+            lon_grid,
+            z_field,
+            refellipsoid,
+            z_surface,
+            cloudbox_on,
+            cloudbox_limits,
+            pos,
+            los,
+            ppath_inside_cloudbox_do,
+            verbosity);
+      } else {
+        ppath_calc(l_ws,
+                   ppaths[i],
+                   l_ppath_step_agenda,
+                   atmosphere_dim,
+                   p_grid,
+                   lat_grid,
+                   lon_grid,
+                   z_field,
+                   f_grid,
+                   refellipsoid,
+                   z_surface,
+                   cloudbox_on,
+                   cloudbox_limits,
+                   pos,
+                   los,
+                   ppath_lmax,
+                   ppath_lraytrace,
+                   ppath_inside_cloudbox_do,
+                   verbosity);
+      }
+    } catch (const std::exception& e) {
+#pragma omp critical(ppath_calc_batch_fail)
+      {
+        failed = true;
+        ostringstream os;
+        os << "Path calculation failed for ray " << i << ":\n" << e.what();
+        fail_msg = os.str();
+      }
+    }
+  }
+
+  if (failed) throw runtime_error(fail_msg);
+}
 
+
+/*===========================================================================
+  === Geometry-keyed cache of propagation paths
+  ===========================================================================*/
+
+namespace {
+
+/** The geometry of an atmosphere and the propagation paths cached for it.
+
+    The geometry is a full copy of the input, and paths are keyed on the
+    exact values of rte_pos, rte_los, ppath_lmax, ppath_lraytrace and
+    ppath_inside_cloudbox_do. That is, there is no hashing and a hit
+    requires equal input.
+*/
+struct PpathCacheAtmosphere {
+  Index atmosphere_dim;
+  Vector p_grid;
+  Vector lat_grid;
+  Vector lon_grid;
+  Tensor3 z_field;
+  Vector refellipsoid;
+  Matrix z_surface;
+  Index cloudbox_on;
+  ArrayOfIndex cloudbox_limits;
+  std::map<std::vector<Numeric>, Ppath> paths;
+};
+
+typedef std::shared_ptr<PpathCacheAtmosphere> PpathCacheAtmospherePtr;
+
+/** Geometry variables pinned by a PpathCacheScope.
+
+    The variables are identified by their addresses. The atmosphere is
+    resolved at the first use inside the scope.
+*/
+struct PpathCachePin {
+  Index id;
+  const Index* atmosphere_dim;
+  const Vector* p_grid;
+  const Vector* lat_grid;
+  const Vector* lon_grid;
+  const Tensor3* z_field;
+  const Vector* refellipsoid;
+  const Matrix* z_surface;
+  const Index* cloudbox_on;
+  const ArrayOfIndex* cloudbox_limits;
+  PpathCacheAtmospherePtr atmosphere;
+};
+
+//! All state of the cache, only to be accessed inside critical(ppath_cache)
+struct PpathCache {
+  std::list<PpathCacheAtmospherePtr> atmospheres;
+  std::list<PpathCachePin> pins;
+  std::multiset<Index> activations;
+  Index next_pin_id = 0;
+  Index npaths = 0;
+  Index hits = 0;
+  Index misses = 0;
+  bool used_by_user = false;
+
+  //! Removes all paths, and all atmospheres not referenced elsewhere
+  void clear() {
+    for (auto it = atmospheres.begin(); it != atmospheres.end();) {
+      (*it)->paths.clear();
+      if (it->use_count() == 1)
+        it = atmospheres.erase(it);
+      else
+        ++it;
+    }
+    npaths = 0;
+  }
+};
+
+PpathCache& ppath_cache() {
+  static PpathCache cache;
+  return cache;
+}
+
+//! Exact comparison of two vectors
+bool ppath_cache_equal(ConstVectorView a, ConstVectorView b) {
+  if (a.nelem() != b.nelem()) return false;
+  for (Index i = 0; i < a.nelem(); i++)
+    if (a[i] != b[i]) return false;
+  return true;
+}
+
+//! Exact comparison of two matrices
+bool ppath_cache_equal(ConstMatrixView a, ConstMatrixView b) {
+  if (a.nrows() != b.nrows() || a.ncols() != b.ncols()) return false;
+  for (Index r = 0; r < a.nrows(); r++)
+    if (!ppath_cache_equal(a(r, joker), b(r, joker))) return false;
+  return true;
+}
+
+//! Exact comparison of two tensors
+bool ppath_cache_equal(ConstTensor3View a, ConstTensor3View b) {
+  if (a.npages() != b.npages()) return false;
+  for (Index p = 0; p < a.npages(); p++)
+    if (!ppath_cache_equal(a(p, joker, joker), b(p, joker, joker)))
+      return false;
+  return true;
+}
+
+/** Finds the cached atmosphere with the given geometry.
+
+    The geometry is compared in full, and a copy of it is added to the
+    cache if it is not found.
+*/
+PpathCacheAtmospherePtr ppath_cache_atmosphere(
+    PpathCache& cache,
+    const Index& atmosphere_dim,
+    const Vector& p_grid,
+    const Vector& lat_grid,
+    const Vector& lon_grid,
+    const Tensor3& z_field,
+    const Vector& refellipsoid,
+    const Matrix& z_surface,
+    const Index& cloudbox_on,
+    const ArrayOfIndex& cloudbox_limits,
+    const Index& cache_size) {
+  for (const auto& atm : cache.atmospheres) {
+    if (atm->atmosphere_dim == atmosphere_dim &&
+        atm->cloudbox_on == cloudbox_on &&
+        (!cloudbox_on || atm->cloudbox_limits == cloudbox_limits) &&
+        ppath_cache_equal(atm->p_grid, p_grid) &&
+        ppath_cache_equal(atm->lat_grid, lat_grid) &&
+        ppath_cache_equal(atm->lon_grid, lon_grid) &&
+        ppath_cache_equal(atm->refellipsoid, refellipsoid) &&
+        ppath_cache_equal(atm->z_surface, z_surface) &&
+        ppath_cache_equal(atm->z_field, z_field))
+      return atm;
+  }
+
+  // Each atmosphere holds a copy of z_field, so they count against the
+  // cache size as well
+  if (Index(cache.atmospheres.size()) >= cache_size) cache.clear();
+
+  auto atm = std::make_shared<PpathCacheAtmosphere>();
+  atm->atmosphere_dim = atmosphere_dim;
+  atm->p_grid = p_grid;
+  atm->lat_grid = lat_grid;
+  atm->lon_grid = lon_grid;
+  atm->z_field = z_field;
+  atm->refellipsoid = refellipsoid;
+  atm->z_surface = z_surface;
+  atm->cloudbox_on = cloudbox_on;
+  if (cloudbox_on) atm->cloudbox_limits = cloudbox_limits;
+  cache.atmospheres.push_back(atm);
+  return atm;
+}
+
+}  // namespace
+
+PpathCacheScope::PpathCacheScope(Workspace& ws) : mid(-1) {
+  // The ids never change, look them up only once
+  static const Index wsv_ids[] = {get_wsv_id("atmosphere_dim"),
+                                  get_wsv_id("p_grid"),
+                                  get_wsv_id("lat_grid"),
+                                  get_wsv_id("lon_grid"),
+                                  get_wsv_id("z_field"),
+                                  get_wsv_id("refellipsoid"),
+                                  get_wsv_id("z_surface"),
+                                  get_wsv_id("cloudbox_on"),
+                                  get_wsv_id("cloudbox_limits")};
+
+  for (const Index id : wsv_ids)
+    if (!ws.is_initialized(id)) return;
+
+  PpathCachePin pin;
+  pin.atmosphere_dim = (const Index*)ws[wsv_ids[0]];
+  pin.p_grid = (const Vector*)ws[wsv_ids[1]];
+  pin.lat_grid = (const Vector*)ws[wsv_ids[2]];
+  pin.lon_grid = (const Vector*)ws[wsv_ids[3]];
+  pin.z_field = (const Tensor3*)ws[wsv_ids[4]];
+  pin.refellipsoid = (const Vector*)ws[wsv_ids[5]];
+  pin.z_surface = (const Matrix*)ws[wsv_ids[6]];
+  pin.cloudbox_on = (const Index*)ws[wsv_ids[7]];
+  pin.cloudbox_limits = (const ArrayOfIndex*)ws[wsv_ids[8]];
+
+#pragma omp critical(ppath_cache)
+  {
+    PpathCache& cache = ppath_cache();
+    pin.id = mid = cache.next_pin_id++;
+    cache.pins.push_back(pin);
+  }
+}
+
+PpathCacheScope::~PpathCacheScope() {
+  if (mid < 0) return;
+#pragma omp critical(ppath_cache)
+  {
+    PpathCache& cache = ppath_cache();
+    cache.pins.remove_if(
+        [this](const PpathCachePin& pin) { return pin.id == mid; });
+  }
+}
+
+PpathCacheActivation::PpathCacheActivation(const Index& cache_size)
+    : msize(cache_size) {
+#pragma omp critical(ppath_cache)
+  ppath_cache().activations.insert(msize);
+}
+
+PpathCacheActivation::~PpathCacheActivation() {
+#pragma omp critical(ppath_cache)
+  {
+    PpathCache& cache = ppath_cache();
+    cache.activations.erase(cache.activations.find(msize));
+    // Paths only cached on behalf of activations are not kept
+    if (cache.activations.empty() && !cache.used_by_user) cache.clear();
+  }
+}
+
+void ppath_calc_cached(Workspace& ws,
+                       Ppath& ppath,
+                       const Agenda& ppath_step_agenda,
+                       const Index& atmosphere_dim,
+                       const Vector& p_grid,
+                       const Vector& lat_grid,
+                       const Vector& lon_grid,
+                       const Tensor3& z_field,
+                       const Vector& f_grid,
+                       const Vector& refellipsoid,
+                       const Matrix& z_surface,
+                       const Index& cloudbox_on,
+                       const ArrayOfIndex& cloudbox_limits,
+                       const Vector& rte_pos,
+                       const Vector& rte_los,
+                       const Numeric& ppath_lmax,
+                       const Numeric& ppath_lraytrace,
+                       const bool& ppath_inside_cloudbox_do,
+                       const Index& cache_size,
+                       const Verbosity& verbosity) {
+  Index size = cache_size;
+  if (cache_size <= 0) {
+#pragma omp critical(ppath_cache)
+    {
+      const PpathCache& cache = ppath_cache();
+      if (!cache.activations.empty()) size = *cache.activations.rbegin();
+    }
+  }
+
+  // Refracted paths depend on the atmospheric state and the frequencies
+  // through refr_index_air_agenda, which is not covered by the key.
+  // Such paths are never cached.
+  if (size <= 0 || !ppath_step_agenda.has_method("ppath_stepGeometric") ||
+      ppath_step_agenda.has_method("ppath_stepRefractionBasic")) {
+    ppath_calc(ws,
+               ppath,
+               ppath_step_agenda,
+               atmosphere_dim,
+               p_grid,
+               lat_grid,
+               lon_grid,
+               z_field,
+               f_grid,
+               refellipsoid,
+               z_surface,
+               cloudbox_on,
+               cloudbox_limits,
+               rte_pos,
+               rte_los,
+               ppath_lmax,
+               ppath_lraytrace,
+               ppath_inside_cloudbox_do,
+               verbosity);
+    return;
+  }
+
+  // NaN never equals anything, so use the lengths to separate the parts
+  std::vector<Numeric> key;
+  key.reserve(rte_pos.nelem() + rte_los.nelem() + 5);
+  key.push_back(Numeric(rte_pos.nelem()));
+  for (Index i = 0; i < rte_pos.nelem(); i++) key.push_back(rte_pos[i]);
+  key.push_back(Numeric(rte_los.nelem()));
+  for (Index i = 0; i < rte_los.nelem(); i++) key.push_back(rte_los[i]);
+  key.push_back(ppath_lmax);
+  key.push_back(ppath_lraytrace);
+  key.push_back(ppath_inside_cloudbox_do);
+
+  PpathCacheAtmospherePtr atm;
+  bool found = false;
+#pragma omp critical(ppath_cache)
+  {
+    PpathCache& cache = ppath_cache();
+    if (cache_size > 0) cache.used_by_user = true;
+
+    // Variables pinned by a scope can not change while the scope exists,
+    // and their atmosphere is only resolved once
+    PpathCachePin* pin = nullptr;
+    for (auto& p : cache.pins) {
+      if (p.atmosphere_dim == &atmosphere_dim && p.p_grid == &p_grid &&
+          p.lat_grid == &lat_grid && p.lon_grid == &lon_grid &&
+          p.z_field == &z_field && p.refellipsoid == &refellipsoid &&
+          p.z_surface == &z_surface && p.cloudbox_on == &cloudbox_on &&
+          p.cloudbox_limits == &cloudbox_limits) {
+        pin = &p;
+        break;
+      }
+    }
+    if (pin && pin->atmosphere) {
+      atm = pin->atmosphere;
+    } else {
+      atm = ppath_cache_atmosphere(cache,
+                                   atmosphere_dim,
+                                   p_grid,
+                                   lat_grid,
+                                   lon_grid,
+                                   z_field,
+                                   refellipsoid,
+                                   z_surface,
+                                   cloudbox_on,
+                                   cloudbox_limits,
+                                   size);
+      if (pin) pin->atmosphere = atm;
+    }
+
+    const auto it = atm->paths.find(key);
+    if (it != atm->paths.end()) {
+      ppath = it->second;
+      found = true;
+      cache.hits++;
+    } else {
+      cache.misses++;
+    }
+  }
+  if (found) return;
+
+  ppath_calc(ws,
+             ppath,
+             ppath_step_agenda,
+             atmosphere_dim,
+             p_grid,
+             lat_grid,
+             lon_grid,
+             z_field,
+             f_grid,
+             refellipsoid,
+             z_surface,
+             cloudbox_on,
+             cloudbox_limits,
+             rte_pos,
+             rte_los,
+             ppath_lmax,
+             ppath_lraytrace,
+             ppath_inside_cloudbox_do,
+             verbosity);
+
+#pragma omp critical(ppath_cache)
+  {
+    PpathCache& cache = ppath_cache();
+    // Simplest possible eviction: start over when the cache is full
+    if (cache.npaths >= size) cache.clear();
+    if (atm->paths.emplace(key, ppath).second) cache.npaths++;
+  }
+}
+
+void ppath_cache_clear() {
+#pragma omp critical(ppath_cache)
+  {
+    PpathCache& cache = ppath_cache();
+    cache.clear();
+    cache.hits = 0;
+    cache.misses = 0;
+    cache.used_by_user = false;
+  }
+}
+
+void ppath_cache_stats(Index& size, Index& hits, Index& misses) {
+#pragma omp critical(ppath_cache)
+  {
+    const PpathCache& cache = ppath_cache();
+    size = cache.npaths;
+    hits = cache.hits;
+    misses = cache.misses;
+  }
+}
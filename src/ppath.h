@@ -440,6 +440,136 @@ void ppath_calc(Workspace& ws,
                 const bool& ppath_inside_cloudbox_do,
                 const Verbosity& verbosity);
 
+/** Propagation paths for many rays through the same atmosphere.
+
+   The rays are handled in parallel. If *ppath_step_agenda* contains
+   ppath_stepGeometric, and not ppath_stepRefractionBasic, the path steps
+   are taken by direct calls of the geometrical step functions, without
+   executing the agenda and without any copying of the workspace. Otherwise
+   each ray is handled by ppath_calc, using a private workspace copy.
+
+   @param[in] ws                 Current Workspace
+   @param[out] ppaths            The propagation paths, one per ray.
+   @param[in] rte_pos            Sensor positions, one row per ray.
+   @param[in] rte_los            Line-of-sights, one row per ray.
+
+   For remaining arguments, see ppath_calc.
+ */
+void ppath_calc_batch(Workspace& ws,
+                      ArrayOfPpath& ppaths,
+                      const Agenda& ppath_step_agenda,
+                      const Index& atmosphere_dim,
+                      const Vector& p_grid,
+                      const Vector& lat_grid,
+                      const Vector& lon_grid,
+                      const Tensor3& z_field,
+                      const Vector& f_grid,
+                      const Vector& refellipsoid,
+                      const Matrix& z_surface,
+                      const Index& cloudbox_on,
+                      const ArrayOfIndex& cloudbox_limits,
+                      ConstMatrixView rte_pos,
+                      ConstMatrixView rte_los,
+                      const Numeric& ppath_lmax,
+                      const Numeric& ppath_lraytrace,
+                      const bool& ppath_inside_cloudbox_do,
+                      const Verbosity& verbosity);
+
+/** As ppath_calc, but with a geometry-keyed cache.
+
+   Propagation paths are stored in a process-wide cache. Paths are grouped
+   by the atmospheric geometry (the atmospheric grids, z_field,
+   refellipsoid, z_surface and the cloud box settings), of which a copy is
+   kept, and are inside such a group keyed on rte_pos, rte_los, ppath_lmax
+   and ppath_lraytrace. All keys are compared exactly, a path can then be
+   reused across frequency batches, iterations and batch cases as long as
+   the geometry is unchanged. A changed geometry gives a new group, so no
+   explicit invalidation is needed.
+
+   Comparing the geometry is of the cost of a copy of z_field. If the
+   geometry variables are pinned by a PpathCacheScope, this is done only
+   once per scope.
+
+   Only geometrical paths are cached. If *ppath_step_agenda* does not
+   contain ppath_stepGeometric, or contains ppath_stepRefractionBasic, the
+   function falls back to ppath_calc.
+
+   @param[in] cache_size  Maximum number of cached paths. The cache is
+                          emptied when full. 0 deactivates the cache,
+                          unless a PpathCacheActivation exists.
+
+   For remaining arguments, see ppath_calc.
+ */
+void ppath_calc_cached(Workspace& ws,
+                       Ppath& ppath,
+                       const Agenda& ppath_step_agenda,
+                       const Index& atmosphere_dim,
+                       const Vector& p_grid,
+                       const Vector& lat_grid,
+                       const Vector& lon_grid,
+                       const Tensor3& z_field,
+                       const Vector& f_grid,
+                       const Vector& refellipsoid,
+                       const Matrix& z_surface,
+                       const Index& cloudbox_on,
+                       const ArrayOfIndex& cloudbox_limits,
+                       const Vector& rte_pos,
+                       const Vector& rte_los,
+                       const Numeric& ppath_lmax,
+                       const Numeric& ppath_lraytrace,
+                       const bool& ppath_inside_cloudbox_do,
+                       const Index& cache_size,
+                       const Verbosity& verbosity);
+
+/** Pins the geometry variables of a workspace for ppath_calc_cached.
+
+   Calls of ppath_calc_cached with the very same variable objects (the
+   atmospheric grids, z_field, refellipsoid, z_surface and the cloud box
+   settings found in *ws* when the scope was created) look up their
+   geometry only at the first call. The variables must not be modified
+   while the scope exists, which holds for calculations inside agendas,
+   where changed variables are duplicated.
+ */
+class PpathCacheScope {
+ public:
+  explicit PpathCacheScope(Workspace& ws);
+  PpathCacheScope(const PpathCacheScope&) = delete;
+  PpathCacheScope& operator=(const PpathCacheScope&) = delete;
+  ~PpathCacheScope();
+
+ private:
+  Index mid;
+};
+
+/** Activates the cache of ppath_calc_cached while the object exists.
+
+   Paths are cached with at least the given size also if the cache_size
+   argument of ppath_calc_cached is 0. For methods repeating calculations
+   where the geometry mostly is unchanged. Paths cached only because of an
+   activation are removed when the last activation ends.
+ */
+class PpathCacheActivation {
+ public:
+  explicit PpathCacheActivation(const Index& cache_size);
+  PpathCacheActivation(const PpathCacheActivation&) = delete;
+  PpathCacheActivation& operator=(const PpathCacheActivation&) = delete;
+  ~PpathCacheActivation();
+
+ private:
+  Index msize;
+};
+
+/** Empties the cache of ppath_calc_cached and resets its statistics. */
+void ppath_cache_clear();
+
+/** Returns the size and hit statistics of the cache of ppath_calc_cached.
+
+   @param[out] size    Number of cached paths.
+   @param[out] hits    Number of lookups served from the cache.
+   @param[out] misses  Number of lookups that required a path calculation.
+ */
+void ppath_cache_stats(Index& size, Index& hits, Index& misses);
+
 /** Copy the content in ppath2 to ppath1.
 
    The ppath1 structure must be allocated before calling the function. The
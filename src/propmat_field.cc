@@ -28,6 +28,7 @@
 */
 
 #include "propmat_field.h"
+#include "arts_omp.h"
 #include "rte.h"
 #include "special_interp.h"
 #include "transmissionmatrix.h"
@@ -55,8 +56,6 @@ void field_of_propagation(Workspace& ws,
   if (nq)
     throw std::runtime_error(
         "Does not support Jacobian calculations at this time");
-  if (stokes_dim not_eq 1)
-    throw std::runtime_error("Only for stokes_dim 1 at this time.");
 
   // Compute variables
   const Vector mag_field = Vector(3, 0);
@@ -119,6 +118,96 @@ FieldOfTransmissionMatrix transmat_field_calc_from_propmat_field(
   return transmat_field;
 }
 
+namespace {
+/** Non-zero interpolation corners along one dimension of a field */
+struct FieldCorners {
+  Index n;
+  size_t idx[2];
+  Numeric w[2];
+};
+
+FieldCorners field_corners(const ArrayOfGridPos& gp,
+                           const bool active,
+                           const Index ip) {
+  FieldCorners c{0, {0, 0}, {0, 0}};
+  if (not active) {
+    c.n = 1;
+    c.w[0] = 1;
+    return c;
+  }
+
+  const GridPos& g = gp[ip];
+  if (g.fd[1] not_eq 0) {
+    c.idx[c.n] = g.idx;
+    c.w[c.n] = g.fd[1];
+    c.n++;
+  }
+  if (g.fd[0] not_eq 0) {
+    c.idx[c.n] = g.idx + 1;
+    c.w[c.n] = g.fd[0];
+    c.n++;
+  }
+  return c;
+}
+
+template <class base>
+void interp_field_to_ppath(Array<base>& x,
+                           const Field3D<base>& field,
+                           const Ppath& ppath) {
+  x.resize(ppath.np);
+  for (Index ip = 0; ip < ppath.np; ip++) {
+    const FieldCorners cp = field_corners(ppath.gp_p, true, ip);
+    const FieldCorners cl = field_corners(ppath.gp_lat, ppath.dim > 1, ip);
+    const FieldCorners cc = field_corners(ppath.gp_lon, ppath.dim > 2, ip);
+
+    bool first = true;
+    for (Index a = 0; a < cp.n; a++) {
+      for (Index b = 0; b < cl.n; b++) {
+        for (Index c = 0; c < cc.n; c++) {
+          const Numeric w = cp.w[a] * cl.w[b] * cc.w[c];
+          const base& y = field(cp.idx[a], cl.idx[b], cc.idx[c]);
+          if (first) {
+            x[ip] = y;
+            x[ip] *= w;
+            first = false;
+          } else {
+            x[ip].MultiplyAndAdd(w, y);
+          }
+        }
+      }
+    }
+  }
+}
+}  // namespace
+
+void interp_propmat_field_to_ppath(
+    ArrayOfPropagationMatrix& ppath_K,
+    ArrayOfStokesVector& ppath_a,
+    ArrayOfStokesVector& ppath_S,
+    Vector& ppath_t,
+    const FieldOfPropagationMatrix& propmat_field,
+    const FieldOfStokesVector& absorption_field,
+    const FieldOfStokesVector& additional_source_field,
+    const Tensor3& t_field,
+    const Ppath& ppath) {
+  if (ppath.dim > 1 and propmat_field.nrows() < 2)
+    throw std::runtime_error(
+        "The propagation matrix field has no latitude dimension "
+        "but the propagation path is not 1D");
+  if (ppath.dim > 2 and propmat_field.ncols() < 2)
+    throw std::runtime_error(
+        "The propagation matrix field has no longitude dimension "
+        "but the propagation path is not 3D");
+
+  interp_field_to_ppath(ppath_K, propmat_field, ppath);
+  interp_field_to_ppath(ppath_a, absorption_field, ppath);
+  interp_field_to_ppath(ppath_S, additional_source_field, ppath);
+
+  ppath_t.resize(ppath.np);
+  interp_atmfield_by_gp(
+      ppath_t, ppath.dim, t_field, ppath.gp_p, ppath.gp_lat, ppath.gp_lon);
+}
+
 void emission_from_propmat_field(
     Workspace& ws,
     ArrayOfRadiationVector& lvl_rad,
@@ -144,18 +233,27 @@ void emission_from_propmat_field(
   const Index ns = propmat_field(0, 0, 0).StokesDimensions();
   const Index np = ppath.np;
 
-  // Current limitations
-  if (ns not_eq 1) throw std::runtime_error("Only for stokes_dim 1");
-  if (ppath.dim not_eq 1) throw std::runtime_error("Only for atmosphere_dim 1");
-
   // Size of compute variables
   lvl_rad = ArrayOfRadiationVector(np, RadiationVector(nf, ns));
   src_rad = ArrayOfRadiationVector(np, RadiationVector(nf, ns));
   lyr_tra = ArrayOfTransmissionMatrix(np, TransmissionMatrix(nf, ns));
 
+  // Radiative properties of all ppath points in one go
+  ArrayOfPropagationMatrix ppath_K;
+  ArrayOfStokesVector ppath_a, ppath_S;
+  Vector ppath_t;
+  interp_propmat_field_to_ppath(ppath_K,
+                                ppath_a,
+                                ppath_S,
+                                ppath_t,
+                                propmat_field,
+                                absorption_field,
+                                additional_source_field,
+                                t_field,
+                                ppath);
+
   // Size radiative variables always used
   Vector B(nf);
-  PropagationMatrix K_this(nf, ns), K_past(nf, ns);
 
   // Temporary empty variables to fit available function handles
   Vector vtmp(0);
@@ -168,18 +266,14 @@ void emission_from_propmat_field(
 
   // Loop ppath points and determine radiative properties
   for (Index ip = 0; ip < np; ip++) {
-    get_stepwise_blackbody_radiation(
-        B, vtmp, f_grid, interp_atmfield_by_gp(1, t_field, ppath.gp_p[ip]), 0);
-    K_this = propmat_field(ppath.gp_p[ip]);
-    const StokesVector S(additional_source_field(ppath.gp_p[ip]));
-    const StokesVector a(absorption_field(ppath.gp_p[ip]));
+    get_stepwise_blackbody_radiation(B, vtmp, f_grid, ppath_t[ip], 0);
 
     if (ip)
       stepwise_transmission(lyr_tra[ip],
                             tmtmp,
                             tmtmp,
-                            K_past,
-                            K_this,
+                            ppath_K[ip - 1],
+                            ppath_K[ip],
                             pmtmp,
                             pmtmp,
                             ppath.lstep[ip - 1],
@@ -189,9 +283,9 @@ void emission_from_propmat_field(
 
     stepwise_source(src_rad[ip],
                     rvtmp,
-                    K_this,
-                    a,
-                    S,
+                    ppath_K[ip],
+                    ppath_a[ip],
+                    ppath_S[ip],
                     pmtmp,
                     svtmp,
                     svtmp,
@@ -199,8 +293,6 @@ void emission_from_propmat_field(
                     vtmp,
                     rqtmp,
                     0);
-
-    swap(K_past, K_this);
   }
 
   // In case of backwards RT necessary
@@ -218,10 +310,10 @@ void emission_from_propmat_field(
                        rqtmp,
                        ppath,
                        {0},
-                       1,
+                       ppath.dim,
                        nlte_field,
                        0,
-                       1,
+                       ns,
                        f_grid,
                        "1",
                        surface_props_data,
@@ -248,3 +340,80 @@ void emission_from_propmat_field(
                             tmtmp,
                             RadiativeTransferSolver::Emission);
 }
+
+void emission_from_propmat_field(
+    Workspace& ws,
+    const std::function<void(Index, const ArrayOfRadiationVector&)>& path_done,
+    const FieldOfPropagationMatrix& propmat_field,
+    const FieldOfStokesVector& absorption_field,
+    const FieldOfStokesVector& additional_source_field,
+    const Vector& f_grid,
+    const Tensor3& t_field,
+    const EnergyLevelMap& nlte_field,
+    const ArrayOfPpath& ppath_field,
+    const Agenda& iy_main_agenda,
+    const Agenda& iy_space_agenda,
+    const Agenda& iy_surface_agenda,
+    const Agenda& iy_cloudbox_agenda,
+    const Tensor3& surface_props_data,
+    const Verbosity& verbosity)
+{
+  const Index npaths = ppath_field.nelem();
+
+  Workspace l_ws(ws);
+  Agenda l_iy_main_agenda(iy_main_agenda);
+  Agenda l_iy_space_agenda(iy_space_agenda);
+  Agenda l_iy_surface_agenda(iy_surface_agenda);
+  Agenda l_iy_cloudbox_agenda(iy_cloudbox_agenda);
+
+  String fail_msg;
+  bool failed = false;
+
+#pragma omp parallel for if (not arts_omp_in_parallel())                \
+    schedule(guided) default(shared) firstprivate(l_ws,                \
+                                                  l_iy_main_agenda,    \
+                                                  l_iy_space_agenda,   \
+                                                  l_iy_surface_agenda, \
+                                                  l_iy_cloudbox_agenda)
+  for (Index i = 0; i < npaths; i++) {
+    if (failed) continue;
+
+    try {
+      thread_local ArrayOfRadiationVector lvl_rad;
+      thread_local ArrayOfRadiationVector src_rad;
+      thread_local ArrayOfTransmissionMatrix lyr_tra;
+      thread_local ArrayOfTransmissionMatrix tot_tra;
+
+      emission_from_propmat_field(l_ws,
+                                  lvl_rad,
+                                  src_rad,
+                                  lyr_tra,
+                                  tot_tra,
+                                  propmat_field,
+                                  absorption_field,
+                                  additional_source_field,
+                                  f_grid,
+                                  t_field,
+                                  nlte_field,
+                                  ppath_field[i],
+                                  l_iy_main_agenda,
+                                  l_iy_space_agenda,
+                                  l_iy_surface_agenda,
+                                  l_iy_cloudbox_agenda,
+                                  surface_props_data,
+                                  verbosity);
+
+      path_done(i, lvl_rad);
+    } catch (const std::exception& e) {
+      std::ostringstream os;
+      os << "Error for propagation path " << i << ":\n" << e.what();
+#pragma omp critical(emission_from_propmat_field_fail)
+      {
+        failed = true;
+        fail_msg = os.str();
+      }
+    }
+  }
+
+  if (failed) throw std::runtime_error(fail_msg);
+}
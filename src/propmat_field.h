@@ -30,8 +30,10 @@
 #ifndef PROPAGATION_FIELD_HEADER
 #define PROPAGATION_FIELD_HEADER
 
+#include <functional>
 #include "energylevelmap.h"
 #include "field.h"
+#include "ppath.h"
 #include "transmissionmatrix.h"
 
 typedef Field3D<TransmissionMatrix> FieldOfTransmissionMatrix;
@@ -77,12 +79,39 @@ void field_of_propagation(Workspace& ws,
 FieldOfTransmissionMatrix transmat_field_calc_from_propmat_field(
     const FieldOfPropagationMatrix& propmat_field, const Numeric& r = 1.0);
 
-/** Computes the radiation and transmission from fields of atmospheric propagation
+/** Interpolates the fields of radiative properties to a propagation path
  * 
- * Only for 1D atmospheres for now.
+ * All points of the path are treated in one pass, only visiting the
+ * field corners with non-zero interpolation weight.  Works for 1D, 2D and
+ * 3D paths as long as the fields have the matching dimensions.
+ * 
+ * @param[out] ppath_K Propagation matrix at each ppath point
+ * @param[out] ppath_a Absorption vector at each ppath point
+ * @param[out] ppath_S Additional source vector at each ppath point
+ * @param[out] ppath_t Temperature at each ppath point
+ * @param[in] propmat_field 3D field of propagation matrices
+ * @param[in] absorption_field A 3D field of absorption vectors
+ * @param[in] additional_source_field A 3D field of source vectors
+ * @param[in] t_field As WSV
+ * @param[in] ppath As WSV
+ */
+void interp_propmat_field_to_ppath(
+    ArrayOfPropagationMatrix& ppath_K,
+    ArrayOfStokesVector& ppath_a,
+    ArrayOfStokesVector& ppath_S,
+    Vector& ppath_t,
+    const FieldOfPropagationMatrix& propmat_field,
+    const FieldOfStokesVector& absorption_field,
+    const FieldOfStokesVector& additional_source_field,
+    const Tensor3& t_field,
+    const Ppath& ppath);
+
+/** Computes the radiation and transmission from fields of atmospheric propagation
  * 
  * Computes The forward simulations by interpolating the fields of
- * radiative properties to the selected propagation path.
+ * radiative properties to the selected propagation path.  The fields
+ * are not line-of-sight dependent, so polarization effects that depend
+ * on the direction of propagation (e.g., Zeeman) are not represented.
  * 
  * Not well-tested.
  * 
@@ -124,24 +153,50 @@ void emission_from_propmat_field(
     const Agenda& iy_cloudbox_agenda,
     const Tensor3& surface_props_data,
     const Verbosity& verbosity);
+
+/** Computes the radiation from fields of atmospheric propagation for many paths
+ * 
+ * Applies the single path version of emission_from_propmat_field to each
+ * propagation path of ppath_field.  The paths are distributed over the
+ * available threads, so the same fields can be reused for a large number of
+ * lines-of-sight at the cost of a single field calculation.
+ * 
+ * The level by level radiation of a path is handed to path_done as soon as
+ * the path is finished, and is not kept afterwards.  path_done is called by
+ * the thread that did the path, at the same time for different paths.
+ * 
+ * @param[in] ws A workspace
+ * @param[in] path_done Called with the path index and its level by level
+ * radiation
+ * @param[in] propmat_field 3D field of propagation matrices
+ * @param[in] absorption_field A 3D field of absorption vectors
+ * @param[in] additional_source_field A 3D field of source vectors
+ * @param[in] f_grid As WSV
+ * @param[in] t_field As WSV
+ * @param[in] nlte_field As WSV
+ * @param[in] ppath_field Propagation paths
+ * @param[in] iy_main_agenda As WSA
+ * @param[in] iy_space_agenda As WSA
+ * @param[in] iy_surface_agenda As WSA
+ * @param[in] iy_cloudbox_agenda As WSA
+ * @param[in] surface_props_data As WSV
+ * @param[in] verbosity Level of verbosity in underlying calls
+ */
 void emission_from_propmat_field(
-  Workspace& ws,
-  ArrayOfRadiationVector& lvl_rad,
-  ArrayOfRadiationVector& src_rad,
-  ArrayOfTransmissionMatrix& lyr_tra,
-  ArrayOfTransmissionMatrix& tot_tra,
-  const FieldOfPropagationMatrix& propmat_field,
-  const FieldOfStokesVector& absorption_field,
-  const FieldOfStokesVector& additional_source_field,
-  const Vector& f_grid,
-  const Tensor3& t_field,
-  const EnergyLevelMap& nlte_field,
-  const Ppath& ppath,
-  const Agenda& iy_main_agenda,
-  const Agenda& iy_space_agenda,
-  const Agenda& iy_surface_agenda,
-  const Agenda& iy_cloudbox_agenda,
-  const Tensor3& surface_props_data,
-  const Verbosity& verbosity);
+    Workspace& ws,
+    const std::function<void(Index, const ArrayOfRadiationVector&)>& path_done,
+    const FieldOfPropagationMatrix& propmat_field,
+    const FieldOfStokesVector& absorption_field,
+    const FieldOfStokesVector& additional_source_field,
+    const Vector& f_grid,
+    const Tensor3& t_field,
+    const EnergyLevelMap& nlte_field,
+    const ArrayOfPpath& ppath_field,
+    const Agenda& iy_main_agenda,
+    const Agenda& iy_space_agenda,
+    const Agenda& iy_surface_agenda,
+    const Agenda& iy_cloudbox_agenda,
+    const Tensor3& surface_props_data,
+    const Verbosity& verbosity);
 
 #endif  // PROPAGATION_FIELD_HEADER
@@ -34,8 +34,11 @@
 #ifdef ENABLE_RT4
 
 #include <complex.h>
+#include <cerrno>
 #include <cfloat>
+#include <cstring>
 #include <stdexcept>
+#include "arts_omp.h"
 #include "disort.h"
 #include "interpolation.h"
 #include "m_xml.h"
@@ -44,6 +47,15 @@
 #include "rt4.h"
 #include "rte.h"
 
+// RT4 can be run in forked worker processes where fork and shared memory
+// mappings are available
+#if defined(HAVE_UNISTD_H) && defined(HAVE_SYS_MMAN_H) && !defined(WINDOWS)
+#define RT4_PROCESS_POOL
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 using std::ostringstream;
 using std::runtime_error;
 
@@ -340,6 +352,145 @@ void get_rt4surf_props(  // Output
   }
 }
 
+namespace {
+
+//! RT4 input and output for one frequency
+struct Rt4Frequency {
+  //! Frequency index
+  Index f_index;
+  //! Number of single hemisphere angles of the RT4 call
+  Index nummu;
+  //! True if the number of streams was increased (and output must be
+  //! interpolated back to the original angles)
+  bool interp;
+  //! Wavelength [um]
+  Numeric wavelength;
+  Matrix groundreflec;
+  Tensor4 surfreflmat;
+  Matrix surfemisvec;
+  Vector gas_extinct;
+  Tensor6 extinct_matrix;
+  Tensor5 emis_vector;
+  Tensor6 scatter_matrix;
+  //! za_grid matching nummu, only set if interp is true
+  Vector za_grid;
+  Vector mu_values;
+  Tensor3 up_rad;
+  Tensor3 down_rad;
+};
+
+#ifdef RT4_PROCESS_POOL
+//! Runs RT4 for a batch of frequencies in forked worker processes
+/*!
+  One worker process is forked per frequency. The workers inherit the
+  prepared optical properties through the (copy-on-write) address space of
+  the parent. The RT4 output (mu_values, up_rad and down_rad) is written by
+  the workers directly into an anonymous shared memory mapping, and is
+  copied to the jobs when all workers have finished.
+
+  As each worker is a separate process, the global state of the Fortran
+  code is not shared and no locking is required.
+
+  \param[in,out] jobs     Prepared RT4 input. The output fields are set.
+  \param[in]     call_rt4 Function calling RT4 for one job.
+*/
+template <typename Rt4Call>
+void rt4_run_in_processes(Array<Rt4Frequency>& jobs, const Rt4Call& call_rt4) {
+  const Index njobs = jobs.nelem();
+
+  // Layout of shared memory: One status flag per job, followed by
+  // mu_values, up_rad and down_rad of each job
+  ArrayOfIndex offset(njobs + 1);
+  offset[0] = njobs;
+  for (Index i = 0; i < njobs; i++) {
+    offset[i + 1] = offset[i] + jobs[i].mu_values.nelem() +
+                    2 * jobs[i].up_rad.npages() * jobs[i].up_rad.nrows() *
+                        jobs[i].up_rad.ncols();
+  }
+  const size_t nbytes = sizeof(Numeric) * offset[njobs];
+
+  void* shm = mmap(nullptr,
+                   nbytes,
+                   PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_ANONYMOUS,
+                   -1,
+                   0);
+  if (shm == MAP_FAILED) {
+    throw runtime_error(
+        "Could not allocate shared memory for RT4 worker processes.");
+  }
+  Numeric* data = static_cast<Numeric*>(shm);
+
+  // Pointers to the output of each job in shared memory
+  auto mu_of = [&](Index i) { return data + offset[i]; };
+  auto up_of = [&](Index i) { return mu_of(i) + jobs[i].mu_values.nelem(); };
+  auto down_of = [&](Index i) {
+    return up_of(i) + jobs[i].up_rad.npages() * jobs[i].up_rad.nrows() *
+                          jobs[i].up_rad.ncols();
+  };
+
+  std::vector<pid_t> pids(njobs, -1);
+  for (Index i = 0; i < njobs; i++) {
+    data[i] = 0;
+    std::memcpy(mu_of(i),
+                jobs[i].mu_values.get_c_array(),
+                sizeof(Numeric) * jobs[i].mu_values.nelem());
+
+    pids[i] = fork();
+    if (pids[i] == 0) {
+      // Worker process: Solve and leave without running any destructors
+      // or exit handlers of the parent
+      call_rt4(jobs[i], mu_of(i), up_of(i), down_of(i));
+      data[i] = 1;
+      _exit(0);
+    } else if (pids[i] < 0) {
+      break;
+    }
+  }
+
+  ostringstream os;
+  for (Index i = 0; i < njobs; i++) {
+    if (pids[i] < 0) {
+      os << "Could not start RT4 worker process for f_index "
+         << jobs[i].f_index << ".\n";
+      continue;
+    }
+
+    int status;
+    while (waitpid(pids[i], &status, 0) < 0 && errno == EINTR) {
+    }
+
+    if (data[i] != 1) {
+      os << "RT4 worker process for f_index " << jobs[i].f_index
+         << " failed";
+      if (WIFEXITED(status))
+        os << " (exit status " << WEXITSTATUS(status) << ").\n";
+      else if (WIFSIGNALED(status))
+        os << " (terminated by signal " << WTERMSIG(status) << ").\n";
+      else
+        os << ".\n";
+      continue;
+    }
+
+    std::memcpy(jobs[i].mu_values.get_c_array(),
+                mu_of(i),
+                sizeof(Numeric) * jobs[i].mu_values.nelem());
+    std::memcpy(jobs[i].up_rad.get_c_array(),
+                up_of(i),
+                sizeof(Numeric) * (down_of(i) - up_of(i)));
+    std::memcpy(jobs[i].down_rad.get_c_array(),
+                down_of(i),
+                sizeof(Numeric) * (down_of(i) - up_of(i)));
+  }
+
+  munmap(shm, nbytes);
+
+  if (os.str().length()) throw runtime_error(os.str());
+}
+#endif /* RT4_PROCESS_POOL */
+
+}  // namespace
+
 void run_rt4(Workspace& ws,
              // Output
              Tensor7& cloudbox_field,
@@ -377,6 +528,7 @@ void run_rt4(Workspace& ws,
              const Index& pfct_aa_grid_size,
              const Numeric& pfct_threshold,
              const Numeric& max_delta_tau,
+             const Index& nprocesses,
              const Verbosity& verbosity) {
   // Create an atmosphere starting at z_surface
   Vector p, z, t;
@@ -491,47 +643,187 @@ void run_rt4(Workspace& ws,
     za_grid_orig = za_grid;
   }
 
+  // Up to nbatch frequencies are prepared, then solved (in parallel by
+  // forked worker processes if nbatch>1), and finally stored in
+  // cloudbox_field.
+  const Index nf = f_grid.nelem();
+  Index nbatch = 1;
+#ifdef RT4_PROCESS_POOL
+  if (nprocesses > 1 && !arts_omp_in_parallel()) nbatch = nprocesses;
+#else
+  if (nprocesses > 1) {
+    CREATE_OUT1;
+    out1 << "  Worker processes for RT4 are not supported on this system.\n"
+         << "  Running RT4 within the ARTS process.\n";
+  }
+#endif
+
+  // Call of RT4 for one frequency, with output written to mu, up and down
+  auto call_rt4 = [&](const Rt4Frequency& job,
+                      Numeric* mu,
+                      Numeric* up,
+                      Numeric* down) {
+    radtrano_(stokes_dim,
+              job.nummu,
+              nhza,
+              max_delta_tau,
+              quad_type.c_str(),
+              surface_skin_t,
+              ground_type.c_str(),
+              ground_albedo[job.f_index],
+              ground_index[job.f_index],
+              job.groundreflec.get_c_array(),
+              job.surfreflmat.get_c_array(),
+              job.surfemisvec.get_c_array(),
+              sky_temp,
+              job.wavelength,
+              num_layers,
+              height.get_c_array(),
+              temperatures.get_c_array(),
+              job.gas_extinct.get_c_array(),
+              num_scatlayers,
+              scatlayers.get_c_array(),
+              job.extinct_matrix.get_c_array(),
+              job.emis_vector.get_c_array(),
+              job.scatter_matrix.get_c_array(),
+              //noutlevels,
+              //outlevels.get_c_array(),
+              mu,
+              up,
+              down);
+  };
+
+  Array<Rt4Frequency> batch;
   Index nummu_new = 0;
-  // Loop over frequencies
-  for (Index f_index = 0; f_index < f_grid.nelem(); f_index++) {
-    // Wavelength [um]
-    Numeric wavelength;
-    wavelength = 1e6 * SPEED_OF_LIGHT / f_grid[f_index];
-
-    Matrix groundreflec = ground_reflec(f_index, joker, joker);
-    Tensor4 surfreflmat = surf_refl_mat(f_index, joker, joker, joker, joker);
-    Matrix surfemisvec = surf_emis_vec(f_index, joker, joker);
-    //Vector muvalues=mu_values;
-
-    // only update gas_extinct if there is any gas absorption at all (since
-    // vmr_field is not freq-dependent, gas_extinct will remain as above
-    // initialized (with 0) for all freqs, ie we can rely on that it wasn't
-    // changed).
-    if (vmr.ncols() > 0) {
-      gas_optpropCalc(ws,
-                      gas_extinct,
-                      propmat_clearsky_agenda,
-                      t[Range(0, num_layers + 1)],
-                      vmr(joker, Range(0, num_layers + 1)),
-                      p[Range(0, num_layers + 1)],
-                      f_grid[Range(f_index, 1)]);
-    }
+  for (Index f_start = 0; f_start < nf; f_start += nbatch) {
+    batch.resize(min(nbatch, nf - f_start));
 
-    Index pfct_failed = 0;
-    if (pndtot != 0) {
-      if (nummu_new < nummu) {
-        if (!auto_inc_nstreams)  // all freq calculated before. just copy
-                                 // here. but only if needed.
-        {
-          if (emis_vector_allf.nshelves() != 1) {
-            emis_vector =
-                emis_vector_allf(Range(f_index, 1), joker, joker, joker, joker);
-            extinct_matrix = extinct_matrix_allf(
-                Range(f_index, 1), joker, joker, joker, joker, joker);
+    //
+    // Prepare the RT4 input of each frequency of the batch
+    //
+    for (Index ib = 0; ib < batch.nelem(); ib++) {
+      const Index f_index = f_start + ib;
+      Rt4Frequency& job = batch[ib];
+      job.f_index = f_index;
+      job.interp = false;
+
+      // Wavelength [um]
+      job.wavelength = 1e6 * SPEED_OF_LIGHT / f_grid[f_index];
+
+      job.groundreflec = ground_reflec(f_index, joker, joker);
+      //Vector muvalues=mu_values;
+
+      // only update gas_extinct if there is any gas absorption at all (since
+      // vmr_field is not freq-dependent, gas_extinct will remain as above
+      // initialized (with 0) for all freqs, ie we can rely on that it wasn't
+      // changed).
+      if (vmr.ncols() > 0) {
+        gas_optpropCalc(ws,
+                        gas_extinct,
+                        propmat_clearsky_agenda,
+                        t[Range(0, num_layers + 1)],
+                        vmr(joker, Range(0, num_layers + 1)),
+                        p[Range(0, num_layers + 1)],
+                        f_grid[Range(f_index, 1)]);
+      }
+      job.gas_extinct = gas_extinct;
+
+      Index pfct_failed = 0;
+      if (pndtot != 0) {
+        if (nummu_new < nummu) {
+          if (!auto_inc_nstreams)  // all freq calculated before. just copy
+                                   // here. but only if needed.
+          {
+            if (emis_vector_allf.nshelves() != 1) {
+              emis_vector = emis_vector_allf(
+                  Range(f_index, 1), joker, joker, joker, joker);
+              extinct_matrix = extinct_matrix_allf(
+                  Range(f_index, 1), joker, joker, joker, joker, joker);
+            }
+          } else {
+            par_optpropCalc(emis_vector,
+                            extinct_matrix,
+                            //scatlayers,
+                            scat_data,
+                            za_grid,
+                            f_index,
+                            pnd,
+                            t[Range(0, num_layers + 1)],
+                            cboxlims,
+                            stokes_dim);
           }
+          sca_optpropCalc(scatter_matrix,
+                          pfct_failed,
+                          emis_vector(0, joker, joker, joker, joker),
+                          extinct_matrix(0, joker, joker, joker, joker, joker),
+                          f_index,
+                          scat_data,
+                          pnd,
+                          stokes_dim,
+                          za_grid,
+                          quad_weights,
+                          pfct_method,
+                          pfct_aa_grid_size,
+                          pfct_threshold,
+                          auto_inc_nstreams,
+                          verbosity);
         } else {
-          par_optpropCalc(emis_vector,
-                          extinct_matrix,
+          pfct_failed = 1;
+        }
+      }
+
+      if (!pfct_failed) {
+        job.nummu = nummu;
+        job.surfreflmat = surf_refl_mat(f_index, joker, joker, joker, joker);
+        job.surfemisvec = surf_emis_vec(f_index, joker, joker);
+        job.extinct_matrix = extinct_matrix;
+        job.emis_vector = emis_vector;
+        job.scatter_matrix = scatter_matrix;
+        job.mu_values = mu_values;
+
+      } else {  // if (auto_inc_nstreams)
+
+        if (nummu_new < nummu) nummu_new = nummu + 1;
+
+        Index nhstreams_new;
+        Vector quad_weights_new, aa_grid_new;
+        Tensor6 scatter_matrix_new;
+        Tensor6 extinct_matrix_new;
+        Tensor5 emis_vector_new;
+
+        while (pfct_failed && (2 * nummu_new) <= auto_inc_nstreams) {
+          // resize and recalc nstream-affected/determined variables:
+          //   - mu_values, quad_weights (resize & recalc)
+          nhstreams_new = nummu_new - nhza;
+          job.mu_values.resize(nummu_new);
+          job.mu_values = 0.;
+          quad_weights_new.resize(nummu_new);
+          quad_weights_new = 0.;
+          get_quad_angles(job.mu_values,
+                          quad_weights_new,
+                          za_grid,
+                          aa_grid_new,
+                          quad_type,
+                          nhstreams_new,
+                          nhza,
+                          nummu_new);
+
+          //   - resize & recalculate emis_vector, extinct_matrix (as input to scatter_matrix calc)
+          extinct_matrix_new.resize(
+              1, num_scatlayers, 2, nummu_new, stokes_dim, stokes_dim);
+          extinct_matrix_new = 0.;
+          emis_vector_new.resize(1, num_scatlayers, 2, nummu_new, stokes_dim);
+          emis_vector_new = 0.;
+          // FIXME: So far, outside-of-freq-loop calculated optprops will fall
+          // back to in-loop-calculated ones in case of auto-increasing stream
+          // numbers. There might be better options, but I (JM) couldn't come up
+          // with or decide for one so far (we could recalc over all freqs. but
+          // that would unnecessarily recalc lower-freq optprops, too, which are
+          // not needed anymore. which could likely take more time than we
+          // potentially safe through all-at-once temperature and direction
+          // interpolations.
+          par_optpropCalc(emis_vector_new,
+                          extinct_matrix_new,
                           //scatlayers,
                           scat_data,
                           za_grid,
@@ -540,160 +832,12 @@ void run_rt4(Workspace& ws,
                           t[Range(0, num_layers + 1)],
                           cboxlims,
                           stokes_dim);
-        }
-        sca_optpropCalc(scatter_matrix,
-                        pfct_failed,
-                        emis_vector(0, joker, joker, joker, joker),
-                        extinct_matrix(0, joker, joker, joker, joker, joker),
-                        f_index,
-                        scat_data,
-                        pnd,
-                        stokes_dim,
-                        za_grid,
-                        quad_weights,
-                        pfct_method,
-                        pfct_aa_grid_size,
-                        pfct_threshold,
-                        auto_inc_nstreams,
-                        verbosity);
-      } else {
-        pfct_failed = 1;
-      }
-    }
 
-    if (!pfct_failed) {
-#pragma omp critical(fortran_rt4)
-      {
-        // Call RT4
-        radtrano_(stokes_dim,
-                  nummu,
-                  nhza,
-                  max_delta_tau,
-                  quad_type.c_str(),
-                  surface_skin_t,
-                  ground_type.c_str(),
-                  ground_albedo[f_index],
-                  ground_index[f_index],
-                  groundreflec.get_c_array(),
-                  surfreflmat.get_c_array(),
-                  surfemisvec.get_c_array(),
-                  sky_temp,
-                  wavelength,
-                  num_layers,
-                  height.get_c_array(),
-                  temperatures.get_c_array(),
-                  gas_extinct.get_c_array(),
-                  num_scatlayers,
-                  scatlayers.get_c_array(),
-                  extinct_matrix.get_c_array(),
-                  emis_vector.get_c_array(),
-                  scatter_matrix.get_c_array(),
-                  //noutlevels,
-                  //outlevels.get_c_array(),
-                  mu_values.get_c_array(),
-                  up_rad.get_c_array(),
-                  down_rad.get_c_array());
-      }
-
-    } else {  // if (auto_inc_nstreams)
-
-      if (nummu_new < nummu) nummu_new = nummu + 1;
-
-      Index nhstreams_new;
-      Vector mu_values_new, quad_weights_new, aa_grid_new;
-      Tensor6 scatter_matrix_new;
-      Tensor6 extinct_matrix_new;
-      Tensor5 emis_vector_new;
-      Tensor4 surfreflmat_new;
-      Matrix surfemisvec_new;
-
-      while (pfct_failed && (2 * nummu_new) <= auto_inc_nstreams) {
-        // resize and recalc nstream-affected/determined variables:
-        //   - mu_values, quad_weights (resize & recalc)
-        nhstreams_new = nummu_new - nhza;
-        mu_values_new.resize(nummu_new);
-        mu_values_new = 0.;
-        quad_weights_new.resize(nummu_new);
-        quad_weights_new = 0.;
-        get_quad_angles(mu_values_new,
-                        quad_weights_new,
-                        za_grid,
-                        aa_grid_new,
-                        quad_type,
-                        nhstreams_new,
-                        nhza,
-                        nummu_new);
-
-        //   - resize & recalculate emis_vector, extinct_matrix (as input to scatter_matrix calc)
-        extinct_matrix_new.resize(
-            1, num_scatlayers, 2, nummu_new, stokes_dim, stokes_dim);
-        extinct_matrix_new = 0.;
-        emis_vector_new.resize(1, num_scatlayers, 2, nummu_new, stokes_dim);
-        emis_vector_new = 0.;
-        // FIXME: So far, outside-of-freq-loop calculated optprops will fall
-        // back to in-loop-calculated ones in case of auto-increasing stream
-        // numbers. There might be better options, but I (JM) couldn't come up
-        // with or decide for one so far (we could recalc over all freqs. but
-        // that would unnecessarily recalc lower-freq optprops, too, which are
-        // not needed anymore. which could likely take more time than we
-        // potentially safe through all-at-once temperature and direction
-        // interpolations.
-        par_optpropCalc(emis_vector_new,
-                        extinct_matrix_new,
-                        //scatlayers,
-                        scat_data,
-                        za_grid,
-                        f_index,
-                        pnd,
-                        t[Range(0, num_layers + 1)],
-                        cboxlims,
-                        stokes_dim);
-
-        //   - resize & recalc scatter_matrix
-        scatter_matrix_new.resize(
-            num_scatlayers, 4, nummu_new, stokes_dim, nummu_new, stokes_dim);
-        scatter_matrix_new = 0.;
-        pfct_failed = 0;
-        sca_optpropCalc(
-            scatter_matrix_new,
-            pfct_failed,
-            emis_vector_new(0, joker, joker, joker, joker),
-            extinct_matrix_new(0, joker, joker, joker, joker, joker),
-            f_index,
-            scat_data,
-            pnd,
-            stokes_dim,
-            za_grid,
-            quad_weights_new,
-            pfct_method,
-            pfct_aa_grid_size,
-            pfct_threshold,
-            auto_inc_nstreams,
-            verbosity);
-
-        if (pfct_failed) nummu_new = nummu_new + 1;
-      }
-
-      if (pfct_failed) {
-        nummu_new = nummu_new - 1;
-        ostringstream os;
-        os << "Could not increase nstreams sufficiently (current: "
-           << 2 * nummu_new << ")\n"
-           << "to satisfy scattering matrix norm at f[" << f_index
-           << "]=" << f_grid[f_index] * 1e-9 << " GHz.\n";
-        if (!robust) {
-          // couldn't find a nstreams within the limits of auto_inc_nstremas
-          // (aka max. nstreams) that satisfies the scattering matrix norm.
-          // Hence fail completely.
-          os << "Try higher maximum number of allowed streams (ie. higher"
-             << " auto_inc_nstreams than " << auto_inc_nstreams << ").";
-          throw runtime_error(os.str());
-        } else {
-          CREATE_OUT1;
-          os << "Continuing with nstreams=" << 2 * nummu_new
-             << ". Output for this frequency might be erroneous.";
-          out1 << os.str();
-          pfct_failed = -1;
+          //   - resize & recalc scatter_matrix
+          scatter_matrix_new.resize(
+              num_scatlayers, 4, nummu_new, stokes_dim, nummu_new, stokes_dim);
+          scatter_matrix_new = 0.;
+          pfct_failed = 0;
           sca_optpropCalc(
               scatter_matrix_new,
               pfct_failed,
@@ -708,142 +852,197 @@ void run_rt4(Workspace& ws,
               pfct_method,
               pfct_aa_grid_size,
               pfct_threshold,
-              0,
+              auto_inc_nstreams,
               verbosity);
+
+          if (pfct_failed) nummu_new = nummu_new + 1;
         }
-      }
 
-      // resize and calc remaining nstream-affected variables:
-      //   - in case of surface_rtprop_agenda driven surface: surfreflmat, surfemisvec
-      if (ground_type == "A")  // surface_rtprop_agenda driven surface
-      {
-        Tensor5 srm_new(1, nummu_new, stokes_dim, nummu_new, stokes_dim, 0.);
-        Tensor3 sev_new(1, nummu_new, stokes_dim, 0.);
-        surf_optpropCalc(ws,
-                         srm_new,
-                         sev_new,
-                         surface_rtprop_agenda,
-                         f_grid[Range(f_index, 1)],
-                         za_grid,
-                         mu_values_new,
-                         quad_weights_new,
-                         stokes_dim,
-                         surf_altitude);
-        surfreflmat_new = srm_new(0, joker, joker, joker, joker);
-        surfemisvec_new = sev_new(0, joker, joker);
+        if (pfct_failed) {
+          nummu_new = nummu_new - 1;
+          ostringstream os;
+          os << "Could not increase nstreams sufficiently (current: "
+             << 2 * nummu_new << ")\n"
+             << "to satisfy scattering matrix norm at f[" << f_index
+             << "]=" << f_grid[f_index] * 1e-9 << " GHz.\n";
+          if (!robust) {
+            // couldn't find a nstreams within the limits of auto_inc_nstremas
+            // (aka max. nstreams) that satisfies the scattering matrix norm.
+            // Hence fail completely.
+            os << "Try higher maximum number of allowed streams (ie. higher"
+               << " auto_inc_nstreams than " << auto_inc_nstreams << ").";
+            throw runtime_error(os.str());
+          } else {
+            CREATE_OUT1;
+            os << "Continuing with nstreams=" << 2 * nummu_new
+               << ". Output for this frequency might be erroneous.";
+            out1 << os.str();
+            pfct_failed = -1;
+            sca_optpropCalc(
+                scatter_matrix_new,
+                pfct_failed,
+                emis_vector_new(0, joker, joker, joker, joker),
+                extinct_matrix_new(0, joker, joker, joker, joker, joker),
+                f_index,
+                scat_data,
+                pnd,
+                stokes_dim,
+                za_grid,
+                quad_weights_new,
+                pfct_method,
+                pfct_aa_grid_size,
+                pfct_threshold,
+                0,
+                verbosity);
+          }
+        }
+
+        // resize and calc remaining nstream-affected variables:
+        //   - in case of surface_rtprop_agenda driven surface: surfreflmat, surfemisvec
+        job.surfreflmat.resize(0, 0, 0, 0);
+        job.surfemisvec.resize(0, 0);
+        if (ground_type == "A")  // surface_rtprop_agenda driven surface
+        {
+          Tensor5 srm_new(1, nummu_new, stokes_dim, nummu_new, stokes_dim, 0.);
+          Tensor3 sev_new(1, nummu_new, stokes_dim, 0.);
+          surf_optpropCalc(ws,
+                           srm_new,
+                           sev_new,
+                           surface_rtprop_agenda,
+                           f_grid[Range(f_index, 1)],
+                           za_grid,
+                           job.mu_values,
+                           quad_weights_new,
+                           stokes_dim,
+                           surf_altitude);
+          job.surfreflmat = srm_new(0, joker, joker, joker, joker);
+          job.surfemisvec = sev_new(0, joker, joker);
+        }
+
+        job.nummu = nummu_new;
+        job.interp = true;
+        job.extinct_matrix = extinct_matrix_new;
+        job.emis_vector = emis_vector_new;
+        job.scatter_matrix = scatter_matrix_new;
+
+        // keep the za_grid matching nummu_new for the back-interpolation
+        // and reconstruct za_grid
+        job.za_grid = za_grid;
+        za_grid = za_grid_orig;
       }
+
       //   - up/down_rad (resize only)
-      Tensor3 up_rad_new(num_layers + 1, nummu_new, stokes_dim, 0.);
-      Tensor3 down_rad_new(num_layers + 1, nummu_new, stokes_dim, 0.);
-      //
-      // run radtrano_
+      job.up_rad.resize(num_layers + 1, job.nummu, stokes_dim);
+      job.up_rad = 0.;
+      job.down_rad.resize(num_layers + 1, job.nummu, stokes_dim);
+      job.down_rad = 0.;
+    }
+
+    //
+    // Run RT4
+    //
+#ifdef RT4_PROCESS_POOL
+    if (batch.nelem() > 1) {
+      rt4_run_in_processes(batch, call_rt4);
+    } else
+#endif
+    {
+      for (auto& job : batch) {
 #pragma omp critical(fortran_rt4)
-      {
-        // Call RT4
-        radtrano_(stokes_dim,
-                  nummu_new,
-                  nhza,
-                  max_delta_tau,
-                  quad_type.c_str(),
-                  surface_skin_t,
-                  ground_type.c_str(),
-                  ground_albedo[f_index],
-                  ground_index[f_index],
-                  groundreflec.get_c_array(),
-                  surfreflmat_new.get_c_array(),
-                  surfemisvec_new.get_c_array(),
-                  sky_temp,
-                  wavelength,
-                  num_layers,
-                  height.get_c_array(),
-                  temperatures.get_c_array(),
-                  gas_extinct.get_c_array(),
-                  num_scatlayers,
-                  scatlayers.get_c_array(),
-                  extinct_matrix_new(0, joker, joker, joker, joker, joker)
-                      .get_c_array(),
-                  emis_vector_new(0, joker, joker, joker, joker).get_c_array(),
-                  scatter_matrix_new.get_c_array(),
-                  //noutlevels,
-                  //outlevels.get_c_array(),
-                  mu_values_new.get_c_array(),
-                  up_rad_new.get_c_array(),
-                  down_rad_new.get_c_array());
-      }
-      // back-interpolate nstream_new fields to nstreams
-      //   (possible to use iyCloudboxInterp agenda? nja, not really a good
-      //   idea. too much overhead there (checking, 3D+2ang interpol). rather
-      //   use interp_order as additional user parameter.
-      //   extrapol issues shouldn't occur as we go from finer to coarser
-      //   angular grid)
-      //   - loop over nummu:
-      //     - determine weights per ummu ang (should be valid for both up and
-      //       down)
-      //     - loop over num_layers and stokes_dim:
-      //       - apply weights
-      for (Index j = 0; j < nummu; j++) {
-        GridPosPoly gp_za;
-        if (cos_za_interp) {
-          gridpos_poly(
-              gp_za, mu_values_new, mu_values[j], za_interp_order, 0.5);
-        } else {
-          gridpos_poly(gp_za,
-                       za_grid[Range(0, nummu_new)],
-                       za_grid_orig[j],
-                       za_interp_order,
-                       0.5);
+        {
+          // Call RT4
+          call_rt4(job,
+                   job.mu_values.get_c_array(),
+                   job.up_rad.get_c_array(),
+                   job.down_rad.get_c_array());
         }
-        Vector itw(gp_za.idx.nelem());
-        interpweights(itw, gp_za);
-
-        for (Index k = 0; k < num_layers + 1; k++)
-          for (Index ist = 0; ist < stokes_dim; ist++) {
-            up_rad(k, j, ist) = interp(itw, up_rad_new(k, joker, ist), gp_za);
-            down_rad(k, j, ist) =
-                interp(itw, down_rad_new(k, joker, ist), gp_za);
-          }
       }
-
-      // reconstruct za_grid
-      za_grid = za_grid_orig;
     }
 
-    // RT4 rad output is in wavelength units, nominally in W/(m2 sr um), where
-    // wavelength input is required in um.
-    // FIXME: When using wavelength input in m, output should be in W/(m2 sr
-    // m). However, check this. So, at first we use wavelength in um. Then
-    // change and compare.
     //
-    // FIXME: if ever we allow the cloudbox to be not directly at the surface
-    // (at atm level #0, respectively), the assigning from up/down_rad to
-    // cloudbox_field needs to checked. there seems some offsetting going on
-    // (test example: TestDOIT.arts. if kept like below, cloudbox_field at
-    // top-of-cloudbox seems to actually be from somewhere within the
-    // cloud(box) indicated by downwelling being to high and downwelling
-    // exhibiting a non-zero polarisation signature (which it wouldn't with
-    // only scalar gas abs above).
+    // Store the result of each frequency in cloudbox_field
     //
-    Numeric rad_l2f = wavelength / f_grid[f_index];
-    // down/up_rad contain the radiances in order from slant (90deg) to steep
-    // (0 and 180deg, respectively) streams,then the possible extra angle(s).
-    // We need to resort them properly into cloudbox_field, such that order is
-    // from 0 to 180deg.
-    for (Index j = 0; j < nummu; j++) {
-      for (Index ist = 0; ist < stokes_dim; ist++) {
-        for (Index k = cboxlims[1] - cboxlims[0]; k >= 0; k--) {
-          cloudbox_field(f_index, k + ncboxremoved, 0, 0, nummu + j, 0, ist) =
-              up_rad(num_layers - k, j, ist) * rad_l2f;
-          cloudbox_field(
-              f_index, k + ncboxremoved, 0, 0, nummu - 1 - j, 0, ist) =
-              down_rad(num_layers - k, j, ist) * rad_l2f;
+    for (const auto& job : batch) {
+      const Index f_index = job.f_index;
+
+      if (!job.interp) {
+        mu_values = job.mu_values;
+        up_rad = job.up_rad;
+        down_rad = job.down_rad;
+      } else {
+        // back-interpolate nstream_new fields to nstreams
+        //   (possible to use iyCloudboxInterp agenda? nja, not really a good
+        //   idea. too much overhead there (checking, 3D+2ang interpol). rather
+        //   use interp_order as additional user parameter.
+        //   extrapol issues shouldn't occur as we go from finer to coarser
+        //   angular grid)
+        //   - loop over nummu:
+        //     - determine weights per ummu ang (should be valid for both up and
+        //       down)
+        //     - loop over num_layers and stokes_dim:
+        //       - apply weights
+        for (Index j = 0; j < nummu; j++) {
+          GridPosPoly gp_za;
+          if (cos_za_interp) {
+            gridpos_poly(
+                gp_za, job.mu_values, mu_values[j], za_interp_order, 0.5);
+          } else {
+            gridpos_poly(gp_za,
+                         job.za_grid[Range(0, job.nummu)],
+                         za_grid_orig[j],
+                         za_interp_order,
+                         0.5);
+          }
+          Vector itw(gp_za.idx.nelem());
+          interpweights(itw, gp_za);
+
+          for (Index k = 0; k < num_layers + 1; k++)
+            for (Index ist = 0; ist < stokes_dim; ist++) {
+              up_rad(k, j, ist) =
+                  interp(itw, job.up_rad(k, joker, ist), gp_za);
+              down_rad(k, j, ist) =
+                  interp(itw, job.down_rad(k, joker, ist), gp_za);
+            }
         }
-        // To avoid potential numerical problems at interpolation of the field,
-        // we copy the surface field to underground altitudes
-        for (Index k = ncboxremoved - 1; k >= 0; k--) {
-          cloudbox_field(f_index, k, 0, 0, nummu + j, 0, ist) =
-              cloudbox_field(f_index, k + 1, 0, 0, nummu + j, 0, ist);
-          cloudbox_field(f_index, k, 0, 0, nummu - 1 + j, 0, ist) =
-              cloudbox_field(f_index, k + 1, 0, 0, nummu - 1 + j, 0, ist);
+      }
+
+      // RT4 rad output is in wavelength units, nominally in W/(m2 sr um), where
+      // wavelength input is required in um.
+      // FIXME: When using wavelength input in m, output should be in W/(m2 sr
+      // m). However, check this. So, at first we use wavelength in um. Then
+      // change and compare.
+      //
+      // FIXME: if ever we allow the cloudbox to be not directly at the surface
+      // (at atm level #0, respectively), the assigning from up/down_rad to
+      // cloudbox_field needs to checked. there seems some offsetting going on
+      // (test example: TestDOIT.arts. if kept like below, cloudbox_field at
+      // top-of-cloudbox seems to actually be from somewhere within the
+      // cloud(box) indicated by downwelling being to high and downwelling
+      // exhibiting a non-zero polarisation signature (which it wouldn't with
+      // only scalar gas abs above).
+      //
+      Numeric rad_l2f = job.wavelength / f_grid[f_index];
+      // down/up_rad contain the radiances in order from slant (90deg) to steep
+      // (0 and 180deg, respectively) streams,then the possible extra angle(s).
+      // We need to resort them properly into cloudbox_field, such that order is
+      // from 0 to 180deg.
+      for (Index j = 0; j < nummu; j++) {
+        for (Index ist = 0; ist < stokes_dim; ist++) {
+          for (Index k = cboxlims[1] - cboxlims[0]; k >= 0; k--) {
+            cloudbox_field(f_index, k + ncboxremoved, 0, 0, nummu + j, 0, ist) =
+                up_rad(num_layers - k, j, ist) * rad_l2f;
+            cloudbox_field(
+                f_index, k + ncboxremoved, 0, 0, nummu - 1 - j, 0, ist) =
+                down_rad(num_layers - k, j, ist) * rad_l2f;
+          }
+          // To avoid potential numerical problems at interpolation of the field,
+          // we copy the surface field to underground altitudes
+          for (Index k = ncboxremoved - 1; k >= 0; k--) {
+            cloudbox_field(f_index, k, 0, 0, nummu + j, 0, ist) =
+                cloudbox_field(f_index, k + 1, 0, 0, nummu + j, 0, ist);
+            cloudbox_field(f_index, k, 0, 0, nummu - 1 + j, 0, ist) =
+                cloudbox_field(f_index, k + 1, 0, 0, nummu - 1 + j, 0, ist);
+          }
         }
       }
     }
@@ -188,6 +188,8 @@ void get_rt4surf_props(  // Output
   \param[in]     pfct_threshold Requested scatter_matrix norm accuracy
                  (in terms of single scat albedo).
   \param[in]     max_delta_tau Maximum optical depth of infinitesimal layer
+  \param[in]     nprocesses Number of forked worker processes running RT4
+                 (1 = run RT4 in the calling process)
   \param[in]     verbosity Verbosity setting
 
   \author Jana Mendrok
@@ -230,6 +232,7 @@ void run_rt4(Workspace& ws,
              const Index& pfct_aa_grid_size,
              const Numeric& pfct_threshold,
              const Numeric& max_delta_tau,
+             const Index& nprocesses,
              const Verbosity& verbosity);
 
 //! Reset za_grid such that it is consistent with ARTS
@@ -2687,14 +2687,46 @@ void yCalc_mblock_loop_body(bool& failed,
     // Apply sensor response matrix on diyb_dx, and put into jacobian
     // (that is, analytical jacobian part)
     //
+    // Analytical quantities with adjacent columns in *jacobian* are stacked
+    // and treated by a single sparse-dense product, to only traverse
+    // *sensor_response* once for all of them.
+    //
     if (j_analytical_do) {
-      FOR_ANALYTICAL_JACOBIANS_DO2(
-          mult(jacobian(rowind,
-                        Range(jacobian_indices[iq][0],
-                              jacobian_indices[iq][1] -
-                                  jacobian_indices[iq][0] + 1)),
+      const Index nq = jacobian_quantities.nelem();
+      const auto is_analytical = [&](const Index i) {
+        return jacobian_quantities[i].Analytical() ||
+               jacobian_quantities[i].MainTag() == SURFACE_MAINTAG;
+      };
+      Index iq = 0;
+      while (iq < nq) {
+        if (!is_analytical(iq)) {
+          iq++;
+          continue;
+        }
+        Index iq_end = iq + 1;
+        while (iq_end < nq && is_analytical(iq_end) &&
+               jacobian_indices[iq_end][0] ==
+                   jacobian_indices[iq_end - 1][1] + 1)
+          iq_end++;
+
+        const Index col0 = jacobian_indices[iq][0];
+        const Index ncols = jacobian_indices[iq_end - 1][1] - col0 + 1;
+        if (iq_end - iq == 1) {
+          mult(jacobian(rowind, Range(col0, ncols)),
+               sensor_response,
+               diyb_dx[iq]);
+        } else {
+          Matrix diyb_dx_block(diyb_dx[iq].nrows(), ncols);
+          for (Index i = iq; i < iq_end; i++)
+            diyb_dx_block(joker,
+                          Range(jacobian_indices[i][0] - col0,
+                                diyb_dx[i].ncols())) = diyb_dx[i];
+          mult(jacobian(rowind, Range(col0, ncols)),
                sensor_response,
-               diyb_dx[iq]);)
+               diyb_dx_block);
+        }
+        iq = iq_end;
+      }
     }
 
     // Calculate remaining parts of *jacobian*
@@ -2710,14 +2742,7 @@ void yCalc_mblock_loop_body(bool& failed,
       // We set geo_pos based on the max value in sensor_response
       const Index nfs = f_grid.nelem() * stokes_dim;
       for (Index i = 0; i < n1y; i++) {
-        Index jmax = -1;
-        Numeric rmax = -99e99;
-        for (Index j = 0; j < sensor_response.ncols(); j++) {
-          if (sensor_response(i, j) > rmax) {
-            rmax = sensor_response(i, j);
-            jmax = j;
-          }
-        }
+        const Index jmax = sensor_response.max_element_column(i);
         const Index jhit = Index(floor(jmax / nfs));
         y_geo(row0 + i, joker) = geo_pos_matrix(jhit, joker);
       }
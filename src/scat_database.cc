@@ -0,0 +1,483 @@
+/* Copyright (C) 2026 The ARTS developers
+
+   This program is free software; you can redistribute it and/or modify it
+   under the terms of the GNU General Public License as published by the
+   Free Software Foundation; either version 2, or (at your option) any
+   later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+   USA. */
+
+/*!
+  \file   scat_database.cc
+  \brief  Implementation of scat_database.h.
+
+  Layout of a database file, all values in native byte order:
+
+  - The magic string "ARTSSSDB", the format version and the Index 1 to
+    detect files written with another byte order.
+  - ptype, description and the four grids of the SingleScatteringData.
+  - The fields of the ScatteringMetaData.
+  - The shapes of one record of pha_mat_data, ext_mat_data and
+    abs_vec_data, i.e. the dimensions after frequency and temperature.
+  - The records, ordered by frequency and then temperature.
+
+  Strings are stored as their length followed by the characters, vectors
+  as their length followed by the elements.
+*/
+
+#include "scat_database.h"
+#include <algorithm>
+#include <fstream>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <sys/stat.h>
+
+namespace {
+
+const char DATABASE_MAGIC[] = "ARTSSSDB";
+const Index DATABASE_VERSION = 1;
+
+//! Grids, meta data and record layout of a database file
+struct DatabaseHeader {
+  PType ptype;
+  String description;
+  Vector f_grid;
+  Vector T_grid;
+  Vector za_grid;
+  Vector aa_grid;
+  ScatteringMetaData smd;
+  Index pha_shape[5];
+  Index ext_shape[3];
+  Index abs_shape[3];
+  Index pha_n;
+  Index ext_n;
+  Index abs_n;
+  std::streamoff data_offset;
+
+  Index record_size() const { return pha_n + ext_n + abs_n; }
+};
+
+//! Name, modification time and size of a database file
+typedef std::tuple<String, Index, Index> FileKey;
+
+//! File and frequency and temperature index of a record
+typedef std::tuple<FileKey, Index, Index> RecordKey;
+
+//! Records read from database files, and the headers of the files
+struct RecordCache {
+  std::mutex mutex;
+  Index bytes = 0;
+  Index hits = 0;
+  Index misses = 0;
+  //! Most recently used first
+  std::list<RecordKey> lru;
+  std::map<RecordKey,
+           std::pair<std::shared_ptr<const Vector>,
+                     std::list<RecordKey>::iterator> >
+      records;
+  std::map<FileKey, std::shared_ptr<const DatabaseHeader> > headers;
+
+  //! Drops the least recently used records until the cache fits, lock held
+  void shrink(const Index capacity) {
+    while (bytes > capacity && !lru.empty()) {
+      auto it = records.find(lru.back());
+      bytes -= it->second.first->nelem() * Index(sizeof(Numeric));
+      records.erase(it);
+      lru.pop_back();
+    }
+  }
+
+  //! Drops the header and records of all versions of a file, lock held
+  void drop_file(const String& filename) {
+    for (auto it = headers.begin(); it != headers.end();) {
+      if (std::get<0>(it->first) == filename)
+        it = headers.erase(it);
+      else
+        ++it;
+    }
+    for (auto it = lru.begin(); it != lru.end();) {
+      if (std::get<0>(std::get<0>(*it)) == filename) {
+        auto rec = records.find(*it);
+        bytes -= rec->second.first->nelem() * Index(sizeof(Numeric));
+        records.erase(rec);
+        it = lru.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+};
+
+RecordCache cache;
+
+void write_index(std::ostream& os, const Index x) {
+  os.write(reinterpret_cast<const char*>(&x), sizeof(Index));
+}
+
+void write_numeric(std::ostream& os, const Numeric x) {
+  os.write(reinterpret_cast<const char*>(&x), sizeof(Numeric));
+}
+
+void write_string(std::ostream& os, const String& s) {
+  write_index(os, Index(s.size()));
+  os.write(s.data(), std::streamsize(s.size()));
+}
+
+void write_vector(std::ostream& os, ConstVectorView v) {
+  write_index(os, v.nelem());
+  for (Index i = 0; i < v.nelem(); i++) write_numeric(os, v[i]);
+}
+
+Index read_index(std::istream& is) {
+  Index x;
+  is.read(reinterpret_cast<char*>(&x), sizeof(Index));
+  return x;
+}
+
+Numeric read_numeric(std::istream& is) {
+  Numeric x;
+  is.read(reinterpret_cast<char*>(&x), sizeof(Numeric));
+  return x;
+}
+
+void read_string(std::istream& is, String& s) {
+  const Index n = read_index(is);
+  if (!is || n < 0) throw std::runtime_error("Invalid string length.");
+  s.resize(std::size_t(n));
+  is.read(&s[0], std::streamsize(n));
+}
+
+void read_vector(std::istream& is, Vector& v) {
+  const Index n = read_index(is);
+  if (!is || n < 0) throw std::runtime_error("Invalid vector length.");
+  v.resize(n);
+  is.read(reinterpret_cast<char*>(v.get_c_array()),
+          std::streamsize(n * Index(sizeof(Numeric))));
+}
+
+//! Identifies the current version of a database file
+FileKey file_key(const String& filename) {
+  struct stat st;
+  if (stat(filename.c_str(), &st) != 0) {
+    ostringstream os;
+    os << "Cannot open scattering database file: " << filename;
+    throw std::runtime_error(os.str());
+  }
+  return FileKey(filename, Index(st.st_mtime), Index(st.st_size));
+}
+
+std::shared_ptr<const DatabaseHeader> read_header(const String& filename) {
+  std::ifstream is(filename, std::ios::binary);
+  if (!is) {
+    ostringstream os;
+    os << "Cannot open scattering database file: " << filename;
+    throw std::runtime_error(os.str());
+  }
+
+  auto header = std::make_shared<DatabaseHeader>();
+  try {
+    char magic[sizeof(DATABASE_MAGIC) - 1];
+    is.read(magic, sizeof(magic));
+    if (!is ||
+        !std::equal(magic, magic + sizeof(magic), DATABASE_MAGIC))
+      throw std::runtime_error("Not a scattering database file.");
+    if (read_index(is) != DATABASE_VERSION)
+      throw std::runtime_error("Unsupported version of the file format.");
+    if (read_index(is) != 1)
+      throw std::runtime_error(
+          "The file was written on a machine with another byte order.");
+
+    header->ptype = PType(read_index(is));
+    read_string(is, header->description);
+    read_vector(is, header->f_grid);
+    read_vector(is, header->T_grid);
+    read_vector(is, header->za_grid);
+    read_vector(is, header->aa_grid);
+
+    read_string(is, header->smd.description);
+    read_string(is, header->smd.source);
+    read_string(is, header->smd.refr_index);
+    header->smd.mass = read_numeric(is);
+    header->smd.diameter_max = read_numeric(is);
+    header->smd.diameter_volume_equ = read_numeric(is);
+    header->smd.diameter_area_equ_aerodynamical = read_numeric(is);
+
+    header->pha_n = 1;
+    for (auto& n : header->pha_shape) header->pha_n *= (n = read_index(is));
+    header->ext_n = 1;
+    for (auto& n : header->ext_shape) header->ext_n *= (n = read_index(is));
+    header->abs_n = 1;
+    for (auto& n : header->abs_shape) header->abs_n *= (n = read_index(is));
+
+    header->data_offset = is.tellg();
+    if (!is) throw std::runtime_error("Unexpected end of file.");
+  } catch (const std::runtime_error& e) {
+    ostringstream os;
+    os << "Error reading scattering database file " << filename << ":\n"
+       << e.what();
+    throw std::runtime_error(os.str());
+  }
+
+  return header;
+}
+
+//! Index range of grid covering [lo, hi], with margin extra points per side
+Range grid_range(const Vector& grid,
+                 const Numeric lo,
+                 const Numeric hi,
+                 const Index margin) {
+  const Index n = grid.nelem();
+  const Numeric* begin = grid.get_c_array();
+  // Last point not above lo and first point not below hi
+  Index first = Index(std::upper_bound(begin, begin + n, lo) - begin) - 1;
+  Index last = Index(std::lower_bound(begin, begin + n, hi) - begin);
+  first = std::max(Index(0), first - margin);
+  last = std::min(n - 1, std::max(last, first) + margin);
+  return Range(first, last - first + 1);
+}
+
+}  // namespace
+
+void scat_database_write(const String& filename,
+                         const SingleScatteringData& ssd,
+                         const ScatteringMetaData& smd) {
+  const Index nf = ssd.f_grid.nelem();
+  const Index nt = ssd.T_grid.nelem();
+  if (ssd.pha_mat_data.nlibraries() != nf ||
+      ssd.pha_mat_data.nvitrines() != nt ||
+      ssd.ext_mat_data.nshelves() != nf || ssd.ext_mat_data.nbooks() != nt ||
+      ssd.abs_vec_data.nshelves() != nf || ssd.abs_vec_data.nbooks() != nt) {
+    ostringstream os;
+    os << "The frequency and temperature dimensions of pha_mat_data,\n"
+       << "ext_mat_data and abs_vec_data must match f_grid and T_grid.\n"
+       << "Scattering element: " << ssd.description;
+    throw std::runtime_error(os.str());
+  }
+
+  std::ofstream os(filename, std::ios::binary | std::ios::trunc);
+  if (!os) {
+    ostringstream es;
+    es << "Cannot create scattering database file: " << filename;
+    throw std::runtime_error(es.str());
+  }
+
+  os.write(DATABASE_MAGIC, sizeof(DATABASE_MAGIC) - 1);
+  write_index(os, DATABASE_VERSION);
+  write_index(os, 1);
+
+  write_index(os, ssd.ptype);
+  write_string(os, ssd.description);
+  write_vector(os, ssd.f_grid);
+  write_vector(os, ssd.T_grid);
+  write_vector(os, ssd.za_grid);
+  write_vector(os, ssd.aa_grid);
+
+  write_string(os, smd.description);
+  write_string(os, smd.source);
+  write_string(os, smd.refr_index);
+  write_numeric(os, smd.mass);
+  write_numeric(os, smd.diameter_max);
+  write_numeric(os, smd.diameter_volume_equ);
+  write_numeric(os, smd.diameter_area_equ_aerodynamical);
+
+  const Tensor7& pha = ssd.pha_mat_data;
+  const Tensor5& ext = ssd.ext_mat_data;
+  const Tensor5& abs = ssd.abs_vec_data;
+  for (Index n : {pha.nshelves(), pha.nbooks(), pha.npages(), pha.nrows(),
+                  pha.ncols(), ext.npages(), ext.nrows(), ext.ncols(),
+                  abs.npages(), abs.nrows(), abs.ncols()})
+    write_index(os, n);
+
+  const Index pha_n =
+      pha.nshelves() * pha.nbooks() * pha.npages() * pha.nrows() * pha.ncols();
+  const Index ext_n = ext.npages() * ext.nrows() * ext.ncols();
+  const Index abs_n = abs.npages() * abs.nrows() * abs.ncols();
+
+  // The tensors are contiguous, with frequency and temperature outermost
+  for (Index i = 0; i < nf * nt; i++) {
+    os.write(reinterpret_cast<const char*>(pha.get_c_array() + i * pha_n),
+             std::streamsize(pha_n * Index(sizeof(Numeric))));
+    os.write(reinterpret_cast<const char*>(ext.get_c_array() + i * ext_n),
+             std::streamsize(ext_n * Index(sizeof(Numeric))));
+    os.write(reinterpret_cast<const char*>(abs.get_c_array() + i * abs_n),
+             std::streamsize(abs_n * Index(sizeof(Numeric))));
+  }
+
+  if (!os) {
+    ostringstream es;
+    es << "Error writing scattering database file: " << filename;
+    throw std::runtime_error(es.str());
+  }
+
+  // Drop what is cached of an earlier file with the same name, also if
+  // rewritten within the resolution of the modification time
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.drop_file(filename);
+}
+
+void scat_database_read(SingleScatteringData& ssd,
+                        ScatteringMetaData& smd,
+                        const String& filename,
+                        const Numeric f_min,
+                        const Numeric f_max,
+                        const Numeric t_min,
+                        const Numeric t_max,
+                        const Index margin,
+                        const Index cache_size) {
+  const FileKey file = file_key(filename);
+
+  std::shared_ptr<const DatabaseHeader> header;
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto it = cache.headers.find(file);
+    if (it != cache.headers.end()) header = it->second;
+  }
+  if (!header) {
+    header = read_header(filename);
+    if (cache_size > 0) {
+      // Whatever is cached of the file is outdated
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      cache.drop_file(filename);
+      cache.headers[file] = header;
+    }
+  }
+
+  const Range fr = grid_range(header->f_grid, f_min, f_max, margin);
+  const Range tr = grid_range(header->T_grid, t_min, t_max, margin);
+  const Index nf = fr.get_extent();
+  const Index nt = tr.get_extent();
+  const Index size = header->record_size();
+
+  // Look up the records, those not found are read below
+  std::vector<std::shared_ptr<const Vector> > records(std::size_t(nf * nt));
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    for (Index i = 0; i < nf; i++)
+      for (Index j = 0; j < nt; j++) {
+        auto it = cache.records.find(
+            RecordKey(file, fr.get_start() + i, tr.get_start() + j));
+        if (it != cache.records.end()) {
+          records[std::size_t(i * nt + j)] = it->second.first;
+          cache.lru.splice(cache.lru.begin(), cache.lru, it->second.second);
+          cache.hits++;
+        }
+      }
+  }
+
+  std::vector<RecordKey> read_keys;
+  std::vector<std::shared_ptr<const Vector> > read_records;
+  std::ifstream is;
+  for (Index i = 0; i < nf; i++) {
+    // Whether the record before (i, j) was read in this loop, i.e. whether
+    // the stream is positioned at record (i, j)
+    bool prev_read = false;
+    for (Index j = 0; j < nt; j++) {
+      if (records[std::size_t(i * nt + j)]) {
+        prev_read = false;
+        continue;
+      }
+
+      if (!is.is_open()) {
+        is.open(filename, std::ios::binary);
+        if (!is) {
+          ostringstream os;
+          os << "Cannot open scattering database file: " << filename;
+          throw std::runtime_error(os.str());
+        }
+      }
+
+      // Records of consecutive temperatures follow each other in the file,
+      // seek only when the previous record was not just read
+      const Index fi = fr.get_start() + i;
+      const Index ti = tr.get_start() + j;
+      if (!prev_read)
+        is.seekg(header->data_offset +
+                 std::streamoff((fi * header->T_grid.nelem() + ti) * size *
+                                Index(sizeof(Numeric))));
+
+      auto record = std::make_shared<Vector>(size);
+      is.read(reinterpret_cast<char*>(record->get_c_array()),
+              std::streamsize(size * Index(sizeof(Numeric))));
+      if (!is) {
+        ostringstream os;
+        os << "Error reading scattering database file " << filename << ":\n"
+           << "Unexpected end of file.";
+        throw std::runtime_error(os.str());
+      }
+
+      records[std::size_t(i * nt + j)] = record;
+      prev_read = true;
+      read_keys.emplace_back(file, fi, ti);
+      read_records.push_back(record);
+    }
+  }
+
+  if (!read_keys.empty()) {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.misses += Index(read_keys.size());
+    if (cache_size > 0) {
+      for (std::size_t k = 0; k < read_keys.size(); k++) {
+        if (cache.records.count(read_keys[k])) continue;
+        cache.lru.push_front(read_keys[k]);
+        cache.records.emplace(
+            read_keys[k], std::make_pair(read_records[k], cache.lru.begin()));
+        cache.bytes += size * Index(sizeof(Numeric));
+      }
+      cache.shrink(cache_size);
+    }
+  }
+
+  // Assemble the data of the requested ranges
+  const Index* p = header->pha_shape;
+  const Index* e = header->ext_shape;
+  const Index* a = header->abs_shape;
+
+  ssd.ptype = header->ptype;
+  ssd.description = header->description;
+  ssd.f_grid = header->f_grid[fr];
+  ssd.T_grid = header->T_grid[tr];
+  ssd.za_grid = header->za_grid;
+  ssd.aa_grid = header->aa_grid;
+  ssd.pha_mat_data.resize(nf, nt, p[0], p[1], p[2], p[3], p[4]);
+  ssd.ext_mat_data.resize(nf, nt, e[0], e[1], e[2]);
+  ssd.abs_vec_data.resize(nf, nt, a[0], a[1], a[2]);
+
+  for (Index k = 0; k < nf * nt; k++) {
+    const Numeric* src = records[std::size_t(k)]->get_c_array();
+    std::copy(src,
+              src + header->pha_n,
+              ssd.pha_mat_data.get_c_array() + k * header->pha_n);
+    src += header->pha_n;
+    std::copy(src,
+              src + header->ext_n,
+              ssd.ext_mat_data.get_c_array() + k * header->ext_n);
+    src += header->ext_n;
+    std::copy(src,
+              src + header->abs_n,
+              ssd.abs_vec_data.get_c_array() + k * header->abs_n);
+  }
+
+  smd = header->smd;
+}
+
+ScatDatabaseCacheStats scat_database_cache_stats() {
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  ScatDatabaseCacheStats stats;
+  stats.hits = cache.hits;
+  stats.misses = cache.misses;
+  stats.bytes = cache.bytes;
+  return stats;
+}
@@ -0,0 +1,102 @@
+/* Copyright (C) 2026 The ARTS developers
+
+   This program is free software; you can redistribute it and/or modify it
+   under the terms of the GNU General Public License as published by the
+   Free Software Foundation; either version 2, or (at your option) any
+   later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+   USA. */
+
+/*!
+  \file   scat_database.h
+  \brief  Indexed on-disk storage of single scattering data.
+
+  A database file holds one scattering element, i.e. its
+  SingleScatteringData and ScatteringMetaData. The grids and the meta data
+  are stored in a small header. The optical properties follow as one
+  record per frequency and temperature, each record holding the
+  pha_mat_data, ext_mat_data and abs_vec_data of that grid point. The
+  position of a record follows directly from its grid indices, so any
+  frequency and temperature range can be read without touching the rest
+  of the file.
+
+  Records that have been read can be kept in a cache shared by all
+  database files. Repeated reads of the same ranges, e.g. by the cases of
+  a batch calculation, are then served from memory. The cache has no size
+  of its own, each read states how large the cache may grow by its
+  records. Files are identified by name, modification time and size, so
+  records of a file changed on disk are never used.
+*/
+
+#ifndef scat_database_h
+#define scat_database_h
+
+#include "optproperties.h"
+
+/** Writes a scattering element to a database file.
+
+    Records of the file held in the cache are dropped.
+
+    \param[in]  filename  Name of the database file.
+    \param[in]  ssd       Single scattering data.
+    \param[in]  smd       Scattering meta data.
+*/
+void scat_database_write(const String& filename,
+                         const SingleScatteringData& ssd,
+                         const ScatteringMetaData& smd);
+
+/** Reads part of a scattering element from a database file.
+
+    All frequencies of the file inside [f_min, f_max] are read, together
+    with the closest frequency outside the range on each side and margin
+    further grid points. The same applies to the temperatures and
+    [t_min, t_max]. With margin set to the interpolation order,
+    interpolation to any point of the ranges gives the same result as with
+    the complete data.
+
+    \param[out] ssd     Single scattering data, restricted to the ranges.
+    \param[out] smd     Scattering meta data.
+    \param[in]  filename  Name of the database file.
+    \param[in]  f_min   Lowest frequency needed.
+    \param[in]  f_max   Highest frequency needed.
+    \param[in]  t_min   Lowest temperature needed.
+    \param[in]  t_max   Highest temperature needed.
+    \param[in]  margin  Number of extra grid points on each side.
+    \param[in]  cache_size  Maximum size of the record cache after the
+                            read, in bytes. The least recently used records
+                            are dropped to fit the records read. With 0,
+                            records are only taken from the cache, which
+                            is left unchanged.
+*/
+void scat_database_read(SingleScatteringData& ssd,
+                        ScatteringMetaData& smd,
+                        const String& filename,
+                        const Numeric f_min,
+                        const Numeric f_max,
+                        const Numeric t_min,
+                        const Numeric t_max,
+                        const Index margin,
+                        const Index cache_size);
+
+/** Counters of the record cache. */
+struct ScatDatabaseCacheStats {
+  /** Number of records served from the cache. */
+  Index hits{0};
+  /** Number of records read from file. */
+  Index misses{0};
+  /** Size of the cached records, in bytes. */
+  Index bytes{0};
+};
+
+/** Returns the counters of the record cache since program start. */
+ScatDatabaseCacheStats scat_database_cache_stats();
+
+#endif /* scat_database_h */
@@ -25,8 +25,15 @@
 */
 
 #include "telsem.h"
+#include <algorithm>
 #include <cmath>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <queue>
 #include <utility>
+#include <vector>
+#include "arts_omp.h"
 #include "check_input.h"
 #include "geodetic.h"
 
@@ -129,6 +136,12 @@ void TelsemAtlas::equare() {
   for (Index i = 1; i < maxlat; ++i) {
     firstcells[i] = firstcells[i - 1] + ncells[i];
   }
+
+  band_offsets.resize(maxlat);
+  band_offsets[0] = 0;
+  for (Index i = 1; i < maxlat; ++i) {
+    band_offsets[i] = band_offsets[i - 1] + ncells[i - 1];
+  }
 }
 
 void TelsemAtlas::telsem_calc_correspondence() {
@@ -137,6 +150,12 @@ void TelsemAtlas::telsem_calc_correspondence() {
   for (Index j = 0; j < ndat; j++) {
     correspondence[cellnums[j]] = j;
   }
+
+  // The grid is not part of the XML format
+  if (band_offsets.empty()) {
+    equare();
+  }
+  nearest.reset();
 }
 
 Index TelsemAtlas::calc_cellnum(Numeric lat, Numeric lon) const {
@@ -159,16 +178,11 @@ Index TelsemAtlas::calc_cellnum(Numeric lat, Numeric lon) const {
     lat -= 0.125;
   }
 
-  Index cellnum = 0;
   Index ilat = static_cast<Index>((lat + 90.0) / dlat);
   Index ilon =
       static_cast<Index>(lon / (360.0 / static_cast<Numeric>(ncells[ilat]))) +
       1;
-  for (Index i = 0; i < ilat; ++i) {
-    cellnum += ncells[i];
-  }
-  cellnum += ilon;
-  return cellnum;
+  return band_offsets[ilat] + ilon;
 }
 
 Index TelsemAtlas::calc_cellnum_nearest_neighbor(Numeric lat,
@@ -288,16 +302,12 @@ Numeric TelsemAtlas::interp_freq2(Numeric emiss19,
   return emiss;
 }
 
-std::pair<Numeric, Numeric> TelsemAtlas::emis_interp(
-    Numeric theta,
-    Numeric freq,
-    Index class1,
-    Index class2,
-    const ConstVectorView& ev,
-    const ConstVectorView& eh) const {
-  Vector emiss_scal_h(3);
-  Vector emiss_scal_v(3);
-
+void TelsemAtlas::emis_scal(Numeric theta,
+                            Index class1,
+                            const ConstVectorView& ev,
+                            const ConstVectorView& eh,
+                            Numeric* emiss_scal_v,
+                            Numeric* emiss_scal_h) const {
   for (Index i = 0; i < 3; ++i) {
     Numeric e0 = a0_k0[i + (class1 - 1) * 3] +
                  a0_k1[i + (class1 - 1) * 3] * ev[i] +
@@ -330,6 +340,18 @@ std::pair<Numeric, Numeric> TelsemAtlas::emis_interp(
         b3 * pow(theta, 3) + b2 * pow(theta, 2) + b1 * theta + b0;
     emiss_scal_h[i] = s_h * emtheta_h;
   }
+}
+
+std::pair<Numeric, Numeric> TelsemAtlas::emis_interp(
+    Numeric theta,
+    Numeric freq,
+    Index class1,
+    Index class2,
+    const ConstVectorView& ev,
+    const ConstVectorView& eh) const {
+  Numeric emiss_scal_h[3];
+  Numeric emiss_scal_v[3];
+  emis_scal(theta, class1, ev, eh, emiss_scal_v, emiss_scal_h);
 
   Numeric emiss_h = interp_freq2(
       emiss_scal_h[0], emiss_scal_h[1], emiss_scal_h[2], freq, class2);
@@ -343,6 +365,170 @@ std::pair<Numeric, Numeric> TelsemAtlas::emis_interp(
   return std::make_pair(emiss_v, emiss_h);
 }
 
+std::pair<Numeric, Numeric> TelsemAtlas::cell_center(Index cellnum) const {
+  const Index band = static_cast<Index>(std::upper_bound(band_offsets.begin(),
+                                                         band_offsets.end(),
+                                                         cellnum - 1) -
+                                        band_offsets.begin()) -
+                     1;
+  const Index ilon = cellnum - band_offsets[band];
+  return std::make_pair(
+      (static_cast<Numeric>(band) + 0.5) * dlat - 90.0,
+      (static_cast<Numeric>(ilon) - 0.5) *
+          (360.0 / static_cast<Numeric>(ncells[band])));
+}
+
+std::shared_ptr<const ArrayOfIndex> TelsemAtlas::nearest_cells() const {
+  static std::mutex nearest_mutex;
+  std::lock_guard<std::mutex> lock(nearest_mutex);
+  if (nearest) {
+    return nearest;
+  }
+
+  const Index nbands = ncells.nelem();
+  const Index ntot = band_offsets[nbands - 1] + ncells[nbands - 1];
+
+  // Band and center of each cell, indexed by cellnumber
+  ArrayOfIndex bands(ntot + 1, -1);
+  Vector lats(ntot + 1), lons(ntot + 1);
+  for (Index b = 0; b < nbands; ++b) {
+    for (Index ilon = 1; ilon <= ncells[b]; ++ilon) {
+      const Index c = band_offsets[b] + ilon;
+      bands[c] = b;
+      std::tie(lats[c], lons[c]) = cell_center(c);
+    }
+  }
+
+  // Grow the regions of the cells contained in the atlas over the
+  // neighboring cells, closest first
+  auto table = std::make_shared<ArrayOfIndex>(ntot + 1, -1);
+  Vector dist(ntot + 1, std::numeric_limits<Numeric>::infinity());
+  typedef std::pair<Numeric, Index> Entry;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry> > queue;
+
+  for (Index c = 1; c <= ntot; ++c) {
+    if (contains(c)) {
+      (*table)[c] = c;
+      dist[c] = 0.0;
+      queue.emplace(0.0, c);
+    }
+  }
+
+  auto visit = [&](Index from, Index to) {
+    const Index source = (*table)[from];
+    const Numeric d = sphdist(lats[to], lons[to], lats[source], lons[source]);
+    if (d < dist[to]) {
+      dist[to] = d;
+      (*table)[to] = source;
+      queue.emplace(d, to);
+    }
+  };
+
+  while (!queue.empty()) {
+    const Entry e = queue.top();
+    queue.pop();
+    const Index c = e.second;
+    if (e.first > dist[c]) {
+      continue;
+    }
+
+    // Neighbors in the same band, and overlapping cells in adjacent bands
+    const Index b = bands[c];
+    const Index n = ncells[b];
+    const Index ilon = c - band_offsets[b];
+    visit(c, band_offsets[b] + (ilon == 1 ? n : ilon - 1));
+    visit(c, band_offsets[b] + (ilon == n ? 1 : ilon + 1));
+    for (Index b2 : {b - 1, b + 1}) {
+      if (b2 < 0 || b2 >= nbands) {
+        continue;
+      }
+      const Index n2 = ncells[b2];
+      const Index first = ((ilon - 1) * n2) / n + 1;
+      const Index last = std::min(n2, (ilon * n2 + n - 1) / n);
+      for (Index ilon2 = first; ilon2 <= last; ++ilon2) {
+        visit(c, band_offsets[b2] + ilon2);
+      }
+    }
+  }
+
+  nearest = table;
+  return nearest;
+}
+
+void TelsemAtlas::emis_interp_batch(Tensor3& emissivities,
+                                    const ConstVectorView& lat,
+                                    const ConstVectorView& lon,
+                                    const ConstVectorView& theta,
+                                    const ConstVectorView& freq,
+                                    Numeric d_max) const {
+  const Index n = lat.nelem();
+  const Index nf = freq.nelem();
+  if (lon.nelem() != n || theta.nelem() != n) {
+    throw std::runtime_error(
+        "Latitude, longitude and angle inputs must have the same size.");
+  }
+
+  ArrayOfIndex cells(n);
+  for (Index i = 0; i < n; ++i) {
+    cells[i] = calc_cellnum(lat[i], lon[i]);
+  }
+
+  std::shared_ptr<const ArrayOfIndex> table;
+  if (d_max > 0.0) {
+    table = nearest_cells();
+  }
+
+  emissivities.resize(n, nf, 2);
+
+#pragma omp parallel for if (!arts_omp_in_parallel() && n > 1)
+  for (Index i = 0; i < n; ++i) {
+    Index cellnum = cells[i];
+    if (!contains(cellnum)) {
+      if (table && cellnum < table->nelem() && (*table)[cellnum] >= 0) {
+        cellnum = (*table)[cellnum];
+        Numeric lat_nn, lon_nn;
+        std::tie(lat_nn, lon_nn) = cell_center(cellnum);
+        if (sphdist(lat[i], lon[i], lat_nn, lon_nn) > d_max) {
+          cellnum = -1;
+        }
+      } else {
+        cellnum = -1;
+      }
+    }
+
+    if (cellnum < 0) {
+      emissivities(i, joker, joker) = NAN;
+      continue;
+    }
+
+    const Index class2 = get_class2(cellnum);
+
+    // The angular part is the same for all frequencies
+    Numeric emiss_scal_h[3];
+    Numeric emiss_scal_v[3];
+    emis_scal(theta[i],
+              get_class1(cellnum),
+              get_emis_v(cellnum),
+              get_emis_h(cellnum),
+              emiss_scal_v,
+              emiss_scal_h);
+
+    for (Index k = 0; k < nf; ++k) {
+      Numeric emiss_h = interp_freq2(
+          emiss_scal_h[0], emiss_scal_h[1], emiss_scal_h[2], freq[k], class2);
+      Numeric emiss_v = interp_freq2(
+          emiss_scal_v[0], emiss_scal_v[1], emiss_scal_v[2], freq[k], class2);
+
+      if (emiss_v < emiss_h) {
+        emiss_v = 0.5 * (emiss_v + emiss_h);
+        emiss_h = emiss_v;
+      }
+      emissivities(i, k, 0) = emiss_v;
+      emissivities(i, k, 1) = emiss_h;
+    }
+  }
+}
+
 std::ostream& operator<<(std::ostream& os, const TelsemAtlas& ta) {
   os << ta.name << std::endl;
   return os;
@@ -36,6 +36,7 @@
 #define telsem_h
 
 #include <array>
+#include <memory>
 #include "array.h"
 #include "matpackIII.h"
 #include "mystring.h"
@@ -279,6 +280,35 @@ class TelsemAtlas {
                                           const ConstVectorView &ev,
                                           const ConstVectorView &eh) const;
 
+  /*! Interpolate emissivities for many locations at once.
+     *
+     * Evaluates the Telsem model for all combinations of locations and
+     * frequencies, e.g. for all pixels of a satellite granule. Each
+     * location has its own incidence angle.
+     *
+     * Locations not contained in the atlas take the emissivities of the
+     * nearest cell contained in the atlas, if d_max is positive and the
+     * distance to that cell does not exceed d_max. The nearest cells of
+     * all cells of the atlas are tabulated on first use.
+     *
+     * @param[out] emissivities The vertical and horizontal emissivities,
+     *                          [location, frequency, 2]. NAN for locations
+     *                          without data.
+     * @param[in] lat   The latitudes of the locations.
+     * @param[in] lon   The longitudes of the locations, in [0, 360].
+     * @param[in] theta The zenith angle at each location.
+     * @param[in] freq  The frequencies in GHz (!!!)
+     * @param[in] d_max The maximum distance to the nearest cell, as
+     *                  returned by sphdist. Values <= 0 disable the
+     *                  nearest neighbor lookup.
+     */
+  void emis_interp_batch(Tensor3 &emissivities,
+                         const ConstVectorView &lat,
+                         const ConstVectorView &lon,
+                         const ConstVectorView &theta,
+                         const ConstVectorView &freq,
+                         Numeric d_max) const;
+
   friend std::ostream &operator<<(std::ostream &os, const TelsemAtlas &ta);
   friend void xml_write_to_stream(ostream &,
                                   const TelsemAtlas &,
@@ -347,6 +377,20 @@ class TelsemAtlas {
   Numeric RAPPORT54_43(Index i) {return rapport54_43[i];}
   
  private:
+  // Angular part of emis_interp, emissivities at 19, 37 and 85 GHz.
+  void emis_scal(Numeric theta,
+                 Index class1,
+                 const ConstVectorView &ev,
+                 const ConstVectorView &eh,
+                 Numeric *emiss_scal_v,
+                 Numeric *emiss_scal_h) const;
+
+  // Center of a cell as numbered by calc_cellnum.
+  std::pair<Numeric, Numeric> cell_center(Index cellnum) const;
+
+  // Nearest cell contained in the atlas for each cellnumber, or -1.
+  std::shared_ptr<const ArrayOfIndex> nearest_cells() const;
+
   // Number of lines in the Atlas.
   Index ndat;
   // Number of channels in the Atlas.
@@ -374,6 +418,10 @@ class TelsemAtlas {
   ArrayOfIndex cellnums;
   // Derived from file data
   ArrayOfIndex correspondence;
+  // Number of cells in all latitude bands below each band.
+  ArrayOfIndex band_offsets;
+  // Table of nearest_cells(), computed on first use.
+  mutable std::shared_ptr<const ArrayOfIndex> nearest;
 
   // Regression coefficients.
   static const std::array<Numeric, 30> a0_k0;
@@ -126,3 +126,60 @@ void tessem_prop_nn(VectorView& ny, const TessemNN& net, ConstVectorView nx) {
   for (Index i = 0; i < net.nb_outputs; i++)
     ny[i] = net.y_min[i] + (new_y[i] + 1.) / 2. * (net.y_max[i] - net.y_min[i]);
 }
+
+/*! Tessem emissivity calculation for many inputs
+
+  Same as tessem_prop_nn, but for many input vectors at once, e.g. all
+  frequencies and angles of a swath. Both layers of the network are
+  evaluated as matrix products over all inputs.
+
+  \param[out] ny  Calculated emissivities, one row per input.
+  \param[in] net  Neural network parameters.
+  \param[in] nx  Input data, one row per input.
+*/
+void tessem_prop_nn_batch(MatrixView ny,
+                          const TessemNN& net,
+                          ConstMatrixView nx) {
+  if (nx.ncols() != net.nb_inputs) {
+    ostringstream os;
+    os << "Tessem NN requires " << net.nb_inputs
+       << " values, but input matrix has " << nx.ncols() << " columns.";
+    throw std::runtime_error(os.str());
+  }
+
+  if (ny.ncols() != net.nb_outputs || ny.nrows() != nx.nrows()) {
+    ostringstream os;
+    os << "Tessem NN generates " << net.nb_outputs << " values for each of "
+       << nx.nrows() << " inputs, but output matrix has size " << ny.nrows()
+       << " x " << ny.ncols() << ".";
+    throw std::runtime_error(os.str());
+  }
+
+  const Index n = nx.nrows();
+
+  // preprocessing
+  Matrix new_x(nx);
+  new_x(joker, 0) *= 1e-9;
+  new_x(joker, 4) *= 1e3;
+  for (Index k = 0; k < n; k++)
+    for (Index i = 0; i < net.nb_inputs; i++)
+      new_x(k, i) =
+          -1. + (new_x(k, i) - net.x_min[i]) / (net.x_max[i] - net.x_min[i]) * 2;
+
+  // propagation
+  Matrix trans(n, net.nb_cache);
+  mult(trans, new_x, transpose(net.w1));
+  Numeric* t = trans.get_c_array();
+  for (Index k = 0; k < n; k++, t += net.nb_cache)
+    for (Index i = 0; i < net.nb_cache; i++)
+      t[i] = 2. / (1. + exp(-2. * (t[i] + net.b1[i]))) - 1.;
+
+  Matrix new_y(n, net.nb_outputs);
+  mult(new_y, trans, transpose(net.w2));
+
+  // postprocessing
+  for (Index k = 0; k < n; k++)
+    for (Index i = 0; i < net.nb_outputs; i++)
+      ny(k, i) = net.y_min[i] + (new_y(k, i) + net.b2[i] + 1.) / 2. *
+                                    (net.y_max[i] - net.y_min[i]);
+}
@@ -48,4 +48,8 @@ void tessem_read_ascii(std::ifstream& is, TessemNN& net);
 
 void tessem_prop_nn(VectorView& ny, const TessemNN& net, ConstVectorView nx);
 
+void tessem_prop_nn_batch(MatrixView ny,
+                          const TessemNN& net,
+                          ConstMatrixView nx);
+
 #endif /* tessem_h */
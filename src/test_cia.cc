@@ -50,7 +50,37 @@ void test01() {
   cout << "result:" << result << endl;
 }
 
+void test02() {
+  cout << "Testing batched CIA Interpolation.\n";
+  GriddedField2 cia_data;
+
+  Matrix A(5, 4, 0.);
+  for (Index i = 0; i < 5; i++)
+    for (Index j = 0; j < 4; j++) A(i, j) = Numeric(1 + i * j);
+
+  cia_data.data = A;
+  cia_data.set_grid(0, {1, 2, 3, 4, 5});
+  cia_data.set_grid(1, {100, 200, 300, 400});
+
+  Vector f_out(0.5, 11, 0.5);
+  Vector T_out{120, 180, 250, 333, 390};
+
+  Matrix result(f_out.nelem(), T_out.nelem());
+  cia_interpolation(result, f_out, T_out, cia_data, 0.5, 0, Verbosity(0, 0, 0));
+
+  Vector result_single(f_out.nelem());
+  Numeric max_diff = 0;
+  for (Index it = 0; it < T_out.nelem(); it++) {
+    cia_interpolation(
+        result_single, f_out, T_out[it], cia_data, 0.5, 0, Verbosity(0, 0, 0));
+    for (Index iv = 0; iv < f_out.nelem(); iv++)
+      max_diff = max(max_diff, abs(result(iv, it) - result_single[iv]));
+  }
+  cout << "max difference to vector version: " << max_diff << endl;
+}
+
 int main() {
   test01();
+  test02();
   return 0;
 }
@@ -33,6 +33,7 @@
 #include "covariance_matrix.h"
 #include "jacobian.h"
 #include "lin_alg.h"
+#include "matpack_alloc.h"
 #include "test_utils.h"
 #include "xml_io.h"
 
@@ -366,6 +367,81 @@ Numeric test_diagonal(Index n_tests) {
   return e;
 }
 
+/**
+ * Test the sparse factorization of covariance matrices.
+ *
+ * Creates a covariance matrix with a dense block and a large banded sparse
+ * block, which is factorized instead of inverted, and compares products
+ * with the inverse to those obtained with the dense inverse.
+ *
+ * @param  n_tests The number of tests to perform
+ * @return The maximum error of the result with respect to the same operations
+ * performed using an identical matrix of type Matrix
+ */
+Numeric test_sparse_factorization(Index n_tests) {
+  Numeric e = 0.0;
+  for (Index i = 0; i < n_tests; i++) {
+    const Index n_dense = 50, n_sparse = 400, n = n_dense + n_sparse;
+
+    std::shared_ptr<Matrix> d = std::make_shared<Matrix>(n_dense, n_dense);
+    random_fill_matrix_pos_def(*d, 1.0, false);
+
+    ArrayOfIndex row_indices{}, col_indices{};
+    ArrayOfNumeric elements{};
+    for (Index k = 0; k < n_sparse; k++) {
+      for (Index l = std::max<Index>(0, k - 2);
+           l <= std::min<Index>(n_sparse - 1, k + 2);
+           l++) {
+        row_indices.push_back(k);
+        col_indices.push_back(l);
+        elements.push_back(k == l ? 2.0 : -0.4);
+      }
+    }
+    std::shared_ptr<Sparse> s = std::make_shared<Sparse>(n_sparse, n_sparse);
+    s->insert_elements(
+        elements.nelem(), row_indices, col_indices, Vector(elements));
+
+    CovarianceMatrix covmat{};
+    covmat.add_correlation(Block(Range(0, n_dense),
+                                 Range(0, n_dense),
+                                 std::make_pair(0, 0),
+                                 d));
+    covmat.add_correlation(Block(Range(n_dense, n_sparse),
+                                 Range(n_dense, n_sparse),
+                                 std::make_pair(1, 1),
+                                 s));
+    covmat.compute_inverse();
+
+    Matrix A(covmat), A_inv(n, n), B(n, 10), C(n, 10), C_ref(n, 10);
+    inv(A_inv, A);
+    random_fill_matrix(B, 10.0, false);
+
+    mult_inv(C, covmat, B);
+    mult(C_ref, A_inv, B);
+    e = std::max(e, get_maximum_error(C, C_ref, true));
+
+    Matrix D(10, n), D_ref(10, n);
+    mult_inv(D, transpose(B), covmat);
+    mult(D_ref, transpose(B), A_inv);
+    e = std::max(e, get_maximum_error(D, D_ref, true));
+
+    Vector w(n), w_ref(n);
+    solve(w, covmat, B(joker, 0));
+    mult(w_ref, A_inv, B(joker, 0));
+    e = std::max(e, get_maximum_error(w, w_ref, true));
+
+    Vector diag_1 = covmat.inverse_diagonal();
+    Vector diag_2 = A_inv.diagonal();
+    e = std::max(e, get_maximum_error(diag_1, diag_2, true));
+
+    Matrix E(n, n);
+    E = 0.0;
+    add_inv(E, covmat);
+    e = std::max(e, get_maximum_error(E, A_inv, true));
+  }
+  return e;
+}
+
 /**
  * Test input and output of covariance matrices.
  *
@@ -629,6 +705,13 @@ int main() {
     return -1;
   }
 
+  e = test_sparse_factorization(10);
+  std::cout << "\tSparse Factorization:    " << e << std::endl;
+  e_max = std::max(e, e_max);
+  if (e_max > 1e-5) {
+    return -1;
+  }
+
   e = test_io(10);
   std::cout << "\tXML IO:                  " << e << std::endl;
   e_max = std::max(e, e_max);
@@ -0,0 +1,135 @@
+/* Copyright (C) 2026 The ARTS developers
+
+   This program is free software; you can redistribute it and/or modify it
+   under the terms of the GNU General Public License as published by the
+   Free Software Foundation; either version 2, or (at your option) any
+   later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+   USA. */
+
+/*!
+  \file   test_jobserver.cc
+
+  \brief  Submits jobs to the job server and checks their results.
+*/
+
+#include <iostream>
+#include "arts.h"
+
+#ifdef ENABLE_DOCSERVER
+
+#include "agenda_record.h"
+#include "global_data.h"
+#include "jobserver.h"
+#include "methods.h"
+#include "workspace_ng.h"
+#include "xml_io.h"
+#include "xml_io_private.h"
+#include "xml_io_types.h"
+
+//! Submits a job and reads its result
+String run(JobServer& server,
+           const String& controlfile,
+           const String& outputs,
+           const std::map<String, String>& overrides = {}) {
+  auto job = std::make_shared<ServerJob>();
+  job->controlfile = controlfile;
+  outputs.split(job->outputs, ",");
+  job->overrides = overrides;
+
+  server.submit(job).get();
+
+  String result, piece;
+  while (job->result.read(piece)) result += piece;
+  if (job->result.failed()) throw runtime_error("Incomplete result.");
+  return result;
+}
+
+//! The result expected for a job returning one vector
+String vector_result(const String& name, const Vector& v) {
+  const Verbosity verbosity(0, 0, 0);
+  ostringstream os;
+  xml_set_stream_precision(os);
+  xml_write_header_to_stream(os, FILE_TYPE_ASCII, verbosity);
+  xml_write_to_stream(os, v, NULL, name, verbosity);
+  xml_write_footer_to_stream(os, verbosity);
+  return os.str();
+}
+
+bool check(const String& what, const String& result, const String& expected) {
+  if (result == expected) return true;
+  cerr << what << " FAILED, result:\n" << result << "expected:\n" << expected;
+  return false;
+}
+
+//! Checks that a job fails
+bool check_fails(JobServer& server,
+                 const String& what,
+                 const String& controlfile,
+                 const String& outputs) {
+  try {
+    run(server, controlfile, outputs);
+  } catch (const std::exception&) {
+    return true;
+  }
+  cerr << what << " did not fail\n";
+  return false;
+}
+
+int main() {
+  define_wsv_group_names();
+  Workspace::define_wsv_data();
+  Workspace::define_wsv_map();
+  define_md_data_raw();
+  expand_md_data_raw_to_md_data();
+  define_md_map();
+  define_md_raw_map();
+  define_agenda_data();
+  define_agenda_map();
+  define_species_data();
+  define_species_map();
+
+  bool ok = true;
+  {
+    JobServer server(-1, 2, Verbosity(0, 0, 0));
+    server.update_resident("VectorSet( f_grid, [1, 2, 3] )");
+
+    ok &= check("Job",
+                run(server, "VectorScale( f_grid, f_grid, 2 )", "f_grid"),
+                vector_result("f_grid", Vector{2, 4, 6}));
+    ok &= check("Resident data after job",
+                run(server, "", "f_grid"),
+                vector_result("f_grid", Vector{1, 2, 3}));
+    ok &= check("Override",
+                run(server,
+                    "VectorScale( f_grid, f_grid, 2 )",
+                    "f_grid",
+                    {{"f_grid", "1,1"}}),
+                vector_result("f_grid", Vector{2, 2}));
+
+    ok &= check_fails(server, "Exit", "Exit", "f_grid");
+    ok &= check_fails(server, "Unset output", "", "p_grid");
+    ok &= check_fails(server, "Unknown output", "", "no_such_variable");
+    ok &= check_fails(server, "Run-time error", "Error( \"x\" )", "f_grid");
+  }
+
+  if (ok) cout << "All tests PASSED\n";
+  return ok ? 0 : 1;
+}
+
+#else
+
+int main() {
+  cout << "The job server is not enabled.\n";
+  return 0;
+}
+
+#endif
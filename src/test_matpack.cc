@@ -17,13 +17,16 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <thread>
 #include "array.h"
 #include "describe.h"
 #include "exceptions.h"
 #include "logic.h"
 #include "math_funcs.h"
+#include "matpack_alloc.h"
 #include "matpackII.h"
 #include "matpackVII.h"
 #include "mystring.h"
@@ -1358,6 +1361,210 @@ void test47() {
   std::cout << "mv2.ncols: " << mv2.ncols() << std::endl;
 }
 
+//! Fills all elements with a repeating sequence of non-zero values
+void fill_sequence(Numeric& x, Index& c) { x = 1 + 0.1 * Numeric(c++ % 17); }
+
+template <class T>
+void fill_sequence(T&& x, Index& c) {
+  for (auto it = x.begin(); it != x.end(); ++it) fill_sequence(*it, c);
+}
+
+/** Applies the same operations to a contiguous tensor and to a strided
+    view of the same shape, and returns the maximum deviation between the
+    two. The first uses the flat fast paths, the second the iterators. */
+template <class T, class V>
+Numeric contiguous_vs_strided(T& a, V v) {
+  Index c = 0;
+  fill_sequence(a, c);
+  v = a;
+  const T b(a);
+
+  a *= 1.5;
+  v *= 1.5;
+  a /= 3.0;
+  v /= 3.0;
+  a += 0.5;
+  v += 0.5;
+  a -= 0.25;
+  v -= 0.25;
+  a *= b;
+  v *= b;
+  a /= b;
+  v /= b;
+  a += b;
+  v += b;
+  a -= b;
+  v -= b;
+
+  T d(v);
+  d -= a;
+  return std::max(max(d), -min(d));
+}
+
+//! Reports a check, and ends the test program with an error if it failed
+void check(const String& what, bool ok) {
+  cout << what << ": " << (ok ? "PASSED" : "FAILED") << "\n";
+  if (!ok) exit(EXIT_FAILURE);
+}
+
+void test48() {
+  // The contiguous fast paths of the views must give the same result as
+  // the general iterator loops.
+  Vector a1(7), s1(14);
+  check("Vector", contiguous_vs_strided(a1, s1[Range(0, 7, 2)]) == 0);
+  Matrix a2(3, 7), s2(3, 14);
+  check("Matrix", contiguous_vs_strided(a2, s2(joker, Range(0, 7, 2))) == 0);
+  Tensor3 a3(2, 3, 7), s3(2, 3, 14);
+  check("Tensor3",
+        contiguous_vs_strided(a3, s3(joker, joker, Range(0, 7, 2))) == 0);
+  Tensor4 a4(2, 2, 3, 7), s4(2, 2, 3, 14);
+  check("Tensor4",
+        contiguous_vs_strided(a4, s4(joker, joker, joker, Range(0, 7, 2))) ==
+            0);
+  Tensor5 a5(2, 2, 2, 3, 7), s5(2, 2, 2, 3, 14);
+  check("Tensor5",
+        contiguous_vs_strided(
+            a5, s5(joker, joker, joker, joker, Range(0, 7, 2))) == 0);
+  Tensor6 a6(2, 2, 2, 2, 3, 7), s6(2, 2, 2, 2, 3, 14);
+  check("Tensor6",
+        contiguous_vs_strided(
+            a6, s6(joker, joker, joker, joker, joker, Range(0, 7, 2))) == 0);
+  Tensor7 a7(2, 2, 2, 2, 2, 3, 7), s7(2, 2, 2, 2, 2, 3, 14);
+  check("Tensor7",
+        contiguous_vs_strided(
+            a7,
+            s7(joker, joker, joker, joker, joker, joker, Range(0, 7, 2))) ==
+            0);
+
+  // Assignment between overlapping views acts as if through a temporary
+  const Index n = 10;
+  Vector x(n), y(n);
+  for (Index i = 0; i < n; i++) x[i] = y[i] = Numeric(i);
+  x[Range(0, n - 1)] = x[Range(1, n - 1)];
+  y[Range(1, n - 1)] = y[Range(0, n - 1)];
+  bool ok = x[n - 1] == n - 1 && y[0] == 0;
+  for (Index i = 0; i < n - 1; i++) ok = ok && x[i] == i + 1 && y[i + 1] == i;
+  check("Overlapping vectors", ok);
+
+  Matrix m(4, 3);
+  for (Index r = 0; r < 4; r++)
+    for (Index c = 0; c < 3; c++) m(r, c) = Numeric(10 * r + c);
+  m(Range(1, 3), joker) = m(Range(0, 3), joker);
+  ok = true;
+  for (Index c = 0; c < 3; c++) {
+    ok = ok && m(0, c) == c;
+    for (Index r = 1; r < 4; r++) ok = ok && m(r, c) == 10 * (r - 1) + c;
+  }
+  check("Overlapping matrices", ok);
+}
+
+void test49() {
+  // Alignment of matpack data and use of scratch arenas
+  auto aligned = [](const Numeric& x, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(&x) % alignment == 0;
+  };
+  const MatpackAllocStats start = matpack_alloc_stats();
+  Vector small(3);
+  Vector large(MATPACK_ALIGNED_BYTES / sizeof(Numeric));
+  Tensor7 t(1, 1, 1, 1, 4, 8, 8);
+  check("Alignment",
+        aligned(small[0], 16) && aligned(large[0], MATPACK_ALIGNMENT) &&
+            aligned(t(0, 0, 0, 0, 0, 0, 0), MATPACK_ALIGNMENT));
+  const MatpackAllocStats heap = matpack_alloc_stats();
+  check("Heap counters",
+        heap.heap_allocs - start.heap_allocs == 3 &&
+            heap.heap_bytes - start.heap_bytes ==
+                Index(sizeof(Numeric)) * (4 + 128 + 256));
+
+  Matrix outlive;
+  bool arena_aligned = true;
+  for (Index i = 0; i < 100; i++) {
+    MatpackArena arena;
+    Vector a(10, 1.0);
+    Matrix b(10, 10, 2.0);
+    Vector c(200, 0.0);
+    a *= b(joker, 0);
+    arena_aligned = arena_aligned && aligned(a[0], 16) &&
+                    aligned(c[0], MATPACK_ALIGNMENT);
+    // Survives the arena
+    if (i == 99) outlive = b;
+  }
+  check("Arena alignment", arena_aligned);
+  const MatpackAllocStats end = matpack_alloc_stats();
+  check("Arena counters",
+        end.heap_allocs == heap.heap_allocs &&
+            end.arena_allocs - heap.arena_allocs == 301);
+  check("Outliving matrix", outlive(9, 9) == 2.0);
+
+  // The counters include other threads, running or finished
+  MatpackAllocStats running;
+  std::thread([&running] {
+    MatpackArena arena;
+    Vector v(10);
+    Vector w(10);
+    running = matpack_alloc_stats();
+  }).join();
+  const MatpackAllocStats finished = matpack_alloc_stats();
+  check("Thread counters",
+        running.heap_allocs == end.heap_allocs &&
+            running.arena_allocs - end.arena_allocs == 2 &&
+            finished.heap_allocs == end.heap_allocs &&
+            finished.arena_allocs - end.arena_allocs == 2);
+}
+
+void test50() {
+  // Tensors referring to external data
+  std::vector<Numeric> buffer(24, 1.0);
+  {
+    Tensor3 t;
+    t.adopt_external(buffer.data(), 2, 3, 4);
+    t *= 2.0;
+    t(1, 2, 3) = 5.0;
+    check("Shared data",
+          &t(0, 0, 0) == buffer.data() && buffer[0] == 2.0 &&
+              buffer[23] == 5.0);
+
+    // Assignments of the same size, also by move, copy to the buffer
+    t = Tensor3(2, 3, 4, 3.0);
+    check("Move assignment of the same size",
+          &t(0, 0, 0) == buffer.data() && buffer[23] == 3.0);
+    const Tensor3 u(2, 3, 4, 4.0);
+    t = u;
+    check("Copy assignment of the same size",
+          &t(0, 0, 0) == buffer.data() && buffer[23] == 4.0);
+
+    // Other sizes detach the tensor from the buffer
+    t = Tensor3(1, 1, 1, 6.0);
+    check("Move assignment of another size",
+          &t(0, 0, 0) != buffer.data() && buffer[0] == 4.0);
+    t.adopt_external(buffer.data(), 2, 3, 4);
+    t.resize(1, 1, 1);
+    t = 7.0;
+    check("Resize", &t(0, 0, 0) != buffer.data() && buffer[0] == 4.0);
+
+    // The buffer is handed over by move and swap, and is not released by
+    // any of the tensors
+    t.adopt_external(buffer.data(), 2, 3, 4);
+    Tensor3 moved(std::move(t));
+    Tensor3 swapped;
+    swap(swapped, moved);
+    check("Move and swap",
+          &swapped(0, 0, 0) == buffer.data() && moved.empty());
+  }
+  check("Buffer after destruction", buffer[23] == 4.0);
+
+  // Detaching copies the data
+  {
+    Tensor3 t;
+    t.adopt_external(buffer.data(), 2, 3, 4);
+    t.detach_external(buffer.data());
+    buffer[23] = 8.0;
+    check("Detach",
+          &t(0, 0, 0) != buffer.data() && t(1, 2, 3) == 4.0 &&
+              t.npages() == 2 && t.nrows() == 3 && t.ncols() == 4);
+  }
+}
+
 int main() {
   //   test1();
   //   test2();
@@ -1407,6 +1614,9 @@ int main() {
   //    test45();
   //    test46();
   //  test47();
+  test48();
+  test49();
+  test50();
 
   //    const double tolerance = 1e-9;
   //    double error;
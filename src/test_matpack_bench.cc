@@ -0,0 +1,186 @@
+/* Copyright (C) 2026 The ARTS developers
+
+   This program is free software; you can redistribute it and/or modify it
+   under the terms of the GNU General Public License as published by the
+   Free Software Foundation; either version 2, or (at your option) any
+   later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+   USA. */
+
+/*!
+  \file   test_matpack_bench.cc
+  \brief  Checks and times copying and element-wise arithmetic of matpack
+          views.
+
+  Each operation is timed for a contiguous tensor, where the flat fast
+  paths are used, and for a strided view with the same number of elements,
+  where the general iterator loops are used. Both must give the same
+  result. The shapes mimic typical cloudbox_field (Tensor7) and pnd_field
+  (Tensor4) sizes, with short innermost dimensions.
+
+  Assignment between overlapping contiguous views (memmove) is timed and
+  checked against a copy through a temporary.
+*/
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include "matpackVII.h"
+#include "mystring.h"
+
+using std::cout;
+using std::setw;
+
+//! Runs f repeatedly and returns the time per element, in ns
+template <class F>
+double time_per_element(F&& f, const Index nelem) {
+  const Index nrep = std::max(Index(1), Index(2e7) / nelem);
+  f();  // Warm-up
+  const auto t0 = std::chrono::steady_clock::now();
+  for (Index i = 0; i < nrep; i++) f();
+  const auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(t1 - t0).count() /
+         double(nrep * nelem);
+}
+
+//! Largest absolute difference between a tensor and a view of the same size
+template <class T, class V>
+Numeric max_diff(const T& a, const V& v, const Index nelem) {
+  const T c(v);
+  const Numeric* pa = a.get_c_array();
+  const Numeric* pc = c.get_c_array();
+  Numeric d = 0;
+  for (Index i = 0; i < nelem; i++) d = std::max(d, std::abs(pa[i] - pc[i]));
+  return d;
+}
+
+//! Times all operations for a contiguous tensor and a strided view, and
+//! checks that both give the same result
+template <class T, class V>
+bool bench(const String& name, T& a, V v, const Index nelem) {
+  const T b(a);
+  bool ok = true;
+
+  cout << name << " (" << nelem << " elements), ns/element:\n";
+  cout << setw(12) << "" << setw(12) << "contiguous" << setw(12)
+       << "strided\n";
+
+  auto row = [&](const String& op, auto fa, auto fv) {
+    cout << setw(12) << op << setw(12) << std::setprecision(3)
+         << time_per_element(fa, nelem) << setw(12)
+         << time_per_element(fv, nelem);
+    const Numeric d = max_diff(a, v, nelem);
+    if (d != 0) {
+      cout << "  FAILED, max difference " << d;
+      ok = false;
+    }
+    cout << "\n";
+  };
+
+  row("copy", [&]() { a = b; }, [&]() { v = b; });
+  row("fill", [&]() { a = 1.0; }, [&]() { v = 1.0; });
+  row("scale", [&]() { a *= 1.000001; }, [&]() { v *= 1.000001; });
+  row("add", [&]() { a += b; }, [&]() { v += b; });
+  row("multiply", [&]() { a *= b; }, [&]() { v *= b; });
+  cout << "\n";
+  return ok;
+}
+
+//! Times shifts of a vector by one element, by assignment between
+//! overlapping views and through a temporary, and checks that both give
+//! the same result
+bool bench_overlap(const Index n) {
+  Vector a(n), b(n);
+  for (Index i = 0; i < n; i++) a[i] = b[i] = Numeric(i);
+  bool ok = true;
+
+  cout << "Overlapping Vector (" << n - 1 << " elements), ns/element:\n";
+  cout << setw(12) << "" << setw(12) << "overlapping" << setw(12)
+       << "temporary\n";
+
+  auto row = [&](const String& op, auto fa, auto fb) {
+    cout << setw(12) << op << setw(12) << std::setprecision(3)
+         << time_per_element(fa, n - 1) << setw(12)
+         << time_per_element(fb, n - 1);
+    const Numeric d = max_diff(a, b, n);
+    if (d != 0) {
+      cout << "  FAILED, max difference " << d;
+      ok = false;
+    }
+    cout << "\n";
+  };
+
+  // Shifts towards the start spread the last value, and shifts towards the
+  // end the first value, so restore the ramp before each operation
+  row("down",
+      [&]() { a[Range(0, n - 1)] = a[Range(1, n - 1)]; },
+      [&]() {
+        const Vector t(b[Range(1, n - 1)]);
+        b[Range(0, n - 1)] = t;
+      });
+  for (Index i = 0; i < n; i++) a[i] = b[i] = Numeric(i);
+  row("up",
+      [&]() { a[Range(1, n - 1)] = a[Range(0, n - 1)]; },
+      [&]() {
+        const Vector t(b[Range(0, n - 1)]);
+        b[Range(1, n - 1)] = t;
+      });
+
+  // Two shifts, for the same start, give a known result
+  for (Index i = 0; i < n; i++) a[i] = Numeric(i);
+  a[Range(0, n - 1)] = a[Range(1, n - 1)];
+  a[Range(0, n - 1)] = a[Range(1, n - 1)];
+  const Numeric last = Numeric(n - 1);
+  bool shifted = a[n - 1] == last && a[n - 2] == last;
+  for (Index i = 0; i < n - 2; i++)
+    shifted = shifted && a[i] == Numeric(i + 2);
+  if (!shifted) {
+    cout << "  FAILED, wrong values after two shifts\n";
+    ok = false;
+  }
+  cout << "\n";
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  {
+    Vector a(100000, 1.0), s(200000, 1.0);
+    ok &= bench("Vector", a, s[Range(0, 100000, 2)], a.nelem());
+  }
+  {
+    Matrix a(1000, 100, 1.0), s(1000, 200, 1.0);
+    ok &= bench(
+        "Matrix", a, s(joker, Range(0, 100, 2)), a.nrows() * a.ncols());
+  }
+  {
+    // pnd_field like: scattering elements x p x lat x lon
+    Tensor4 a(50, 40, 10, 10, 1.0), s(50, 40, 10, 20, 1.0);
+    ok &= bench("Tensor4",
+                a,
+                s(joker, joker, joker, Range(0, 10, 2)),
+                a.nbooks() * a.npages() * a.nrows() * a.ncols());
+  }
+  {
+    // cloudbox_field like: f x p x lat x lon x za x aa x stokes
+    Tensor7 a(10, 40, 1, 1, 37, 10, 1, 1.0), s(10, 40, 1, 1, 37, 10, 2, 1.0);
+    ok &= bench("Tensor7",
+                a,
+                s(joker, joker, joker, joker, joker, joker, Range(0, 1, 2)),
+                a.nlibraries() * a.nvitrines() * a.nshelves() * a.nbooks() *
+                    a.npages() * a.nrows() * a.ncols());
+  }
+  ok &= bench_overlap(100000);
+
+  if (ok) cout << "All tests PASSED\n";
+  return ok ? 0 : 1;
+}
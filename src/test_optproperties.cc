@@ -0,0 +1,222 @@
+/* Copyright (C) 2026 The ARTS developers
+
+   This program is free software; you can redistribute it and/or modify it
+   under the terms of the GNU General Public License as published by the
+   Free Software Foundation; either version 2, or (at your option) any
+   later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307,
+   USA. */
+
+/*!
+  \file   test_optproperties.cc
+
+  \brief  Checks and times the bulk sums over scattering elements.
+
+  opt_prop_ScatSpecBulk and pha_mat_ScatSpecBulk are compared to a sum
+  scaling and adding one scattering element at a time, and the run times
+  of both are printed.
+*/
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "arts.h"
+#include "optproperties.h"
+
+using std::chrono::duration;
+using std::chrono::steady_clock;
+
+//! Fills n numbers with random values
+void fill_random(Numeric* p, const Index n, std::mt19937& gen) {
+  std::uniform_real_distribution<Numeric> dist(0, 1);
+  for (Index i = 0; i < n; i++) p[i] = dist(gen);
+}
+
+//! Random pnds, with every fourth value zero
+Matrix random_pnds(const Index nse, const Index nT, std::mt19937& gen) {
+  std::uniform_real_distribution<Numeric> dist(0, 1);
+  Matrix pnds(nse, nT);
+  for (Index i = 0; i < nse; i++)
+    for (Index j = 0; j < nT; j++)
+      pnds(i, j) = (i + j) % 4 ? dist(gen) : 0;
+  return pnds;
+}
+
+//! The bulk phase matrix, one scattering element at a time
+void pha_mat_reference(Tensor6& pha_mat,
+                       const ArrayOfTensor6& pha_mat_se,
+                       ConstMatrixView pnds) {
+  const Tensor6& se0 = pha_mat_se[0];
+  pha_mat.resize(se0.nvitrines(),
+                 se0.nshelves(),
+                 se0.nbooks(),
+                 se0.npages(),
+                 se0.nrows(),
+                 se0.ncols());
+  pha_mat = 0;
+  Tensor5 pha_tmp;
+  for (Index i_se = 0; i_se < pha_mat_se.nelem(); i_se++)
+    for (Index Tind = 0; Tind < pnds.ncols(); Tind++)
+      if (pnds(i_se, Tind) != 0) {
+        pha_tmp = pha_mat_se[i_se](joker, Tind, joker, joker, joker, joker);
+        pha_tmp *= pnds(i_se, Tind);
+        pha_mat(joker, Tind, joker, joker, joker, joker) += pha_tmp;
+      }
+}
+
+//! The bulk extinction and absorption, one scattering element at a time
+void opt_prop_reference(Tensor5& ext_mat,
+                        Tensor4& abs_vec,
+                        const ArrayOfTensor5& ext_mat_se,
+                        const ArrayOfTensor4& abs_vec_se,
+                        ConstMatrixView pnds) {
+  const Tensor5& se0 = ext_mat_se[0];
+  ext_mat.resize(se0.nshelves(),
+                 se0.nbooks(),
+                 se0.npages(),
+                 se0.nrows(),
+                 se0.ncols());
+  ext_mat = 0;
+  abs_vec.resize(se0.nshelves(), se0.nbooks(), se0.npages(), se0.nrows());
+  abs_vec = 0;
+  Tensor4 ext_tmp;
+  Tensor3 abs_tmp;
+  for (Index i_se = 0; i_se < ext_mat_se.nelem(); i_se++)
+    for (Index Tind = 0; Tind < pnds.ncols(); Tind++)
+      if (pnds(i_se, Tind) != 0) {
+        ext_tmp = ext_mat_se[i_se](joker, Tind, joker, joker, joker);
+        ext_tmp *= pnds(i_se, Tind);
+        ext_mat(joker, Tind, joker, joker, joker) += ext_tmp;
+
+        abs_tmp = abs_vec_se[i_se](joker, Tind, joker, joker);
+        abs_tmp *= pnds(i_se, Tind);
+        abs_vec(joker, Tind, joker, joker) += abs_tmp;
+      }
+}
+
+//! Largest relative difference of n numbers
+Numeric max_rel_diff(const Numeric* a, const Numeric* b, const Index n) {
+  Numeric d = 0;
+  for (Index i = 0; i < n; i++)
+    d = max(d, abs(a[i] - b[i]) / max(abs(b[i]), 1e-300));
+  return d;
+}
+
+//! Runs f n times and returns the mean time, in ms
+template <class F>
+Numeric time_ms(const Index n, F f) {
+  const auto start = steady_clock::now();
+  for (Index i = 0; i < n; i++) f();
+  return duration<Numeric, std::milli>(steady_clock::now() - start).count() /
+         Numeric(n);
+}
+
+bool test_pha_mat(const Index nse,
+                  const Index nf,
+                  const Index nT,
+                  const Index ndir,
+                  const Index stokes_dim,
+                  std::mt19937& gen) {
+  const Index n_se = nf * nT * ndir * ndir * stokes_dim * stokes_dim;
+  ArrayOfArrayOfTensor6 pha_mat_se(1);
+  pha_mat_se[0].resize(nse);
+  for (auto& se : pha_mat_se[0]) {
+    se.resize(nf, nT, ndir, ndir, stokes_dim, stokes_dim);
+    fill_random(se.get_c_array(), n_se, gen);
+  }
+  const ArrayOfArrayOfIndex ptypes_se(1, ArrayOfIndex(nse, PTYPE_TOTAL_RND));
+  const Matrix pnds = random_pnds(nse, nT, gen);
+  Matrix t_ok(nse, nT, 1);
+
+  ArrayOfTensor6 pha_mat;
+  ArrayOfIndex ptype;
+  Tensor6 pha_mat_ref;
+  const Index n = 5;
+  const Numeric t = time_ms(n, [&] {
+    pha_mat_ScatSpecBulk(pha_mat, ptype, pha_mat_se, ptypes_se, pnds, t_ok);
+  });
+  const Numeric t_ref = time_ms(
+      n, [&] { pha_mat_reference(pha_mat_ref, pha_mat_se[0], pnds); });
+
+  const Numeric d =
+      max_rel_diff(pha_mat[0].get_c_array(), pha_mat_ref.get_c_array(), n_se);
+  cout << "pha_mat_ScatSpecBulk, " << nse << " elements, nf = " << nf
+       << ", nT = " << nT << ", " << ndir << " x " << ndir
+       << " directions, stokes_dim = " << stokes_dim << ":\n"
+       << "  " << t << " ms, element by element " << t_ref
+       << " ms, max relative difference " << d << "\n";
+  return d < 1e-12;
+}
+
+bool test_opt_prop(const Index nse,
+                   const Index nf,
+                   const Index nT,
+                   const Index ndir,
+                   const Index stokes_dim,
+                   std::mt19937& gen) {
+  const Index n_ext = nf * nT * ndir * stokes_dim * stokes_dim;
+  ArrayOfArrayOfTensor5 ext_mat_se(1);
+  ArrayOfArrayOfTensor4 abs_vec_se(1);
+  ext_mat_se[0].resize(nse);
+  abs_vec_se[0].resize(nse);
+  for (Index i = 0; i < nse; i++) {
+    ext_mat_se[0][i].resize(nf, nT, ndir, stokes_dim, stokes_dim);
+    fill_random(ext_mat_se[0][i].get_c_array(), n_ext, gen);
+    abs_vec_se[0][i].resize(nf, nT, ndir, stokes_dim);
+    fill_random(abs_vec_se[0][i].get_c_array(), n_ext / stokes_dim, gen);
+  }
+  const ArrayOfArrayOfIndex ptypes_se(1, ArrayOfIndex(nse, PTYPE_TOTAL_RND));
+  const Matrix pnds = random_pnds(nse, nT, gen);
+  Matrix t_ok(nse, nT, 1);
+
+  ArrayOfTensor5 ext_mat;
+  ArrayOfTensor4 abs_vec;
+  ArrayOfIndex ptype;
+  Tensor5 ext_mat_ref;
+  Tensor4 abs_vec_ref;
+  const Index n = 5;
+  const Numeric t = time_ms(n, [&] {
+    opt_prop_ScatSpecBulk(
+        ext_mat, abs_vec, ptype, ext_mat_se, abs_vec_se, ptypes_se, pnds, t_ok);
+  });
+  const Numeric t_ref = time_ms(n, [&] {
+    opt_prop_reference(
+        ext_mat_ref, abs_vec_ref, ext_mat_se[0], abs_vec_se[0], pnds);
+  });
+
+  const Numeric d = max(
+      max_rel_diff(ext_mat[0].get_c_array(), ext_mat_ref.get_c_array(), n_ext),
+      max_rel_diff(abs_vec[0].get_c_array(),
+                   abs_vec_ref.get_c_array(),
+                   n_ext / stokes_dim));
+  cout << "opt_prop_ScatSpecBulk, " << nse << " elements, nf = " << nf
+       << ", nT = " << nT << ", " << ndir
+       << " directions, stokes_dim = " << stokes_dim << ":\n"
+       << "  " << t << " ms, element by element " << t_ref
+       << " ms, max relative difference " << d << "\n";
+  return d < 1e-12;
+}
+
+int main() {
+  std::mt19937 gen(1);
+  bool ok = true;
+
+  // One frequency at a time, as in DOIT and RT4
+  ok &= test_pha_mat(30, 1, 40, 19, 1, gen);
+  ok &= test_pha_mat(30, 1, 40, 19, 4, gen);
+  // Several frequencies
+  ok &= test_pha_mat(30, 10, 10, 19, 1, gen);
+  ok &= test_opt_prop(30, 1, 40, 37, 4, gen);
+  ok &= test_opt_prop(30, 10, 10, 37, 4, gen);
+
+  if (ok) cout << "All tests PASSED\n";
+  return ok ? 0 : 1;
+}
@@ -1108,6 +1108,63 @@ Numeric test_sparse_arithmetic(Index m, Index n, Index ntests, bool verbose) {
   return err_max;
 }
 
+//! Test sparse-dense multiplication with aliased output.
+/*!
+  Performs the multiplication A = B * C, where A is stored in the same
+  memory as C, completely or shifted by one row, and compares to the
+  result for non-aliased matrices.
+
+  \param m The number of rows and columns of the sparse matrix B
+  \param n The number of columns of C
+  \param ntests The number of test to be performed
+  \param verbose If true, the results of each test are printed to stdout.
+
+  \return The maximum relative error taken over all tests.
+*/
+Numeric test_sparse_dense_aliasing(Index m,
+                                   Index n,
+                                   Index ntests,
+                                   bool verbose) {
+  Numeric err_max = 0.0;
+
+  if (verbose) {
+    cout << endl;
+    cout << "Testing sparse-dense multiplication with aliasing:" << endl;
+    cout << setw(5) << "Test " << setw(15) << "Same" << setw(15) << "Shifted"
+         << endl;
+    cout << std::string(35, '-') << endl;
+  }
+
+  for (Index i = 0; i < ntests; i++) {
+    Sparse B(m, m);
+    random_fill_matrix(B, 10, false);
+
+    // Complete aliasing
+    Matrix C(m, n), A_ref(m, n);
+    random_fill_matrix(C, 10, false);
+    mult(A_ref, B, C);
+    mult(C, B, C);
+
+    Numeric err = get_maximum_error(C, A_ref, true);
+    if (err > err_max) err_max = err;
+
+    if (verbose) cout << setw(5) << i << setw(15) << err;
+
+    // Output shifted by one row
+    Matrix X(m + 1, n), C_copy;
+    random_fill_matrix(X, 10, false);
+    C_copy = X(Range(1, m), joker);
+    mult(A_ref, B, C_copy);
+    mult(X(Range(0, m), joker), B, X(Range(1, m), joker));
+
+    err = get_maximum_error(X(Range(0, m), joker), A_ref, true);
+    if (err > err_max) err_max = err;
+
+    if (verbose) cout << setw(15) << err << endl;
+  }
+  return err_max;
+}
+
 int main() {
   // test3();
   // test38();
@@ -1173,6 +1230,13 @@ int main() {
   else
     cout << "FAILED (Error: " << err << ")" << endl;
 
+  cout << "Testing sparse-dense multiplication with aliasing: ";
+  err = test_sparse_dense_aliasing(100, 50, 10, false);
+  if (err < 1e-11)
+    cout << "PASSED" << endl;
+  else
+    cout << "FAILED (Error: " << err << ")" << endl;
+
   cout << "Testing dense-sparse multiplication: ";
   err = test_dense_sparse_multiplication(1000, 1000, 1000, false);
   if (err < 1e-11)
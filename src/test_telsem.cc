@@ -26,6 +26,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -200,6 +201,68 @@ Numeric test_telsem_read(String atlas_file,
   return error;
 }
 
+/** Test batch evaluation of TELSEM emissivities
+ *
+ * Evaluates the emissivities on a lat/lon map with emis_interp_batch and
+ * compares them to the results of emis_interp for each location. Locations
+ * that are not contained in the atlas must be NaN.
+ *
+ * @param atlas_file The path to the atlas file.
+ * @param resolution The resolution to use for the lat/lon map.
+ * @param theta The incidence angle to which to interpolate the frequencies.
+ * @param frequencies The frequencies [GHz] (!!!) for which to interpolate the emissivities
+ */
+Numeric test_telsem_batch(std::string atlas_file,
+                          Numeric resolution,
+                          Numeric theta,
+                          Vector frequencies) {
+  TelsemAtlas atlas(atlas_file);
+
+  Index n_freqs = frequencies.nelem();
+  Index n_lat = static_cast<Index>(180.0 / resolution);
+  Index n_lon = static_cast<Index>(360.0 / resolution);
+
+  Vector lats(n_lat * n_lon), lons(n_lat * n_lon), thetas(n_lat * n_lon);
+  for (Index i = 0; i < n_lat; ++i) {
+    for (Index j = 0; j < n_lon; ++j) {
+      lats[i * n_lon + j] = 0.125 + resolution / 2.0 - 90.0 +
+                            static_cast<Numeric>(i) * resolution;
+      lons[i * n_lon + j] =
+          0.125 + resolution / 2.0 + static_cast<Numeric>(j) * resolution;
+    }
+  }
+  thetas = theta;
+
+  Tensor3 emis;
+  atlas.emis_interp_batch(emis, lats, lons, thetas, frequencies, -1.0);
+
+  Numeric error = 0.0;
+  for (Index i = 0; i < lats.nelem(); ++i) {
+    Index cellnumber = atlas.calc_cellnum(lats[i], lons[i]);
+    if (atlas.contains(cellnumber)) {
+      Vector emis_h = atlas.get_emis_h(cellnumber);
+      Vector emis_v = atlas.get_emis_v(cellnumber);
+      Index class1 = atlas.get_class1(cellnumber);
+      Index class2 = atlas.get_class2(cellnumber);
+
+      for (Index k = 0; k < n_freqs; ++k) {
+        Numeric e_v, e_h;
+        std::tie(e_v, e_h) = atlas.emis_interp(
+            theta, frequencies[k], class1, class2, emis_v, emis_h);
+        error = std::max(error, std::fabs(emis(i, k, 0) - e_v));
+        error = std::max(error, std::fabs(emis(i, k, 1) - e_h));
+      }
+    } else {
+      for (Index k = 0; k < n_freqs; ++k) {
+        if (!std::isnan(emis(i, k, 0)) || !std::isnan(emis(i, k, 1))) {
+          error = std::numeric_limits<Numeric>::infinity();
+        }
+      }
+    }
+  }
+  return error;
+}
+
 int main(int argc, const char** argv) {
   if (argc != 4) {
     std::cout
@@ -235,5 +298,11 @@ int main(int argc, const char** argv) {
       atlas_file, result_path, resolution, theta, frequencies);
   std::cout << "Maximum error interpolating emissivities: " << error
             << std::endl;
+
+  // Batch evaluation of emissivities.
+
+  error = test_telsem_batch(atlas_file, resolution, theta, frequencies);
+  std::cout << "Maximum error of batch emissivities:      " << error
+            << std::endl;
   return 0;
 }
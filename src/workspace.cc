@@ -1589,6 +1589,41 @@ void Workspace::define_wsv_data() {
           "        N_za, N_aa, N_i ]\n"),
       GROUP("Tensor6")));
 
+  wsv_data.push_back(WsvRecord(
+      NAME("doit_scat_operator"),
+      DESCRIPTION(
+          "Scattering operator of each cloudbox level (DOIT, 1D).\n"
+          "\n"
+          "The matrix of each level maps a profile of *cloudbox_field_mono*\n"
+          "to the scattering integral *doit_scat_field* at that level, with\n"
+          "the quadrature weights of the angular integration included. Rows\n"
+          "and columns are ordered by zenith angle and then Stokes component.\n"
+          "\n"
+          "An empty operator means that the scattering integral is computed\n"
+          "from *pha_mat_doit* in each iteration.\n"
+          "\n"
+          "Usage: Output of *doit_scat_operatorCalc*, input to\n"
+          "       *doit_scat_fieldCalc*.\n"
+          "\n"
+          "Size: [(cloudbox_limits[1] - cloudbox_limits[0]) +1, \n"
+          "       N_za * N_i, N_za * N_i ]\n"),
+      GROUP("Tensor3")));
+
+  wsv_data.push_back(WsvRecord(
+      NAME("doit_scat_operator_info"),
+      DESCRIPTION(
+          "What *doit_scat_operator* was computed for.\n"
+          "\n"
+          "The elements are *f_index*, the number of cloudbox levels, N_za,\n"
+          "N_aa and N_i. *doit_scat_fieldCalc* checks that they match before\n"
+          "using the operator.\n"
+          "\n"
+          "Usage: Output of *doit_scat_operatorCalc*, input to\n"
+          "       *doit_scat_fieldCalc*.\n"
+          "\n"
+          "Size: [5] or [0]\n"),
+      GROUP("ArrayOfIndex")));
+
   wsv_data.push_back(
       WsvRecord(NAME("doit_za_grid_opt"),
                 DESCRIPTION("Optimized zenith angle grid.\n"
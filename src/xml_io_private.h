@@ -50,7 +50,7 @@
 //   Functions to open and read XML files
 ////////////////////////////////////////////////////////////////////////////
 
-void xml_open_output_file(ostream& file, const String& name);
+void xml_open_output_file(ofstream& file, const String& name);
 
 void xml_open_input_file(ifstream& file,
                          const String& name,